@@ -74,6 +74,12 @@ struct ReservedInstance {
 struct DAWN_WIRE_EXPORT WireClientDescriptor {
     CommandSerializer* serializer;
     client::MemoryTransferService* memoryTransferService = nullptr;
+    // Packs consecutive SetPipeline, SetBindGroup, SetVertexBuffer, SetIndexBuffer, Draw and
+    // DrawIndexed calls on the same render pass encoder into a single compact command, skipping
+    // the ones that don't change the state. The batch is serialized before any other command, so
+    // the batched calls of a render pass are only sent once another command, like End, is
+    // encoded.
+    bool enableRenderPassCommandBatching = false;
 };
 
 class DAWN_WIRE_EXPORT WireClient : public CommandHandler {
@@ -36,6 +36,8 @@
 
 #include "src/tint/api/common/binding_point.h"
 #include "src/tint/api/tint.h"
+#include "src/tint/lang/core/ir/binary/flat/decode.h"
+#include "src/tint/lang/core/ir/binary/flat/encode.h"
 #include "src/tint/lang/core/type/manager.h"
 #include "src/tint/lang/wgsl/ast/transform/first_index_offset.h"
 #include "src/tint/lang/wgsl/ast/transform/manager.h"
@@ -27,12 +27,74 @@
 
 #include "dawn/native/AsyncTask.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <utility>
 
 #include "dawn/platform/DawnPlatform.h"
 
 namespace dawn::native {
 
+namespace {
+
+class ParallelTasks : public RefCounted {
+  public:
+    ParallelTasks(size_t taskCount, const std::function<void(size_t)>* task)
+        : mTaskCount(taskCount), mTask(task) {}
+
+    // Makes calls to the task until all of them are started.
+    void RunPendingTasks() {
+        for (size_t i = mNextIndex++; i < mTaskCount; i = mNextIndex++) {
+            (*mTask)(i);
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (++mCompletedCount == mTaskCount) {
+                mCondition.notify_all();
+            }
+        }
+    }
+
+    void WaitAllTasks() {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return mCompletedCount == mTaskCount; });
+    }
+
+    static void DoWorkerTask(void* userdata) {
+        Ref<ParallelTasks> tasks = AcquireRef(static_cast<ParallelTasks*>(userdata));
+        tasks->RunPendingTasks();
+    }
+
+  private:
+    const size_t mTaskCount;
+    // Only used while the thread calling RunTasksInParallel waits. Worker tasks that start later
+    // find no more calls to make.
+    raw_ptr<const std::function<void(size_t)>> mTask;
+    std::atomic<size_t> mNextIndex = 0;
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    size_t mCompletedCount = 0;
+};
+
+}  // anonymous namespace
+
+void RunTasksInParallel(dawn::platform::WorkerTaskPool* workerTaskPool,
+                        size_t taskCount,
+                        const std::function<void(size_t)>& task) {
+    if (taskCount == 0) {
+        return;
+    }
+
+    Ref<ParallelTasks> tasks = AcquireRef(new ParallelTasks(taskCount, &task));
+    for (size_t i = 1; i < taskCount; ++i) {
+        // The reference is acquired by the worker task.
+        tasks->AddRef();
+        workerTaskPool->PostWorkerTask(ParallelTasks::DoWorkerTask, tasks.Get());
+    }
+
+    tasks->RunPendingTasks();
+    tasks->WaitAllTasks();
+}
+
 AsyncTaskManager::AsyncTaskManager(dawn::platform::WorkerTaskPool* workerTaskPool)
     : mWorkerTaskPool(workerTaskPool) {}
 
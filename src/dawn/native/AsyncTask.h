@@ -51,6 +51,14 @@ namespace dawn::native {
 // task if we need it for synchronous pipeline compilation.
 using AsyncTask = std::function<void()>;
 
+// Calls |task| with each index in [0, taskCount) and returns once all the calls are complete. The
+// calls are spread over the calling thread and up to taskCount - 1 tasks posted to
+// |workerTaskPool|. The calling thread makes the calls that no worker has picked up yet, so it
+// never waits for a task that isn't running, and this can be used from a worker task too.
+void RunTasksInParallel(dawn::platform::WorkerTaskPool* workerTaskPool,
+                        size_t taskCount,
+                        const std::function<void(size_t)>& task);
+
 class AsyncTaskManager {
   public:
     explicit AsyncTaskManager(dawn::platform::WorkerTaskPool* workerTaskPool);
@@ -28,6 +28,8 @@
 #include "dawn/native/BlobCache.h"
 
 #include <algorithm>
+#include <cstring>
+#include <utility>
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Version_autogen.h"
@@ -40,14 +42,58 @@ namespace dawn::native {
 BlobCache::BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc)
     : mLoadFunction(desc.loadDataFunction),
       mStoreFunction(desc.storeDataFunction),
-      mFunctionUserdata(desc.functionUserdata) {}
+      mFunctionUserdata(desc.functionUserdata) {
+    if (mLoadFunction == nullptr && mStoreFunction == nullptr && desc.cacheDirectory != nullptr) {
+        mFileCache = FileBlobCache::Open(desc.cacheDirectory, desc.cacheDirectoryMaxSize);
+        if (mFileCache != nullptr) {
+            mLoadFunction = &FileBlobCache::LoadData;
+            mStoreFunction = &FileBlobCache::StoreData;
+            mFunctionUserdata = mFileCache.get();
+        }
+    }
+    if (desc.memoryCacheSize > 0) {
+        mMemoryCache = std::make_unique<MemoryBlobCache>(desc.memoryCacheSize);
+    }
+}
+
+BlobCache::~BlobCache() = default;
 
 Blob BlobCache::Load(const CacheKey& key) {
-    std::lock_guard<std::mutex> lock(mMutex);
-    return LoadInternal(key);
+    if (mMemoryCache == nullptr) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return LoadInternal(key);
+    }
+
+    DAWN_ASSERT(ValidateCacheKey(key));
+    Blob result = mMemoryCache->Load(key);
+    if (!result.Empty()) {
+        return result;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        result = LoadInternal(key);
+    }
+    if (result.Empty()) {
+        return result;
+    }
+    // Keep the loaded blob in memory so that the next loads don't call the load function again.
+    return mMemoryCache->Store(key, std::move(result));
 }
 
 void BlobCache::Store(const CacheKey& key, size_t valueSize, const void* value) {
+    if (mMemoryCache != nullptr) {
+        DAWN_ASSERT(value != nullptr);
+        DAWN_ASSERT(valueSize > 0);
+        Blob blob = CreateBlob(valueSize);
+        memcpy(blob.Data(), value, valueSize);
+        blob = mMemoryCache->Store(key, std::move(blob));
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        StoreInternal(key, blob.Size(), blob.Data());
+        return;
+    }
+
     std::lock_guard<std::mutex> lock(mMutex);
     StoreInternal(key, valueSize, value);
 }
@@ -68,7 +114,11 @@ Blob BlobCache::LoadInternal(const CacheKey& key) {
         Blob result = CreateBlob(expectedSize);
         const size_t actualSize =
             mLoadFunction(key.data(), key.size(), result.Data(), expectedSize, mFunctionUserdata);
-        DAWN_ASSERT(expectedSize == actualSize);
+        // The entry may have been evicted or replaced between the two calls if the cache is shared
+        // with other devices or processes, which is handled as a miss.
+        if (actualSize != expectedSize) {
+            return Blob();
+        }
         return result;
     }
     return Blob();
@@ -84,6 +134,10 @@ void BlobCache::StoreInternal(const CacheKey& key, size_t valueSize, const void*
     mStoreFunction(key.data(), key.size(), value, valueSize, mFunctionUserdata);
 }
 
+const MemoryBlobCache* BlobCache::GetMemoryCache() const {
+    return mMemoryCache.get();
+}
+
 bool BlobCache::ValidateCacheKey(const CacheKey& key) {
     return std::search(key.begin(), key.end(), kDawnVersion.begin(), kDawnVersion.end()) !=
            key.end();
@@ -28,11 +28,14 @@
 #ifndef SRC_DAWN_NATIVE_BLOBCACHE_H_
 #define SRC_DAWN_NATIVE_BLOBCACHE_H_
 
+#include <memory>
 #include <mutex>
 
 #include "dawn/common/Platform.h"
 #include "dawn/native/Blob.h"
 #include "dawn/native/CacheResult.h"
+#include "dawn/native/FileBlobCache.h"
+#include "dawn/native/MemoryBlobCache.h"
 #include "partition_alloc/pointers/raw_ptr_exclusion.h"
 
 namespace dawn::platform {
@@ -45,9 +48,15 @@ class CacheKey;
 class InstanceBase;
 
 // This class should always be thread-safe because it may be called asynchronously.
+// When DawnCacheDeviceDescriptor::memoryCacheSize is non-zero, blobs are also kept in an
+// in-memory LRU tier that is looked up before calling the load function. Blobs returned from that
+// tier share their data with the cache and must not be modified.
+// When DawnCacheDeviceDescriptor::cacheDirectory is set and no load and store functions are given,
+// blobs are persisted in a FileBlobCache in that directory.
 class BlobCache {
   public:
     explicit BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc);
+    ~BlobCache();
 
     // Returns empty blob if the key is not found in the cache.
     Blob Load(const CacheKey& key);
@@ -65,6 +74,9 @@ class BlobCache {
         }
     }
 
+    // Returns nullptr if the in-memory tier is disabled.
+    const MemoryBlobCache* GetMemoryCache() const;
+
   private:
     // Non-thread safe internal implementations of load and store. Exposed callers that use
     // these helpers need to make sure that these are entered with `mMutex` held.
@@ -81,6 +93,11 @@ class BlobCache {
     RAW_PTR_EXCLUSION WGPUDawnLoadCacheDataFunction mLoadFunction;
     RAW_PTR_EXCLUSION WGPUDawnStoreCacheDataFunction mStoreFunction;
     RAW_PTR_EXCLUSION void* mFunctionUserdata;
+
+    std::shared_ptr<FileBlobCache> mFileCache;
+
+    // The in-memory tier has its own locking and isn't protected by `mMutex`.
+    std::unique_ptr<MemoryBlobCache> mMemoryCache;
 };
 
 }  // namespace dawn::native
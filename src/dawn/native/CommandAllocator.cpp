@@ -30,6 +30,8 @@
 #include <algorithm>
 #include <climits>
 #include <cstdlib>
+#include <limits>
+#include <new>
 #include <utility>
 
 #include "dawn/common/Assert.h"
@@ -122,6 +124,100 @@ bool CommandIterator::IsEmpty() const {
     return mBlocks.empty();
 }
 
+// CommandBlockDeleter
+
+void CommandBlockDeleter::operator()(char* block) const {
+    if (pool != nullptr) {
+        pool->ReleaseBlock(block, size);
+    } else {
+        delete[] block;
+    }
+}
+
+// CommandBlockPool
+
+namespace {
+
+// Returns the index of the size class of blocks of `size` bytes, or kSizeClassCount if they
+// aren't pooled.
+size_t GetSizeClass(size_t size) {
+    if (size <= CommandBlockPool::kMinBlockSize) {
+        return 0;
+    }
+    if (size > CommandBlockPool::kMaxBlockSize) {
+        return std::numeric_limits<size_t>::max();
+    }
+    return Log2Ceil(uint64_t(size)) - ConstexprLog2(CommandBlockPool::kMinBlockSize);
+}
+
+}  // anonymous namespace
+
+CommandBlockPool::CommandBlockPool() = default;
+
+CommandBlockPool::~CommandBlockPool() = default;
+
+CommandBlock CommandBlockPool::Allocate(size_t minimumSize, size_t* allocatedSize) {
+    mAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    size_t sizeClass = GetSizeClass(minimumSize);
+    if (sizeClass >= kSizeClassCount) {
+        // Blocks that are too large are allocated directly and freed when released.
+        *allocatedSize = minimumSize;
+        return CommandBlock(new (std::nothrow) char[minimumSize],
+                            CommandBlockDeleter{this, minimumSize});
+    }
+
+    size_t size = kMinBlockSize << sizeClass;
+    std::unique_ptr<char[]> block = mFreeBlocks[sizeClass].Use([](auto freeBlocks) {
+        std::unique_ptr<char[]> block;
+        if (!freeBlocks->empty()) {
+            block = std::move(freeBlocks->back());
+            freeBlocks->pop_back();
+        }
+        return block;
+    });
+
+    if (block != nullptr) {
+        mReuseCount.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        block.reset(new (std::nothrow) char[size]);
+        if (DAWN_UNLIKELY(block == nullptr)) {
+            return nullptr;
+        }
+    }
+
+    *allocatedSize = size;
+    return CommandBlock(block.release(), CommandBlockDeleter{this, size});
+}
+
+CommandBlockPool::Stats CommandBlockPool::GetStats() const {
+    Stats stats;
+    stats.allocationCount = mAllocationCount.load(std::memory_order_relaxed);
+    stats.reuseCount = mReuseCount.load(std::memory_order_relaxed);
+    stats.releaseCount = mReleaseCount.load(std::memory_order_relaxed);
+    stats.freeCount = mFreeCount.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void CommandBlockPool::ReleaseBlock(char* block, size_t size) {
+    mReleaseCount.fetch_add(1, std::memory_order_relaxed);
+
+    std::unique_ptr<char[]> ownedBlock(block);
+    size_t sizeClass = GetSizeClass(size);
+    if (sizeClass < kSizeClassCount) {
+        DAWN_ASSERT(size == kMinBlockSize << sizeClass);
+        mFreeBlocks[sizeClass].Use([&](auto freeBlocks) {
+            if (freeBlocks->size() < kMaxFreeBlocksPerSizeClass) {
+                freeBlocks->push_back(std::move(ownedBlock));
+            }
+        });
+    }
+
+    if (ownedBlock != nullptr) {
+        mFreeCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
 // Potential TODO(crbug.com/dawn/835):
 //  - Host the size and pointer to next block in the block itself to avoid having an allocation
 //    in the vector
@@ -136,12 +232,18 @@ CommandAllocator::CommandAllocator() {
     ResetPointers();
 }
 
+CommandAllocator::CommandAllocator(CommandBlockPool* pool) : mPool(pool) {
+    ResetPointers();
+}
+
 CommandAllocator::~CommandAllocator() {
     Reset();
 }
 
 CommandAllocator::CommandAllocator(CommandAllocator&& other)
-    : mBlocks(std::move(other.mBlocks)), mLastAllocationSize(other.mLastAllocationSize) {
+    : mBlocks(std::move(other.mBlocks)),
+      mLastAllocationSize(other.mLastAllocationSize),
+      mPool(other.mPool) {
     other.mBlocks.clear();
     if (!other.IsEmpty()) {
         mCurrentPtr = other.mCurrentPtr;
@@ -154,6 +256,7 @@ CommandAllocator::CommandAllocator(CommandAllocator&& other)
 
 CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
     Reset();
+    mPool = other.mPool;
     if (!other.IsEmpty()) {
         std::swap(mBlocks, other.mBlocks);
         mLastAllocationSize = other.mLastAllocationSize;
@@ -210,9 +313,15 @@ char* CommandAllocator::AllocateInNewBlock(uint32_t commandId,
 
 bool CommandAllocator::GetNewBlock(size_t minimumSize) {
     // Allocate blocks doubling sizes each time, to a maximum of 16k (or at least minimumSize).
-    mLastAllocationSize = std::max(minimumSize, std::min(mLastAllocationSize * 2, size_t(16384)));
+    mLastAllocationSize = std::max(
+        minimumSize, std::min(mLastAllocationSize * 2, CommandBlockPool::kMaxBlockSize));
 
-    auto block = std::unique_ptr<char[]>(new (std::nothrow) char[mLastAllocationSize]);
+    CommandBlock block;
+    if (mPool != nullptr) {
+        block = mPool->Allocate(mLastAllocationSize, &mLastAllocationSize);
+    } else {
+        block = CommandBlock(new (std::nothrow) char[mLastAllocationSize]);
+    }
     if (DAWN_UNLIKELY(block == nullptr)) {
         return false;
     }
@@ -28,6 +28,8 @@
 #ifndef SRC_DAWN_NATIVE_COMMANDALLOCATOR_H_
 #define SRC_DAWN_NATIVE_COMMANDALLOCATOR_H_
 
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -36,7 +38,10 @@
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Math.h"
+#include "dawn/common/MutexProtected.h"
 #include "dawn/common/NonCopyable.h"
+#include "dawn/common/Ref.h"
+#include "dawn/common/RefCounted.h"
 #include "partition_alloc/pointers/raw_ptr_exclusion.h"
 
 namespace dawn::native {
@@ -68,14 +73,75 @@ namespace dawn::native {
 // and must tell the CommandIterator when the allocated commands have been processed for
 // deletion.
 
+class CommandBlockPool;
+
+// Returns command blocks to the CommandBlockPool they come from, or frees them if they aren't
+// pooled.
+struct CommandBlockDeleter {
+    void operator()(char* block) const;
+
+    Ref<CommandBlockPool> pool;
+    size_t size = 0;
+};
+using CommandBlock = std::unique_ptr<char[], CommandBlockDeleter>;
+
 // These are the lists of blocks, should not be used directly, only through CommandAllocator
 // and CommandIterator
 struct BlockDef {
     size_t size;
-    std::unique_ptr<char[]> block;
+    CommandBlock block;
 };
 using CommandBlocks = std::vector<BlockDef>;
 
+// A pool of command blocks shared by all the CommandAllocators of a device. The blocks of the
+// commands of a command buffer are returned to the pool when the command buffer is destroyed,
+// so that encoding the next frame reuses them instead of allocating again. Blocks are sorted in
+// power of two size classes, from kMinBlockSize to kMaxBlockSize, which are the sizes that the
+// CommandAllocator requests. Larger blocks aren't pooled.
+class CommandBlockPool : public RefCounted {
+  public:
+    static constexpr size_t kMinBlockSize = 4096;
+    static constexpr size_t kMaxBlockSize = 16384;
+    // The maximum number of free blocks kept in each size class.
+    static constexpr size_t kMaxFreeBlocksPerSizeClass = 64;
+
+    struct Stats {
+        // The number of blocks requested, and how many of them reused a pooled block.
+        uint64_t allocationCount = 0;
+        uint64_t reuseCount = 0;
+        // The number of blocks returned to the pool, and how many of them were freed because
+        // their size class was full or they were too large.
+        uint64_t releaseCount = 0;
+        uint64_t freeCount = 0;
+    };
+
+    CommandBlockPool();
+
+    // Returns a block of at least minimumSize bytes. The actual size is returned in allocatedSize.
+    // Thread-safe.
+    CommandBlock Allocate(size_t minimumSize, size_t* allocatedSize);
+
+    Stats GetStats() const;
+
+  private:
+    friend CommandBlockDeleter;
+
+    static constexpr size_t kSizeClassCount = 3;
+    static_assert(kMinBlockSize << (kSizeClassCount - 1) == kMaxBlockSize);
+
+    ~CommandBlockPool() override;
+
+    void ReleaseBlock(char* block, size_t size);
+
+    std::array<MutexProtected<std::vector<std::unique_ptr<char[]>>>, kSizeClassCount>
+        mFreeBlocks;
+
+    std::atomic<uint64_t> mAllocationCount = 0;
+    std::atomic<uint64_t> mReuseCount = 0;
+    std::atomic<uint64_t> mReleaseCount = 0;
+    std::atomic<uint64_t> mFreeCount = 0;
+};
+
 namespace detail {
 constexpr uint32_t kEndOfBlock = std::numeric_limits<uint32_t>::max();
 constexpr uint32_t kAdditionalData = std::numeric_limits<uint32_t>::max() - 1;
@@ -168,13 +234,16 @@ class CommandIterator : public NonCopyable {
 class CommandAllocator : public NonCopyable {
   public:
     CommandAllocator();
+    // Allocates the blocks from the pool instead of the heap when it isn't null.
+    explicit CommandAllocator(CommandBlockPool* pool);
     ~CommandAllocator();
 
-    // NOTE: A moved-from CommandAllocator is reset to its initial empty state.
+    // NOTE: A moved-from CommandAllocator is reset to its initial empty state, and keeps its pool.
     CommandAllocator(CommandAllocator&&);
     CommandAllocator& operator=(CommandAllocator&&);
 
-    // Frees all blocks held by the allocator and restores it to its initial empty state.
+    // Frees all blocks held by the allocator and restores it to its initial empty state. The pool of
+    // the allocator is kept.
     void Reset();
 
     bool IsEmpty() const;
@@ -272,6 +341,7 @@ class CommandAllocator : public NonCopyable {
 
     CommandBlocks mBlocks;
     size_t mLastAllocationSize = kDefaultBaseAllocationSize;
+    Ref<CommandBlockPool> mPool;
 
     // Data used for the block range at initialization so that the first call to Allocate sees
     // there is not enough space and calls GetNewBlock. This avoids having to special case the
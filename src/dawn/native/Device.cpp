@@ -45,6 +45,7 @@
 #include "dawn/native/BlobCache.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/ChainUtils.h"
+#include "dawn/native/CommandAllocator.h"
 #include "dawn/native/CommandBuffer.h"
 #include "dawn/native/CommandEncoder.h"
 #include "dawn/native/CompilationMessages.h"
@@ -387,7 +388,8 @@ DeviceBase::DeviceBase(AdapterBase* adapter,
     }
 
     if (cacheDesc.loadDataFunction == nullptr && cacheDesc.storeDataFunction == nullptr &&
-        cacheDesc.functionUserdata == nullptr && GetPlatform()->GetCachingInterface() != nullptr) {
+        cacheDesc.functionUserdata == nullptr && cacheDesc.cacheDirectory == nullptr &&
+        GetPlatform()->GetCachingInterface() != nullptr) {
         // Populate cache functions and userdata from legacy cachingInterface.
         cacheDesc.loadDataFunction = [](const void* key, size_t keySize, void* value,
                                         size_t valueSize, void* userdata) {
@@ -414,6 +416,8 @@ DeviceBase::DeviceBase(AdapterBase* adapter,
         cacheDesc.loadDataFunction = nullptr;
         cacheDesc.storeDataFunction = nullptr;
         cacheDesc.functionUserdata = nullptr;
+        cacheDesc.memoryCacheSize = 0;
+        cacheDesc.cacheDirectory = nullptr;
     }
     mBlobCache = std::make_unique<BlobCache>(cacheDesc);
 
@@ -468,6 +472,7 @@ MaybeError DeviceBase::Initialize(Ref<QueueBase> defaultQueue) {
     mCaches = std::make_unique<DeviceBase::Caches>();
     mErrorScopeStack = std::make_unique<ErrorScopeStack>();
     mDynamicUploader = std::make_unique<DynamicUploader>(this);
+    mCommandBlockPool = AcquireRef(new CommandBlockPool());
     mCallbackTaskManager = AcquireRef(new CallbackTaskManager());
     mInternalPipelineStore = std::make_unique<InternalPipelineStore>(this);
 
@@ -2425,6 +2430,10 @@ DynamicUploader* DeviceBase::GetDynamicUploader() const {
     return mDynamicUploader.get();
 }
 
+CommandBlockPool* DeviceBase::GetCommandBlockPool() const {
+    return mCommandBlockPool.Get();
+}
+
 // The Toggle device facility
 
 std::vector<const char*> DeviceBase::GetTogglesUsed() const {
@@ -2589,6 +2598,19 @@ void DeviceBase::DumpMemoryStatistics(dawn::native::MemoryDump* dump) const {
     GetObjectTrackingList(ObjectType::Buffer)->ForEach([&](const ApiObjectBase* buffer) {
         static_cast<const BufferBase*>(buffer)->DumpMemoryStatistics(dump, prefix.c_str());
     });
+
+    if (const MemoryBlobCache* memoryCache = GetBlobCache()->GetMemoryCache()) {
+        MemoryBlobCache::Stats stats = memoryCache->GetStats();
+        std::string name = absl::StrFormat("%s/blob_cache", prefix);
+        dump->AddScalar(name.c_str(), MemoryDump::kNameSize, MemoryDump::kUnitsBytes,
+                        stats.sizeInBytes);
+        dump->AddScalar(name.c_str(), MemoryDump::kNameObjectCount, MemoryDump::kUnitsObjects,
+                        stats.entryCount);
+        dump->AddScalar(name.c_str(), "hit_count", MemoryDump::kUnitsObjects, stats.hitCount);
+        dump->AddScalar(name.c_str(), "miss_count", MemoryDump::kUnitsObjects, stats.missCount);
+        dump->AddScalar(name.c_str(), "eviction_count", MemoryDump::kUnitsObjects,
+                        stats.evictionCount);
+    }
 }
 
 ResultOrError<Ref<BufferBase>> DeviceBase::GetOrCreateTemporaryUniformBuffer(size_t size) {
@@ -72,6 +72,7 @@ class AttachmentStateBlueprint;
 class Blob;
 class BlobCache;
 class CallbackTaskManager;
+class CommandBlockPool;
 class DynamicUploader;
 class ErrorScopeStack;
 class SharedTextureMemory;
@@ -330,6 +331,8 @@ class DeviceBase : public ErrorSink, public RefCountedWithExternalCount {
                                         const Extent3D& copySizePixels);
 
     DynamicUploader* GetDynamicUploader() const;
+    // The pool of blocks used by the CommandAllocators of the encoders of this device.
+    CommandBlockPool* GetCommandBlockPool() const;
 
     // The device state which is a combination of creation state and loss state.
     //
@@ -569,6 +572,7 @@ class DeviceBase : public ErrorSink, public RefCountedWithExternalCount {
     Ref<TextureViewBase> mExternalTexturePlaceholderView;
 
     std::unique_ptr<DynamicUploader> mDynamicUploader;
+    Ref<CommandBlockPool> mCommandBlockPool;
     Ref<QueueBase> mQueue;
 
     std::atomic<uint32_t> mEmittedCompilationLogCount = 0;
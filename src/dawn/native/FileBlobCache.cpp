@@ -0,0 +1,510 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/native/FileBlobCache.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Log.h"
+#include "dawn/common/Platform.h"
+#include "dawn/common/SystemUtils.h"
+
+#if DAWN_PLATFORM_IS(WINDOWS)
+#include "dawn/common/windows_with_undefs.h"
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+namespace dawn::native {
+
+namespace {
+
+constexpr uint32_t kPackMagic = 0x4b504244;    // "DBPK"
+constexpr uint32_t kRecordMagic = 0x43524244;  // "DBRC"
+constexpr uint32_t kIndexMagic = 0x58494244;   // "DBIX"
+constexpr uint32_t kVersion = 1;
+
+struct PackHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t generation;
+};
+
+struct RecordHeader {
+    uint32_t magic;
+    uint32_t keySize;
+    uint32_t valueSize;
+    uint32_t padding;
+    // Checksum of the key and value.
+    uint64_t checksum;
+};
+
+struct IndexHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t packGeneration;
+    // The size of the pack file covered by the index.
+    uint64_t packSize;
+    uint64_t nextUse;
+    uint64_t entryCount;
+};
+
+struct IndexEntry {
+    uint64_t keyHash;
+    uint64_t offset;
+    uint32_t keySize;
+    uint32_t valueSize;
+    uint64_t lastUse;
+};
+
+// 64-bit FNV-1a. The hashes are persisted so they must be stable across runs, unlike absl::Hash.
+constexpr uint64_t kHashSeed = 0xcbf29ce484222325ull;
+uint64_t Hash(const void* data, size_t size, uint64_t hash = kHashSeed) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+uint64_t RecordSize(uint32_t keySize, uint32_t valueSize) {
+    return sizeof(RecordHeader) + uint64_t(keySize) + uint64_t(valueSize);
+}
+
+bool Seek(FILE* file, uint64_t offset) {
+#if DAWN_PLATFORM_IS(WINDOWS)
+    return _fseeki64(file, static_cast<int64_t>(offset), SEEK_SET) == 0;
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+uint64_t GetFileLength(FILE* file) {
+#if DAWN_PLATFORM_IS(WINDOWS)
+    if (_fseeki64(file, 0, SEEK_END) != 0) {
+        return 0;
+    }
+    int64_t size = _ftelli64(file);
+#else
+    if (fseeko(file, 0, SEEK_END) != 0) {
+        return 0;
+    }
+    int64_t size = ftello(file);
+#endif
+    return size < 0 ? 0 : static_cast<uint64_t>(size);
+}
+
+bool ReadAt(FILE* file, uint64_t offset, void* data, size_t size) {
+    return Seek(file, offset) && fread(data, 1, size, file) == size;
+}
+
+bool MakeDirectory(const std::string& path) {
+#if DAWN_PLATFORM_IS(WINDOWS)
+    return CreateDirectoryA(path.c_str(), nullptr) || GetLastError() == ERROR_ALREADY_EXISTS;
+#else
+    return mkdir(path.c_str(), 0700) == 0 || errno == EEXIST;
+#endif
+}
+
+// Replaces |to| with |from|, atomically where the platform supports it.
+bool RenameFile(const std::string& from, const std::string& to) {
+#if DAWN_PLATFORM_IS(WINDOWS)
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING);
+#else
+    return rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+}  // anonymous namespace
+
+// static
+std::shared_ptr<FileBlobCache> FileBlobCache::Open(const std::string& directory,
+                                                   uint64_t maxSize) {
+    static std::mutex openCachesMutex;
+    using OpenCacheMap = absl::flat_hash_map<std::string, std::weak_ptr<FileBlobCache>>;
+    static auto* openCaches = new OpenCacheMap();
+
+    std::lock_guard<std::mutex> lock(openCachesMutex);
+    std::weak_ptr<FileBlobCache>& openCache = (*openCaches)[directory];
+    if (std::shared_ptr<FileBlobCache> cache = openCache.lock()) {
+        return cache;
+    }
+
+    if (directory.empty() || !MakeDirectory(directory)) {
+        dawn::WarningLog() << "Couldn't create the blob cache directory " << directory;
+        return nullptr;
+    }
+
+    std::string prefix = directory + GetPathSeparator() + "dawn_blob_cache";
+    std::shared_ptr<FileBlobCache> cache(new FileBlobCache(
+        prefix + ".index", prefix + ".pack", maxSize == 0 ? kDefaultMaxSize : maxSize));
+    if (!cache->Initialize()) {
+        dawn::WarningLog() << "Couldn't open the blob cache in " << directory;
+        return nullptr;
+    }
+    openCache = cache;
+    return cache;
+}
+
+FileBlobCache::FileBlobCache(std::string indexPath, std::string packPath, uint64_t maxSize)
+    : mIndexPath(std::move(indexPath)), mPackPath(std::move(packPath)), mMaxSize(maxSize) {}
+
+FileBlobCache::~FileBlobCache() {
+    if (mPack != nullptr) {
+        WriteIndex();
+        fclose(mPack);
+    }
+}
+
+// static
+size_t FileBlobCache::LoadData(const void* key,
+                               size_t keySize,
+                               void* value,
+                               size_t valueSize,
+                               void* userdata) {
+    return static_cast<FileBlobCache*>(userdata)->Load(key, keySize, value, valueSize);
+}
+
+// static
+void FileBlobCache::StoreData(const void* key,
+                              size_t keySize,
+                              const void* value,
+                              size_t valueSize,
+                              void* userdata) {
+    static_cast<FileBlobCache*>(userdata)->Store(key, keySize, value, valueSize);
+}
+
+bool FileBlobCache::Initialize() {
+    mPack = fopen(mPackPath.c_str(), "r+b");
+    if (mPack == nullptr) {
+        return CreatePack(0);
+    }
+
+    PackHeader header;
+    if (!ReadAt(mPack, 0, &header, sizeof(header)) || header.magic != kPackMagic ||
+        header.version != kVersion) {
+        fclose(mPack);
+        mPack = nullptr;
+        return CreatePack(0);
+    }
+    mPackGeneration = header.generation;
+    mPackSize = sizeof(PackHeader);
+
+    // Records appended after the index was last written are recovered from the pack file. If the
+    // index is missing or corrupted, it is rebuilt from the whole pack file.
+    if (!ReadIndex()) {
+        mEntries.clear();
+        mNextUse = 0;
+        mPackSize = sizeof(PackHeader);
+    }
+    if (!ScanPack(mPackSize) || mPackSize > mMaxSize) {
+        // Compaction drops the corrupted tail of the pack file so that new records are appended
+        // after valid ones.
+        return Compact(mMaxSize / 4 * 3);
+    }
+    return true;
+}
+
+bool FileBlobCache::CreatePack(uint64_t generation) {
+    DAWN_ASSERT(mPack == nullptr);
+    mPack = fopen(mPackPath.c_str(), "w+b");
+    if (mPack == nullptr) {
+        return false;
+    }
+    PackHeader header = {kPackMagic, kVersion, generation};
+    if (fwrite(&header, sizeof(header), 1, mPack) != 1 || fflush(mPack) != 0) {
+        Disable();
+        return false;
+    }
+    mPackGeneration = generation;
+    mPackSize = sizeof(PackHeader);
+    mEntries.clear();
+    // Replace any index of a previous pack file.
+    WriteIndex();
+    return true;
+}
+
+bool FileBlobCache::ReadIndex() {
+    FILE* file = fopen(mIndexPath.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    bool valid = false;
+    IndexHeader header;
+    uint64_t packFileSize = GetFileLength(mPack);
+    if (ReadAt(file, 0, &header, sizeof(header)) && header.magic == kIndexMagic &&
+        header.version == kVersion && header.packGeneration == mPackGeneration &&
+        header.packSize >= sizeof(PackHeader) && header.packSize <= packFileSize &&
+        header.entryCount <= (header.packSize - sizeof(PackHeader)) / sizeof(RecordHeader)) {
+        std::vector<IndexEntry> entries(header.entryCount);
+        uint64_t checksum = 0;
+        size_t entriesSize = entries.size() * sizeof(IndexEntry);
+        if (fread(entries.data(), 1, entriesSize, file) == entriesSize &&
+            fread(&checksum, sizeof(checksum), 1, file) == 1 &&
+            checksum == Hash(entries.data(), entriesSize, Hash(&header, sizeof(header)))) {
+            valid = true;
+            mEntries.reserve(entries.size());
+            for (const IndexEntry& entry : entries) {
+                if (entry.offset < sizeof(PackHeader) ||
+                    entry.offset + RecordSize(entry.keySize, entry.valueSize) > header.packSize) {
+                    valid = false;
+                    break;
+                }
+                mEntries[entry.keyHash] =
+                    Entry{entry.offset, entry.keySize, entry.valueSize, entry.lastUse};
+            }
+            mPackSize = header.packSize;
+            mNextUse = header.nextUse;
+        }
+    }
+    fclose(file);
+    return valid;
+}
+
+bool FileBlobCache::WriteIndex() {
+    IndexHeader header = {kIndexMagic, kVersion, mPackGeneration,
+                          mPackSize,   mNextUse, mEntries.size()};
+    std::vector<IndexEntry> entries;
+    entries.reserve(mEntries.size());
+    for (const auto& [keyHash, entry] : mEntries) {
+        entries.push_back({keyHash, entry.offset, entry.keySize, entry.valueSize, entry.lastUse});
+    }
+    size_t entriesSize = entries.size() * sizeof(IndexEntry);
+    uint64_t checksum = Hash(entries.data(), entriesSize, Hash(&header, sizeof(header)));
+
+    // Write to a temporary file that replaces the index so that it is never seen partially
+    // written.
+    std::string tmpPath = mIndexPath + ".tmp";
+    FILE* file = fopen(tmpPath.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   fwrite(entries.data(), 1, entriesSize, file) == entriesSize &&
+                   fwrite(&checksum, sizeof(checksum), 1, file) == 1;
+    success = fclose(file) == 0 && success;
+    if (!success || !RenameFile(tmpPath, mIndexPath)) {
+        remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool FileBlobCache::ScanPack(uint64_t offset) {
+    uint64_t fileSize = GetFileLength(mPack);
+    std::vector<uint8_t> record;
+    while (offset < fileSize) {
+        RecordHeader header;
+        if (!ReadAt(mPack, offset, &header, sizeof(header)) || header.magic != kRecordMagic ||
+            offset + RecordSize(header.keySize, header.valueSize) > fileSize) {
+            return false;
+        }
+        Entry entry = {offset, header.keySize, header.valueSize, 0};
+        if (!ReadRecord(entry, nullptr, &record)) {
+            return false;
+        }
+        entry.lastUse = ++mNextUse;
+        mEntries[Hash(record.data() + sizeof(RecordHeader), header.keySize)] = entry;
+        offset += record.size();
+        mPackSize = offset;
+    }
+    return true;
+}
+
+bool FileBlobCache::ReadRecord(const Entry& expected,
+                               const void* key,
+                               std::vector<uint8_t>* record) {
+    record->resize(RecordSize(expected.keySize, expected.valueSize));
+    if (!ReadAt(mPack, expected.offset, record->data(), record->size())) {
+        return false;
+    }
+
+    RecordHeader header;
+    memcpy(&header, record->data(), sizeof(header));
+    const uint8_t* recordKey = record->data() + sizeof(RecordHeader);
+    return header.magic == kRecordMagic && header.keySize == expected.keySize &&
+           header.valueSize == expected.valueSize &&
+           header.checksum == Hash(recordKey, record->size() - sizeof(RecordHeader)) &&
+           (key == nullptr || memcmp(recordKey, key, header.keySize) == 0);
+}
+
+size_t FileBlobCache::Load(const void* key, size_t keySize, void* value, size_t valueSize) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mPack == nullptr) {
+        return 0;
+    }
+
+    uint64_t keyHash = Hash(key, keySize);
+    auto it = mEntries.find(keyHash);
+    if (it == mEntries.end() || it->second.keySize != keySize) {
+        return 0;
+    }
+    Entry& entry = it->second;
+
+    // BlobCache first queries the size of the value and then loads it. The whole record is read
+    // and validated on the first call so that a corrupted record is reported as a miss before
+    // the caller allocates its storage.
+    if (value == nullptr || mPendingLoadHash != keyHash ||
+        mPendingLoadValue.size() != entry.valueSize) {
+        std::vector<uint8_t> record;
+        if (!ReadRecord(entry, key, &record)) {
+            mEntries.erase(it);
+            mPendingLoadValue.clear();
+            return 0;
+        }
+        mPendingLoadHash = keyHash;
+        mPendingLoadValue.assign(record.begin() + sizeof(RecordHeader) + keySize, record.end());
+    }
+    entry.lastUse = ++mNextUse;
+
+    if (value == nullptr) {
+        return entry.valueSize;
+    }
+    if (valueSize != entry.valueSize) {
+        return 0;
+    }
+    memcpy(value, mPendingLoadValue.data(), valueSize);
+    mPendingLoadValue.clear();
+    return valueSize;
+}
+
+void FileBlobCache::Store(const void* key, size_t keySize, const void* value, size_t valueSize) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    // Values that would take a large part of the cache aren't stored.
+    if (mPack == nullptr || keySize > UINT32_MAX || valueSize > UINT32_MAX ||
+        keySize + valueSize > mMaxSize / 2) {
+        return;
+    }
+
+    RecordHeader header = {kRecordMagic, static_cast<uint32_t>(keySize),
+                           static_cast<uint32_t>(valueSize), 0,
+                           Hash(value, valueSize, Hash(key, keySize))};
+    if (!Seek(mPack, mPackSize) || fwrite(&header, sizeof(header), 1, mPack) != 1 ||
+        fwrite(key, 1, keySize, mPack) != keySize ||
+        fwrite(value, 1, valueSize, mPack) != valueSize || fflush(mPack) != 0) {
+        dawn::WarningLog() << "Couldn't write to the blob cache, disabling it.";
+        Disable();
+        return;
+    }
+
+    uint64_t keyHash = Hash(key, keySize);
+    mEntries[keyHash] = Entry{mPackSize, header.keySize, header.valueSize, ++mNextUse};
+    mPackSize += RecordSize(header.keySize, header.valueSize);
+    if (mPendingLoadHash == keyHash) {
+        mPendingLoadValue.clear();
+    }
+
+    if (mPackSize > mMaxSize && !Compact(mMaxSize / 4 * 3)) {
+        dawn::WarningLog() << "Couldn't compact the blob cache, disabling it.";
+    }
+}
+
+bool FileBlobCache::Compact(uint64_t targetSize) {
+    // Keep the most recently used entries that fit in |targetSize|.
+    std::vector<std::pair<uint64_t, Entry>> entries(mEntries.begin(), mEntries.end());
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.second.lastUse > b.second.lastUse;
+    });
+
+    std::string tmpPath = mPackPath + ".tmp";
+    FILE* file = fopen(tmpPath.c_str(), "wb");
+    if (file == nullptr) {
+        Disable();
+        return false;
+    }
+
+    uint64_t generation = mPackGeneration + 1;
+    PackHeader packHeader = {kPackMagic, kVersion, generation};
+    bool success = fwrite(&packHeader, sizeof(packHeader), 1, file) == 1;
+
+    absl::flat_hash_map<uint64_t, Entry> keptEntries;
+    uint64_t size = sizeof(PackHeader);
+    std::vector<uint8_t> record;
+    for (auto& [keyHash, entry] : entries) {
+        if (!success) {
+            break;
+        }
+        uint64_t recordSize = RecordSize(entry.keySize, entry.valueSize);
+        if (size + recordSize > targetSize) {
+            continue;
+        }
+        // Records that fail validation are dropped.
+        if (!ReadRecord(entry, nullptr, &record)) {
+            continue;
+        }
+        success = fwrite(record.data(), 1, record.size(), file) == record.size();
+        keptEntries[keyHash] = Entry{size, entry.keySize, entry.valueSize, entry.lastUse};
+        size += recordSize;
+    }
+    success = fclose(file) == 0 && success;
+
+    fclose(mPack);
+    mPack = nullptr;
+    if (!success || !RenameFile(tmpPath, mPackPath)) {
+        remove(tmpPath.c_str());
+        // Start over with an empty pack file rather than keep using one that can't be compacted.
+        return CreatePack(generation);
+    }
+
+    mPack = fopen(mPackPath.c_str(), "r+b");
+    if (mPack == nullptr) {
+        Disable();
+        return false;
+    }
+    mPackGeneration = generation;
+    mPackSize = size;
+    mEntries = std::move(keptEntries);
+    mPendingLoadValue.clear();
+    return WriteIndex();
+}
+
+void FileBlobCache::Disable() {
+    if (mPack != nullptr) {
+        fclose(mPack);
+        mPack = nullptr;
+    }
+    mEntries.clear();
+    mPendingLoadValue.clear();
+}
+
+uint64_t FileBlobCache::GetPackSizeForTesting() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mPackSize;
+}
+
+size_t FileBlobCache::GetEntryCountForTesting() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mEntries.size();
+}
+
+}  // namespace dawn::native
@@ -0,0 +1,128 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_NATIVE_FILEBLOBCACHE_H_
+#define SRC_DAWN_NATIVE_FILEBLOBCACHE_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+
+namespace dawn::native {
+
+// A persistent blob cache stored in a directory, used as the load and store functions of a
+// BlobCache when a DawnCacheDeviceDescriptor::cacheDirectory is given.
+//
+// Values are appended to a single pack file as self-validating records (header, key and value
+// with a checksum). An index of the records, keyed by a stable hash of the key, is kept in memory
+// and saved to an index file that is replaced atomically. The index is saved when the cache is
+// destroyed, and records appended after the last save are recovered by scanning the end of the
+// pack file, so a crash loses at most the records that were being written.
+//
+// When the pack file grows over the maximum size, it is compacted by rewriting the most recently
+// used entries to a new pack file that replaces the old one. Corrupted records, index or pack
+// files are treated as cache misses and are discarded. The devices of a process that use the same
+// directory share the same FileBlobCache, but the cache is not safe to use from multiple processes
+// at the same time.
+class FileBlobCache {
+  public:
+    static constexpr uint64_t kDefaultMaxSize = 256ull * 1024 * 1024;
+
+    // Opens the cache in |directory|, creating the directory and its files if needed, or returns
+    // the cache already open for it. Returns nullptr if the cache files can't be created.
+    static std::shared_ptr<FileBlobCache> Open(const std::string& directory, uint64_t maxSize);
+    ~FileBlobCache();
+
+    // Implementations of WGPUDawnLoadCacheDataFunction and WGPUDawnStoreCacheDataFunction where
+    // |userdata| is the FileBlobCache.
+    static size_t LoadData(const void* key,
+                           size_t keySize,
+                           void* value,
+                           size_t valueSize,
+                           void* userdata);
+    static void StoreData(const void* key,
+                          size_t keySize,
+                          const void* value,
+                          size_t valueSize,
+                          void* userdata);
+
+    size_t Load(const void* key, size_t keySize, void* value, size_t valueSize);
+    void Store(const void* key, size_t keySize, const void* value, size_t valueSize);
+
+    uint64_t GetPackSizeForTesting();
+    size_t GetEntryCountForTesting();
+
+  private:
+    struct Entry {
+        uint64_t offset;
+        uint32_t keySize;
+        uint32_t valueSize;
+        uint64_t lastUse;
+    };
+
+    FileBlobCache(std::string indexPath, std::string packPath, uint64_t maxSize);
+
+    bool Initialize();
+    bool CreatePack(uint64_t generation);
+    bool ReadIndex();
+    bool WriteIndex();
+    // Adds the records of the pack file starting at |offset| to the index. Returns false if a
+    // corrupted record was found.
+    bool ScanPack(uint64_t offset);
+    // Reads the record described by |expected| and validates it, and its key against |key| if it
+    // isn't nullptr. The whole record, including its header, is returned in |record|.
+    bool ReadRecord(const Entry& expected, const void* key, std::vector<uint8_t>* record);
+    // Rewrites the most recently used entries to a new pack file, up to |targetSize| bytes.
+    bool Compact(uint64_t targetSize);
+    void Disable();
+
+    const std::string mIndexPath;
+    const std::string mPackPath;
+    const uint64_t mMaxSize;
+
+    std::mutex mMutex;
+    FILE* mPack = nullptr;
+    uint64_t mPackGeneration = 0;
+    // The offset after the last valid record of the pack file.
+    uint64_t mPackSize = 0;
+    uint64_t mNextUse = 0;
+    absl::flat_hash_map<uint64_t, Entry> mEntries;
+
+    // The value read by the last Load() that only queried the size, which is usually followed by
+    // a Load() of the data for the same key.
+    uint64_t mPendingLoadHash = 0;
+    std::vector<uint8_t> mPendingLoadValue;
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_FILEBLOBCACHE_H_
@@ -0,0 +1,146 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/native/MemoryBlobCache.h"
+
+#include <utility>
+
+#include "absl/hash/hash.h"
+#include "dawn/common/Assert.h"
+#include "dawn/native/CacheKey.h"
+
+namespace dawn::native {
+
+MemoryBlobCache::SharedValue::SharedValue(Blob blob) : mBlob(std::move(blob)) {}
+
+MemoryBlobCache::SharedValue::~SharedValue() = default;
+
+Blob MemoryBlobCache::SharedValue::CreateView() {
+    // The view keeps a reference to the value that is released when the view is destroyed.
+    return Blob::UnsafeCreateWithDeleter(mBlob.Data(), mBlob.Size(),
+                                         [value = Ref<SharedValue>(this)] {});
+}
+
+size_t MemoryBlobCache::SharedValue::Size() const {
+    return mBlob.Size();
+}
+
+MemoryBlobCache::MemoryBlobCache(uint64_t maxSizeInBytes, size_t shardCount)
+    : mMaxSizeInBytes(maxSizeInBytes),
+      mMaxShardSizeInBytes(maxSizeInBytes / shardCount),
+      mShards(shardCount) {
+    DAWN_ASSERT(shardCount > 0);
+}
+
+MemoryBlobCache::~MemoryBlobCache() = default;
+
+// static
+std::string_view MemoryBlobCache::KeyView(const std::vector<uint8_t>& key) {
+    return std::string_view(reinterpret_cast<const char*>(key.data()), key.size());
+}
+
+MemoryBlobCache::Shard& MemoryBlobCache::GetShard(std::string_view key) {
+    return mShards[absl::Hash<std::string_view>()(key) % mShards.size()];
+}
+
+Blob MemoryBlobCache::Load(const CacheKey& key) {
+    std::string_view keyView = KeyView(key);
+    Shard& shard = GetShard(keyView);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(keyView);
+    if (it == shard.entries.end()) {
+        shard.missCount++;
+        return Blob();
+    }
+
+    // Move the entry to the front of the LRU list.
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    shard.hitCount++;
+    return it->second->value->CreateView();
+}
+
+Blob MemoryBlobCache::Store(const CacheKey& key, Blob value) {
+    DAWN_ASSERT(!value.Empty());
+
+    const uint64_t entrySize = key.size() + value.Size();
+    if (entrySize > mMaxShardSizeInBytes) {
+        return value;
+    }
+
+    std::string_view keyView = KeyView(key);
+    Shard& shard = GetShard(keyView);
+    Ref<SharedValue> sharedValue = AcquireRef(new SharedValue(std::move(value)));
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(keyView);
+    if (it != shard.entries.end()) {
+        // Replace the value of the existing entry.
+        Entry& entry = *it->second;
+        shard.sizeInBytes -= entry.value->Size();
+        entry.value = sharedValue;
+        shard.sizeInBytes += sharedValue->Size();
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        EvictUntilFits(&shard, 0);
+        return sharedValue->CreateView();
+    }
+
+    EvictUntilFits(&shard, entrySize);
+    shard.lru.push_front({std::vector<uint8_t>(key.begin(), key.end()), sharedValue});
+    shard.entries.emplace(KeyView(shard.lru.front().key), shard.lru.begin());
+    shard.sizeInBytes += entrySize;
+    return sharedValue->CreateView();
+}
+
+void MemoryBlobCache::EvictUntilFits(Shard* shard, uint64_t size) {
+    while (!shard->lru.empty() && shard->sizeInBytes + size > mMaxShardSizeInBytes) {
+        Entry& entry = shard->lru.back();
+        shard->sizeInBytes -= entry.key.size() + entry.value->Size();
+        shard->entries.erase(KeyView(entry.key));
+        shard->lru.pop_back();
+        shard->evictionCount++;
+    }
+}
+
+MemoryBlobCache::Stats MemoryBlobCache::GetStats() const {
+    Stats stats;
+    for (const Shard& shard : mShards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        stats.hitCount += shard.hitCount;
+        stats.missCount += shard.missCount;
+        stats.evictionCount += shard.evictionCount;
+        stats.entryCount += shard.lru.size();
+        stats.sizeInBytes += shard.sizeInBytes;
+    }
+    return stats;
+}
+
+uint64_t MemoryBlobCache::GetMaxSizeInBytes() const {
+    return mMaxSizeInBytes;
+}
+
+}  // namespace dawn::native
@@ -0,0 +1,124 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_NATIVE_MEMORYBLOBCACHE_H_
+#define SRC_DAWN_NATIVE_MEMORYBLOBCACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "dawn/common/Ref.h"
+#include "dawn/common/RefCounted.h"
+#include "dawn/native/Blob.h"
+
+namespace dawn::native {
+
+class CacheKey;
+
+// A size-bounded, in-memory LRU cache of blobs used as a first tier in front of the BlobCache's
+// load and store functions. Cached blobs are stored once and shared (without copies) by all the
+// Blobs returned by Load and Store, so callers must not modify the contents of these Blobs.
+//
+// To reduce contention when it is accessed concurrently, the cache is split into shards selected
+// by the hash of the key. Each shard has its own lock, LRU list and an equal share of the size
+// budget. This class is thread-safe.
+class MemoryBlobCache {
+  public:
+    struct Stats {
+        uint64_t hitCount = 0;
+        uint64_t missCount = 0;
+        uint64_t evictionCount = 0;
+        uint64_t entryCount = 0;
+        // The size of the cached keys and values.
+        uint64_t sizeInBytes = 0;
+    };
+
+    static constexpr size_t kDefaultShardCount = 16;
+
+    explicit MemoryBlobCache(uint64_t maxSizeInBytes, size_t shardCount = kDefaultShardCount);
+    ~MemoryBlobCache();
+
+    // Returns a blob sharing the cached value for |key|, or an empty blob if it isn't cached.
+    Blob Load(const CacheKey& key);
+
+    // Takes ownership of |value| and caches it for |key|, evicting the least recently used
+    // entries of the shard if needed. Returns a blob sharing the stored value. Values that are
+    // larger than the size budget of a shard aren't cached and are returned as is.
+    Blob Store(const CacheKey& key, Blob value);
+
+    Stats GetStats() const;
+    uint64_t GetMaxSizeInBytes() const;
+
+  private:
+    // The value of an entry, kept alive by the cache and by all the Blobs that share it.
+    class SharedValue : public RefCounted {
+      public:
+        explicit SharedValue(Blob blob);
+
+        Blob CreateView();
+        size_t Size() const;
+
+      private:
+        ~SharedValue() override;
+
+        Blob mBlob;
+    };
+
+    struct Entry {
+        std::vector<uint8_t> key;
+        Ref<SharedValue> value;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        // Entries ordered from the most to the least recently used.
+        std::list<Entry> lru;
+        // Maps the keys stored in the entries of |lru| to their entry.
+        absl::flat_hash_map<std::string_view, std::list<Entry>::iterator> entries;
+        uint64_t sizeInBytes = 0;
+
+        uint64_t hitCount = 0;
+        uint64_t missCount = 0;
+        uint64_t evictionCount = 0;
+    };
+
+    static std::string_view KeyView(const std::vector<uint8_t>& key);
+    Shard& GetShard(std::string_view key);
+    void EvictUntilFits(Shard* shard, uint64_t size);
+
+    const uint64_t mMaxSizeInBytes;
+    const uint64_t mMaxShardSizeInBytes;
+    std::vector<Shard> mShards;
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_MEMORYBLOBCACHE_H_
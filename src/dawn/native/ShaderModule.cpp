@@ -31,9 +31,11 @@
 #include <sstream>
 #include <utility>
 
+#include "absl/container/inlined_vector.h"
 #include "dawn/common/BitSetIterator.h"
 #include "dawn/common/Constants.h"
 #include "dawn/common/MatchVariant.h"
+#include "dawn/native/AsyncTask.h"
 #include "dawn/native/BindGroupLayoutInternal.h"
 #include "dawn/native/ChainUtils.h"
 #include "dawn/native/CompilationMessages.h"
@@ -1189,6 +1191,38 @@ ResultOrError<tint::Program> RunTransforms(tint::ast::transform::Manager* transf
     return std::move(result);
 }
 
+MaybeError CompileShaderStages(DeviceBase* device,
+                               wgpu::ShaderStage stages,
+                               const std::function<MaybeError(SingleShaderStage)>& compileStage) {
+    absl::InlinedVector<SingleShaderStage, kNumStages> stageList;
+    for (SingleShaderStage stage : IterateStages(stages)) {
+        stageList.push_back(stage);
+    }
+
+    if (stageList.size() <= 1 || !device->IsToggleEnabled(Toggle::ParallelShaderCompilation)) {
+        for (SingleShaderStage stage : stageList) {
+            DAWN_TRY(compileStage(stage));
+        }
+        return {};
+    }
+
+    // The transforms and backend writers of each stage only read the TintProgram of their
+    // shader module, and their results are stored in the thread-safe blob cache.
+    PerStage<std::unique_ptr<ErrorData>> errors;
+    RunTasksInParallel(device->GetWorkerTaskPool(), stageList.size(), [&](size_t i) {
+        MaybeError result = compileStage(stageList[i]);
+        if (result.IsError()) {
+            errors[stageList[i]] = result.AcquireError();
+        }
+    });
+    for (SingleShaderStage stage : stageList) {
+        if (errors[stage] != nullptr) {
+            return std::move(errors[stage]);
+        }
+    }
+    return {};
+}
+
 MaybeError ValidateCompatibilityWithPipelineLayout(DeviceBase* device,
                                                    const EntryPointMetadata& entryPoint,
                                                    const PipelineLayoutBase* layout) {
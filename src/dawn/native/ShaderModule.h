@@ -29,6 +29,7 @@
 #define SRC_DAWN_NATIVE_SHADERMODULE_H_
 
 #include <bitset>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -157,6 +158,13 @@ ResultOrError<tint::Program> RunTransforms(tint::ast::transform::Manager* transf
                                            tint::ast::transform::DataMap* outputs,
                                            OwnedCompilationMessages* messages);
 
+// Calls |compileStage| for each stage in |stages|. When Toggle::ParallelShaderCompilation is
+// enabled, the stages are compiled concurrently on the device's worker task pool, so
+// |compileStage| must be thread-safe. Returns the error of the first stage that failed.
+MaybeError CompileShaderStages(DeviceBase* device,
+                               wgpu::ShaderStage stages,
+                               const std::function<MaybeError(SingleShaderStage)>& compileStage);
+
 // Shader metadata for a binding, very similar to information contained in a pipeline layout.
 struct ShaderBindingInfo {
     BindingNumber binding;
@@ -593,6 +593,18 @@ static constexpr ToggleEnumAndInfoList kToggleNameAndInfoList = {{
       "Don't validate the required VkImage size against the size of the AHardwareBuffer on import. "
       "Some drivers report the wrong size.",
       "https://crbug.com/333424893", ToggleStage::Device}},
+    {Toggle::NullBackendAsyncPipelineCreation,
+     {"null_backend_async_pipeline_creation",
+      "Initialize the pipelines created with Create*PipelineAsync on the worker task pool on the "
+      "Null backend, like the backends that support asynchronous pipeline creation do. This is "
+      "used to benchmark the worker task pool without a GPU.",
+      "https://crbug.com/dawn/529", ToggleStage::Device}},
+    {Toggle::ParallelShaderCompilation,
+     {"parallel_shader_compilation",
+      "Run the transforms and backend shader compilation of the stages of a render pipeline "
+      "concurrently on the worker task pool instead of one after the other on the thread creating "
+      "the pipeline.",
+      "https://crbug.com/dawn/529", ToggleStage::Device}},
     // Comment to separate the }} so it is clearer what to copy-paste to add a toggle.
 }};
 }  // anonymous namespace
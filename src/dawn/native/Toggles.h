@@ -146,6 +146,8 @@ enum class Toggle {
 
     D3D11UseUnmonitoredFence,
     IgnoreImportedAHardwareBufferVulkanImageSize,
+    NullBackendAsyncPipelineCreation,
+    ParallelShaderCompilation,
 
     EnumCount,
     InvalidEnum = EnumCount,
@@ -355,7 +355,7 @@ MaybeError RenderPipeline::InitializeImpl() {
             fragmentEntryPoint.usedInterStageVariables);
     }
 
-    for (auto stage : IterateStages(GetStageMask())) {
+    auto CompileStage = [&](SingleShaderStage stage) -> MaybeError {
         const ProgrammableStage& programmableStage = GetStage(stage);
         uint32_t additionalCompileFlags = 0;
         if (programmableStage.module->GetStrictMath().value_or(
@@ -367,6 +367,11 @@ MaybeError RenderPipeline::InitializeImpl() {
             ToBackend(programmableStage.module)
                 ->Compile(programmableStage, stage, ToBackend(GetLayout()),
                           compileFlags | additionalCompileFlags, usedInterstageVariables));
+        return {};
+    };
+    DAWN_TRY(CompileShaderStages(device, GetStageMask(), CompileStage));
+
+    for (auto stage : IterateStages(GetStageMask())) {
         *shaders[stage] = {compiledShader[stage].shaderBlob.Data(),
                            compiledShader[stage].shaderBlob.Size()};
     }
@@ -33,6 +33,7 @@
 #include "dawn/native/BackendConnection.h"
 #include "dawn/native/ChainUtils.h"
 #include "dawn/native/Commands.h"
+#include "dawn/native/CreatePipelineAsyncEvent.h"
 #include "dawn/native/ErrorData.h"
 #include "dawn/native/Instance.h"
 #include "dawn/native/Surface.h"
@@ -249,6 +250,22 @@ ResultOrError<Ref<TextureViewBase>> Device::CreateTextureViewImpl(
     return AcquireRef(new TextureView(texture, descriptor));
 }
 
+void Device::InitializeComputePipelineAsyncImpl(Ref<CreateComputePipelineAsyncEvent> event) {
+    if (IsToggleEnabled(Toggle::NullBackendAsyncPipelineCreation)) {
+        event->InitializeAsync();
+    } else {
+        event->InitializeSync();
+    }
+}
+
+void Device::InitializeRenderPipelineAsyncImpl(Ref<CreateRenderPipelineAsyncEvent> event) {
+    if (IsToggleEnabled(Toggle::NullBackendAsyncPipelineCreation)) {
+        event->InitializeAsync();
+    } else {
+        event->InitializeSync();
+    }
+}
+
 void Device::DestroyImpl() {
     DAWN_ASSERT(GetState() == State::Disconnected);
     // TODO(crbug.com/dawn/831): DestroyImpl is called from two places.
@@ -341,14 +341,27 @@ MaybeError RenderPipeline::InitializeImpl() {
     std::array<std::string, 2> shaderStageEntryPoints;
     uint32_t stageCount = 0;
 
-    auto AddShaderStage = [&](SingleShaderStage stage, VkShaderStageFlagBits vkStage,
-                              bool clampFragDepth, bool emitPointSize) -> MaybeError {
+    // Compile the stages first, possibly concurrently, then record them in order.
+    PerStage<ShaderModule::ModuleAndSpirv> modulesAndSpirv;
+    auto CompileStage = [&](SingleShaderStage stage) -> MaybeError {
         const ProgrammableStage& programmableStage = GetStage(stage);
-        ShaderModule::ModuleAndSpirv moduleAndSpirv;
-        DAWN_TRY_ASSIGN(moduleAndSpirv, ToBackend(programmableStage.module)
-                                            ->GetHandleAndSpirv(stage, programmableStage, layout,
-                                                                clampFragDepth, emitPointSize,
-                                                                /* fullSubgroups */ {}));
+        bool clampFragDepth = false;
+        bool emitPointSize = false;
+        if (stage == SingleShaderStage::Vertex) {
+            emitPointSize = GetPrimitiveTopology() == wgpu::PrimitiveTopology::PointList;
+        } else {
+            clampFragDepth = UsesFragDepth() && !HasUnclippedDepth();
+        }
+        DAWN_TRY_ASSIGN(modulesAndSpirv[stage],
+                        ToBackend(programmableStage.module)
+                            ->GetHandleAndSpirv(stage, programmableStage, layout, clampFragDepth,
+                                                emitPointSize, /* fullSubgroups */ {}));
+        return {};
+    };
+    DAWN_TRY(CompileShaderStages(device, GetStageMask(), CompileStage));
+
+    auto AddShaderStage = [&](SingleShaderStage stage, VkShaderStageFlagBits vkStage) {
+        const ShaderModule::ModuleAndSpirv& moduleAndSpirv = modulesAndSpirv[stage];
         mHasInputAttachment = mHasInputAttachment || moduleAndSpirv.hasInputAttachment;
         // Record cache key for each shader since it will become inaccessible later on.
         StreamIn(&mCacheKey, stream::Iterable(moduleAndSpirv.spirv, moduleAndSpirv.wordCount));
@@ -364,19 +377,14 @@ MaybeError RenderPipeline::InitializeImpl() {
         shaderStage->pName = shaderStageEntryPoints[stageCount].c_str();
 
         stageCount++;
-        return {};
     };
 
     // Add the vertex stage that's always present.
-    DAWN_TRY(AddShaderStage(SingleShaderStage::Vertex, VK_SHADER_STAGE_VERTEX_BIT,
-                            /*clampFragDepth*/ false,
-                            GetPrimitiveTopology() == wgpu::PrimitiveTopology::PointList));
+    AddShaderStage(SingleShaderStage::Vertex, VK_SHADER_STAGE_VERTEX_BIT);
 
     // Add the fragment stage if present.
     if (GetStageMask() & wgpu::ShaderStage::Fragment) {
-        bool clampFragDepth = UsesFragDepth() && !HasUnclippedDepth();
-        DAWN_TRY(AddShaderStage(SingleShaderStage::Fragment, VK_SHADER_STAGE_FRAGMENT_BIT,
-                                clampFragDepth, /*emitPointSize*/ false));
+        AddShaderStage(SingleShaderStage::Fragment, VK_SHADER_STAGE_FRAGMENT_BIT);
     }
 
     PipelineVertexInputStateCreateInfoTemporaryAllocations tempAllocations;
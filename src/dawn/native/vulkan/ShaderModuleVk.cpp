@@ -28,7 +28,9 @@
 #include "dawn/native/vulkan/ShaderModuleVk.h"
 
 #include <cstdint>
+#include <cstring>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -198,7 +200,8 @@ ShaderModule::~ShaderModule() = default;
 
 #define SPIRV_COMPILATION_REQUEST_MEMBERS(X)                                                     \
     X(SingleShaderStage, stage)                                                                  \
-    X(const tint::Program*, inputProgram)                                                        \
+    X(CacheKey::UnsafeUnkeyedValue<const tint::Program*>, inputProgram)                          \
+    X(stream::ByteVectorSink, inputProgramKey)                                                   \
     X(std::optional<tint::ast::transform::SubstituteOverride::Config>, substituteOverrideConfig) \
     X(LimitsForCompilationRequest, limits)                                                       \
     X(std::string_view, entryPointName)                                                          \
@@ -206,11 +209,158 @@ ShaderModule::~ShaderModule() = default;
     X(tint::spirv::writer::Options, tintOptions)                                                 \
     X(bool, use_tint_ir)                                                                         \
     X(CacheKey::UnsafeUnkeyedValue<dawn::platform::Platform*>, platform)                         \
+    X(CacheKey::UnsafeUnkeyedValue<DeviceBase*>, device)                                         \
     X(std::optional<uint32_t>, maxSubgroupSizeForFullSubgroups)
 
 DAWN_MAKE_CACHE_REQUEST(SpirvCompilationRequest, SPIRV_COMPILATION_REQUEST_MEMBERS);
 #undef SPIRV_COMPILATION_REQUEST_MEMBERS
 
+// The inputs of a SpirvCompilationRequest that the lowered Tint IR depends on. It leaves out the
+// SPIR-V writer options (bindings, robustness, polyfills, ...) so that the pipeline variants of an
+// entry point that only differ in those can share the WGSL -> IR lowering.
+// Both requests are keyed by `inputProgramKey` rather than by the program itself, as streaming a
+// program writes out the whole module as WGSL. GetHandleAndSpirv() does that once for both.
+#define LOWERED_IR_REQUEST_MEMBERS(X)                                                            \
+    X(SingleShaderStage, stage)                                                                  \
+    X(CacheKey::UnsafeUnkeyedValue<const tint::Program*>, inputProgram)                          \
+    X(stream::ByteVectorSink, inputProgramKey)                                                   \
+    X(std::optional<tint::ast::transform::SubstituteOverride::Config>, substituteOverrideConfig) \
+    X(LimitsForCompilationRequest, limits)                                                       \
+    X(std::string_view, entryPointName)                                                          \
+    X(bool, disableSymbolRenaming)                                                               \
+    X(CacheKey::UnsafeUnkeyedValue<dawn::platform::Platform*>, platform)                         \
+    X(std::optional<uint32_t>, maxSubgroupSizeForFullSubgroups)
+
+DAWN_MAKE_CACHE_REQUEST(LoweredIRRequest, LOWERED_IR_REQUEST_MEMBERS);
+#undef LOWERED_IR_REQUEST_MEMBERS
+
+#define LOWERED_IR_MEMBERS(X)          \
+    X(std::vector<uint8_t>, flatIR)    \
+    X(std::string, remappedEntryPoint)
+
+// Represents the lowered Tint IR of a single entry point, encoded with the flat IR binary format.
+DAWN_SERIALIZABLE(struct, LoweredIR, LOWERED_IR_MEMBERS) {
+    // The decoded `flatIR`. Not serialized.
+    std::unique_ptr<tint::core::ir::Module> module;
+};
+#undef LOWERED_IR_MEMBERS
+
+namespace {
+
+struct TransformedProgram {
+    tint::Program program;
+    std::string remappedEntryPoint;
+};
+
+// Runs the AST transforms that reduce the input program to a single entry point with its overrides
+// substituted, and validates the workgroup size of compute entry points.
+ResultOrError<TransformedProgram> TransformProgram(
+    dawn::platform::Platform* platform,
+    SingleShaderStage stage,
+    const tint::Program* inputProgram,
+    std::optional<tint::ast::transform::SubstituteOverride::Config> substituteOverrideConfig,
+    const LimitsForCompilationRequest& limits,
+    std::string_view entryPointName,
+    bool disableSymbolRenaming,
+    std::optional<uint32_t> maxSubgroupSizeForFullSubgroups) {
+    tint::ast::transform::Manager transformManager;
+    tint::ast::transform::DataMap transformInputs;
+
+    // Many Vulkan drivers can't handle multi-entrypoint shader modules.
+    // Run before the renamer so that the entry point name matches `entryPointName` still.
+    transformManager.append(std::make_unique<tint::ast::transform::SingleEntryPoint>());
+    transformInputs.Add<tint::ast::transform::SingleEntryPoint::Config>(
+        std::string(entryPointName));
+
+    // Needs to run before all other transforms so that they can use builtin names safely.
+    if (!disableSymbolRenaming) {
+        transformManager.Add<tint::ast::transform::Renamer>();
+    }
+
+    if (substituteOverrideConfig) {
+        // This needs to run after SingleEntryPoint transform which removes unused overrides
+        // for current entry point.
+        transformManager.Add<tint::ast::transform::SubstituteOverride>();
+        transformInputs.Add<tint::ast::transform::SubstituteOverride::Config>(
+            std::move(substituteOverrideConfig).value());
+    }
+
+    TransformedProgram result;
+    tint::ast::transform::DataMap transformOutputs;
+    {
+        TRACE_EVENT0(platform, General, "RunTransforms");
+        DAWN_TRY_ASSIGN(result.program, RunTransforms(&transformManager, inputProgram,
+                                                      transformInputs, &transformOutputs, nullptr));
+    }
+
+    // Get the entry point name after the renamer pass.
+    // TODO(dawn:2180): refactor out.
+    if (disableSymbolRenaming) {
+        result.remappedEntryPoint = entryPointName;
+    } else {
+        auto* data = transformOutputs.Get<tint::ast::transform::Renamer::Data>();
+        DAWN_ASSERT(data != nullptr);
+
+        auto it = data->remappings.find(entryPointName.data());
+        DAWN_ASSERT(it != data->remappings.end());
+        result.remappedEntryPoint = it->second;
+    }
+    DAWN_ASSERT(result.remappedEntryPoint != "");
+
+    // Validate workgroup size after program runs transforms.
+    if (stage == SingleShaderStage::Compute) {
+        Extent3D _;
+        DAWN_TRY_ASSIGN(_, ValidateComputeStageWorkgroupSize(
+                               result.program, result.remappedEntryPoint.c_str(), limits,
+                               maxSubgroupSizeForFullSubgroups));
+    }
+
+    return result;
+}
+
+ResultOrError<LoweredIR> LowerToIR(LoweredIRRequest r) {
+    TransformedProgram transformed;
+    DAWN_TRY_ASSIGN(transformed, TransformProgram(r.platform.UnsafeGetValue(), r.stage,
+                                                  r.inputProgram.UnsafeGetValue(),
+                                                  std::move(r.substituteOverrideConfig), r.limits,
+                                                  r.entryPointName, r.disableSymbolRenaming,
+                                                  r.maxSubgroupSizeForFullSubgroups));
+
+    TRACE_EVENT0(r.platform.UnsafeGetValue(), General, "tint::wgsl::reader::ProgramToLoweredIR()");
+    auto ir = tint::wgsl::reader::ProgramToLoweredIR(transformed.program);
+    DAWN_INVALID_IF(ir != tint::Success, "An error occurred while generating Tint IR\n%s",
+                    ir.Failure().reason.Str());
+
+    auto encoded = tint::core::ir::binary::flat::Encode(ir.Get());
+    DAWN_INTERNAL_ERROR_IF(encoded != tint::Success,
+                           "An error occurred while encoding Tint IR\n%s",
+                           encoded.Failure().reason.Str());
+
+    LoweredIR result;
+    auto bytes = encoded.Get().Slice();
+    result.flatIR.resize(bytes.len);
+    memcpy(result.flatIR.data(), bytes.data, bytes.len);
+    result.remappedEntryPoint = std::move(transformed.remappedEntryPoint);
+    result.module = std::make_unique<tint::core::ir::Module>(ir.Move());
+    return result;
+}
+
+// Loads the LoweredIR from a cached blob and decodes its IR. A stale or corrupt blob is an error,
+// so that LoadOrRun() lowers the program again instead of using it.
+ResultOrError<LoweredIR> LoadLoweredIR(Blob blob) {
+    LoweredIR result;
+    DAWN_TRY_ASSIGN(result, LoweredIR::FromBlob(std::move(blob)));
+
+    auto ir = tint::core::ir::binary::flat::Decode(tint::Slice<const std::byte>{
+        reinterpret_cast<const std::byte*>(result.flatIR.data()), result.flatIR.size()});
+    DAWN_INTERNAL_ERROR_IF(ir != tint::Success, "An error occurred while decoding Tint IR\n%s",
+                           ir.Failure().reason.Str());
+    result.module = std::make_unique<tint::core::ir::Module>(ir.Move());
+    return result;
+}
+
+}  // anonymous namespace
+
 #endif  // TINT_BUILD_SPV_WRITER
 
 ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
@@ -335,10 +485,12 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
     SpirvCompilationRequest req = {};
     req.stage = stage;
     auto tintProgram = GetTintProgram();
-    req.inputProgram = &(tintProgram->program);
+    req.inputProgram = CacheKey::UnsafeUnkeyedValue<const tint::Program*>(&(tintProgram->program));
+    StreamIn(&req.inputProgramKey, tintProgram->program);
     req.entryPointName = programmableStage.entryPoint;
     req.disableSymbolRenaming = GetDevice()->IsToggleEnabled(Toggle::DisableSymbolRenaming);
     req.platform = UnsafeUnkeyedValue(GetDevice()->GetPlatform());
+    req.device = UnsafeUnkeyedValue(GetDevice());
     req.substituteOverrideConfig = std::move(substituteOverrideConfig);
     req.maxSubgroupSizeForFullSubgroups = maxSubgroupSizeForFullSubgroups;
 
@@ -384,72 +536,52 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
     DAWN_TRY_LOAD_OR_RUN(
         compilation, GetDevice(), std::move(req), CompiledSpirv::FromBlob,
         [](SpirvCompilationRequest r) -> ResultOrError<CompiledSpirv> {
-            tint::ast::transform::Manager transformManager;
-            tint::ast::transform::DataMap transformInputs;
-
-            // Many Vulkan drivers can't handle multi-entrypoint shader modules.
-            // Run before the renamer so that the entry point name matches `entryPointName` still.
-            transformManager.append(std::make_unique<tint::ast::transform::SingleEntryPoint>());
-            transformInputs.Add<tint::ast::transform::SingleEntryPoint::Config>(
-                std::string(r.entryPointName));
-
-            // Needs to run before all other transforms so that they can use builtin names safely.
-            if (!r.disableSymbolRenaming) {
-                transformManager.Add<tint::ast::transform::Renamer>();
-            }
-
-            if (r.substituteOverrideConfig) {
-                // This needs to run after SingleEntryPoint transform which removes unused overrides
-                // for current entry point.
-                transformManager.Add<tint::ast::transform::SubstituteOverride>();
-                transformInputs.Add<tint::ast::transform::SubstituteOverride::Config>(
-                    std::move(r.substituteOverrideConfig).value());
-            }
-
-            tint::Program program;
-            tint::ast::transform::DataMap transformOutputs;
-            {
-                TRACE_EVENT0(r.platform.UnsafeGetValue(), General, "RunTransforms");
-                DAWN_TRY_ASSIGN(program,
-                                RunTransforms(&transformManager, r.inputProgram, transformInputs,
-                                              &transformOutputs, nullptr));
-            }
-
-            // Get the entry point name after the renamer pass.
-            // TODO(dawn:2180): refactor out.
-            std::string remappedEntryPoint;
-            if (r.disableSymbolRenaming) {
-                remappedEntryPoint = r.entryPointName;
-            } else {
-                auto* data = transformOutputs.Get<tint::ast::transform::Renamer::Data>();
-                DAWN_ASSERT(data != nullptr);
-
-                auto it = data->remappings.find(r.entryPointName.data());
-                DAWN_ASSERT(it != data->remappings.end());
-                remappedEntryPoint = it->second;
-            }
-            DAWN_ASSERT(remappedEntryPoint != "");
-
-            // Validate workgroup size after program runs transforms.
-            if (r.stage == SingleShaderStage::Compute) {
-                Extent3D _;
-                DAWN_TRY_ASSIGN(_, ValidateComputeStageWorkgroupSize(
-                                       program, remappedEntryPoint.c_str(), r.limits,
-                                       r.maxSubgroupSizeForFullSubgroups));
-            }
-
-            TRACE_EVENT0(r.platform.UnsafeGetValue(), General, "tint::spirv::writer::Generate()");
             tint::Result<tint::spirv::writer::Output> tintResult;
+            std::string remappedEntryPoint;
             if (r.use_tint_ir) {
-                // Convert the AST program to an IR module.
-                auto ir = tint::wgsl::reader::ProgramToLoweredIR(program);
-                DAWN_INVALID_IF(ir != tint::Success,
-                                "An error occurred while generating Tint IR\n%s",
-                                ir.Failure().reason.Str());
-
-                tintResult = tint::spirv::writer::Generate(ir.Get(), r.tintOptions);
+                // The lowered IR doesn't depend on the SPIR-V writer options, so it is looked up
+                // in its own cache entry that is shared by all the variants of this entry point.
+                // It is keyed by a subset of this request so the result still only depends on
+                // the key of this request.
+                DeviceBase* device = r.device.UnsafeGetValue();
+                LoweredIRRequest irReq = {};
+                irReq.stage = r.stage;
+                irReq.inputProgram = r.inputProgram;
+                irReq.inputProgramKey = std::move(r.inputProgramKey);
+                irReq.substituteOverrideConfig = std::move(r.substituteOverrideConfig);
+                irReq.limits = r.limits;
+                irReq.entryPointName = r.entryPointName;
+                irReq.disableSymbolRenaming = r.disableSymbolRenaming;
+                irReq.platform = r.platform;
+                irReq.maxSubgroupSizeForFullSubgroups = r.maxSubgroupSizeForFullSubgroups;
+
+                CacheResult<LoweredIR> loweredIR;
+                DAWN_TRY_LOAD_OR_RUN(loweredIR, device, std::move(irReq), LoadLoweredIR,
+                                     LowerToIR, "Vulkan.LowerToIR");
+                device->GetBlobCache()->EnsureStored(loweredIR);
+                DAWN_HISTOGRAM_BOOLEAN(r.platform.UnsafeGetValue(),
+                                       "Vulkan.CompileShaderToSPIRV.LoweredIRCacheHit",
+                                       loweredIR.IsCached());
+
+                remappedEntryPoint = loweredIR->remappedEntryPoint;
+
+                TRACE_EVENT0(r.platform.UnsafeGetValue(), General,
+                             "tint::spirv::writer::Generate()");
+                tintResult = tint::spirv::writer::Generate(*loweredIR->module, r.tintOptions);
             } else {
-                tintResult = tint::spirv::writer::Generate(program, r.tintOptions);
+                TransformedProgram transformed;
+                DAWN_TRY_ASSIGN(
+                    transformed,
+                    TransformProgram(r.platform.UnsafeGetValue(), r.stage,
+                                     r.inputProgram.UnsafeGetValue(),
+                                     std::move(r.substituteOverrideConfig), r.limits,
+                                     r.entryPointName, r.disableSymbolRenaming,
+                                     r.maxSubgroupSizeForFullSubgroups));
+                remappedEntryPoint = std::move(transformed.remappedEntryPoint);
+
+                TRACE_EVENT0(r.platform.UnsafeGetValue(), General,
+                             "tint::spirv::writer::Generate()");
+                tintResult = tint::spirv::writer::Generate(transformed.program, r.tintOptions);
             }
             DAWN_INVALID_IF(tintResult != tint::Success,
                             "An error occurred while generating SPIR-V\n%s",
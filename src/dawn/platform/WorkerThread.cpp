@@ -27,18 +27,21 @@
 
 #include "dawn/platform/WorkerThread.h"
 
-#include <condition_variable>
-#include <functional>
-#include <thread>
+#include <algorithm>
+#include <deque>
+#include <utility>
 
 #include "dawn/common/Assert.h"
+#include "dawn/common/RefCounted.h"
+#include "partition_alloc/pointers/raw_ptr.h"
 
-namespace {
+namespace dawn::platform {
 
+// The state shared between an AsyncWaitableEvent and the task it waits on. They are recycled
+// through a WaitableEventPool so that posting a task doesn't allocate a new mutex and condition
+// variable each time.
 class AsyncWaitableEventImpl {
   public:
-    AsyncWaitableEventImpl() : mIsComplete(false) {}
-
     void Wait() {
         std::unique_lock<std::mutex> lock(mMutex);
         mCondition.wait(lock, [this] { return mIsComplete; });
@@ -58,46 +61,209 @@ class AsyncWaitableEventImpl {
     }
 
   private:
+    friend class WaitableEventPool;
+
     std::mutex mMutex;
     std::condition_variable mCondition;
-    bool mIsComplete;
+    bool mIsComplete = false;
+
+    // One reference is held by the AsyncWaitableEvent and one by the posted task. The pool is only
+    // referenced while the event is in use, so that recycled events don't keep it alive.
+    std::atomic<uint32_t> mRefCount = 0;
+    Ref<WaitableEventPool> mPool;
 };
 
+class WaitableEventPool : public RefCounted {
+  public:
+    AsyncWaitableEventImpl* AcquireEvent() {
+        AsyncWaitableEventImpl* event = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mFreeEvents.empty()) {
+                event = mFreeEvents.back().release();
+                mFreeEvents.pop_back();
+            }
+        }
+        if (event == nullptr) {
+            event = new AsyncWaitableEventImpl();
+        }
+
+        event->mIsComplete = false;
+        event->mRefCount.store(2, std::memory_order_relaxed);
+        event->mPool = this;
+        return event;
+    }
+
+    static void ReleaseEvent(AsyncWaitableEventImpl* event) {
+        if (event->mRefCount.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+
+        // Keep the pool alive until the event has been returned to it.
+        Ref<WaitableEventPool> pool = std::move(event->mPool);
+        std::lock_guard<std::mutex> lock(pool->mMutex);
+        pool->mFreeEvents.emplace_back(event);
+    }
+
+  private:
+    ~WaitableEventPool() override = default;
+
+    std::mutex mMutex;
+    std::vector<std::unique_ptr<AsyncWaitableEventImpl>> mFreeEvents;
+};
+
+namespace {
+
 class AsyncWaitableEvent final : public dawn::platform::WaitableEvent {
   public:
-    AsyncWaitableEvent() : mWaitableEventImpl(std::make_shared<AsyncWaitableEventImpl>()) {}
+    explicit AsyncWaitableEvent(AsyncWaitableEventImpl* impl) : mWaitableEventImpl(impl) {}
+    ~AsyncWaitableEvent() override { WaitableEventPool::ReleaseEvent(mWaitableEventImpl); }
 
     void Wait() override { mWaitableEventImpl->Wait(); }
 
     bool IsComplete() override { return mWaitableEventImpl->IsComplete(); }
 
-    std::shared_ptr<AsyncWaitableEventImpl> GetWaitableEventImpl() const {
-        return mWaitableEventImpl;
-    }
-
   private:
-    std::shared_ptr<AsyncWaitableEventImpl> mWaitableEventImpl;
+    raw_ptr<AsyncWaitableEventImpl> mWaitableEventImpl;
 };
 
+// The worker of the current thread, if the current thread belongs to an AsyncWorkerThreadPool.
+thread_local const void* tlCurrentPool = nullptr;
+thread_local uint32_t tlCurrentWorkerIndex = 0;
+
 }  // anonymous namespace
 
-namespace dawn::platform {
+struct AsyncWorkerThreadPool::Task {
+    dawn::platform::PostWorkerTaskCallback callback;
+    void* userdata;
+    AsyncWaitableEventImpl* event;
+};
+
+class AsyncWorkerThreadPool::Worker {
+  public:
+    std::mutex mutex;
+    std::deque<Task> tasks;
+};
+
+AsyncWorkerThreadPool::AsyncWorkerThreadPool(uint32_t threadCount)
+    : mThreadCount(threadCount != 0 ? threadCount
+                                    : std::max(1u, std::thread::hardware_concurrency())),
+      mEventPool(AcquireRef(new WaitableEventPool())) {
+    mWorkers.reserve(mThreadCount);
+    for (uint32_t i = 0; i < mThreadCount; ++i) {
+        mWorkers.push_back(std::make_unique<Worker>());
+    }
+}
+
+AsyncWorkerThreadPool::~AsyncWorkerThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        mIsShuttingDown = true;
+    }
+    mSleepCondition.notify_all();
+
+    // The workers drain all the queued tasks before exiting.
+    for (std::thread& thread : mThreads) {
+        thread.join();
+    }
+    DAWN_ASSERT(mQueuedTaskCount.load() == 0);
+}
+
+uint32_t AsyncWorkerThreadPool::GetThreadCount() const {
+    return mThreadCount;
+}
 
 std::unique_ptr<dawn::platform::WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
     dawn::platform::PostWorkerTaskCallback callback,
     void* userdata) {
-    std::unique_ptr<AsyncWaitableEvent> waitableEvent = std::make_unique<AsyncWaitableEvent>();
+    EnsureWorkersStarted();
+
+    AsyncWaitableEventImpl* event = mEventPool->AcquireEvent();
+    auto waitableEvent = std::make_unique<AsyncWaitableEvent>(event);
+
+    // Tasks posted from one of our workers stay on that worker's deque for locality. The other
+    // workers will steal them if they are idle.
+    uint32_t workerIndex;
+    if (tlCurrentPool == this) {
+        workerIndex = tlCurrentWorkerIndex;
+    } else {
+        workerIndex = mNextWorkerIndex.fetch_add(1, std::memory_order_relaxed) % mThreadCount;
+    }
 
-    std::function<void()> doTask = [callback, userdata,
-                                    waitableEventImpl = waitableEvent->GetWaitableEventImpl()] {
-        callback(userdata);
-        waitableEventImpl->MarkAsComplete();
-    };
+    {
+        Worker* worker = mWorkers[workerIndex].get();
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->tasks.push_back({callback, userdata, event});
+        mQueuedTaskCount.fetch_add(1, std::memory_order_release);
+    }
 
-    std::thread thread(doTask);
-    thread.detach();
+    // Synchronize with workers that are about to sleep so that the notification isn't lost.
+    { std::lock_guard<std::mutex> lock(mSleepMutex); }
+    mSleepCondition.notify_one();
 
     return waitableEvent;
 }
 
+void AsyncWorkerThreadPool::EnsureWorkersStarted() {
+    std::call_once(mStartWorkersFlag, [this] {
+        mThreads.reserve(mThreadCount);
+        for (uint32_t i = 0; i < mThreadCount; ++i) {
+            mThreads.emplace_back([this, i] { WorkerLoop(i); });
+        }
+    });
+}
+
+bool AsyncWorkerThreadPool::TryPopTask(uint32_t workerIndex, Task* task) {
+    // Pop the most recently pushed task from our own deque first.
+    {
+        Worker* worker = mWorkers[workerIndex].get();
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        if (!worker->tasks.empty()) {
+            *task = worker->tasks.back();
+            worker->tasks.pop_back();
+            mQueuedTaskCount.fetch_sub(1, std::memory_order_acquire);
+            return true;
+        }
+    }
+
+    // Otherwise steal the oldest task of another worker.
+    for (uint32_t i = 1; i < mThreadCount; ++i) {
+        Worker* victim = mWorkers[(workerIndex + i) % mThreadCount].get();
+        std::lock_guard<std::mutex> lock(victim->mutex);
+        if (!victim->tasks.empty()) {
+            *task = victim->tasks.front();
+            victim->tasks.pop_front();
+            mQueuedTaskCount.fetch_sub(1, std::memory_order_acquire);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void AsyncWorkerThreadPool::WorkerLoop(uint32_t workerIndex) {
+    tlCurrentPool = this;
+    tlCurrentWorkerIndex = workerIndex;
+
+    while (true) {
+        Task task;
+        if (TryPopTask(workerIndex, &task)) {
+            task.callback(task.userdata);
+            task.event->MarkAsComplete();
+            WaitableEventPool::ReleaseEvent(task.event);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mSleepMutex);
+        mSleepCondition.wait(lock, [this] {
+            return mQueuedTaskCount.load(std::memory_order_acquire) != 0 || mIsShuttingDown;
+        });
+        if (mIsShuttingDown && mQueuedTaskCount.load(std::memory_order_acquire) == 0) {
+            break;
+        }
+    }
+
+    tlCurrentPool = nullptr;
+}
+
 }  // namespace dawn::platform
@@ -28,18 +28,66 @@
 #ifndef SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 #define SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "dawn/common/NonCopyable.h"
+#include "dawn/common/Ref.h"
 #include "dawn/platform/DawnPlatform.h"
 
 namespace dawn::platform {
 
-class AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool, public NonCopyable {
+class AsyncWaitableEventImpl;
+class WaitableEventPool;
+
+// A fixed-size pool of worker threads. Each worker owns a deque of tasks: tasks posted from a
+// worker thread are pushed to that worker's deque, other tasks are distributed round-robin. Idle
+// workers pop from the back of their own deque and steal from the front of the other workers'
+// deques. The threads are started lazily on the first PostWorkerTask() call and are joined in the
+// destructor once all the posted tasks have completed.
+class DAWN_PLATFORM_EXPORT AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool,
+                                                   public NonCopyable {
   public:
+    // Creates a pool with |threadCount| workers. A |threadCount| of 0 uses the number of hardware
+    // threads reported by the system.
+    explicit AsyncWorkerThreadPool(uint32_t threadCount = 0);
+    ~AsyncWorkerThreadPool() override;
+
     std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
         dawn::platform::PostWorkerTaskCallback callback,
         void* userdata) override;
+
+    uint32_t GetThreadCount() const;
+
+  private:
+    struct Task;
+    class Worker;
+
+    void EnsureWorkersStarted();
+    void WorkerLoop(uint32_t workerIndex);
+    bool TryPopTask(uint32_t workerIndex, Task* task);
+
+    const uint32_t mThreadCount;
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    std::vector<std::thread> mThreads;
+    std::once_flag mStartWorkersFlag;
+
+    // Index of the worker that receives the next task posted from outside of the pool.
+    std::atomic<uint32_t> mNextWorkerIndex = 0;
+    // The number of tasks currently queued in all the worker deques.
+    std::atomic<uint64_t> mQueuedTaskCount = 0;
+
+    // Lock and condition variable used to put idle workers to sleep.
+    std::mutex mSleepMutex;
+    std::condition_variable mSleepCondition;
+    bool mIsShuttingDown = false;
+
+    Ref<WaitableEventPool> mEventPool;
 };
 
 }  // namespace dawn::platform
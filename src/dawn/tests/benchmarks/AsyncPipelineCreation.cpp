@@ -0,0 +1,188 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/WorkerThread.h"
+#include "dawn/tests/benchmarks/NullDeviceSetup.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+// The worker task pool that Dawn used before AsyncWorkerThreadPool: every task is run on a new
+// detached thread. Kept here as a baseline for the benchmarks.
+class ThreadPerTaskPool : public platform::WorkerTaskPool {
+  public:
+    std::unique_ptr<platform::WaitableEvent> PostWorkerTask(
+        platform::PostWorkerTaskCallback callback,
+        void* userdata) override {
+        auto waitableEvent = std::make_unique<Event>();
+        std::thread([callback, userdata, state = waitableEvent->state] {
+            callback(userdata);
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->isComplete = true;
+            }
+            state->condition.notify_all();
+        }).detach();
+        return waitableEvent;
+    }
+
+  private:
+    struct EventState {
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool isComplete = false;
+    };
+
+    class Event : public platform::WaitableEvent {
+      public:
+        void Wait() override {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->condition.wait(lock, [this] { return state->isComplete; });
+        }
+        bool IsComplete() override {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            return state->isComplete;
+        }
+
+        std::shared_ptr<EventState> state = std::make_shared<EventState>();
+    };
+};
+
+template <typename WorkerTaskPoolType>
+class WorkerTaskPoolPlatform : public platform::Platform {
+  public:
+    std::unique_ptr<platform::WorkerTaskPool> CreateWorkerTaskPool() override {
+        return std::make_unique<WorkerTaskPoolType>();
+    }
+};
+
+// Benchmarks for bursts of CreateComputePipelineAsync calls with the different worker task pools.
+// The Null backend compiles the shaders on the worker task pool when
+// null_backend_async_pipeline_creation is enabled.
+template <typename WorkerTaskPoolType>
+class AsyncPipelineCreation : public NullDeviceBenchmarkFixture {
+  protected:
+    void CreateComputePipelineBurst(benchmark::State& state) {
+        wgpu::ShaderModule module = utils::CreateShaderModule(device, R"(
+            override x: u32 = 0u;
+            @group(0) @binding(0) var<storage, read_write> data : array<u32>;
+            @compute @workgroup_size(64) fn main(@builtin(global_invocation_id) id : vec3u) {
+                var v = data[id.x];
+                for (var i = 0u; i < x; i++) {
+                    v = v * 1664525u + 1013904223u;
+                }
+                data[id.x] = v;
+            }
+        )");
+
+        wgpu::ConstantEntry constant = {};
+        constant.key = "x";
+        constant.value = 0;
+
+        wgpu::ComputePipelineDescriptor computeDesc = {};
+        computeDesc.compute.module = module;
+        computeDesc.compute.constantCount = 1;
+        computeDesc.compute.constants = &constant;
+
+        const int64_t burstSize = state.range(0);
+        std::vector<wgpu::ComputePipeline> pipelines;
+        pipelines.reserve(burstSize);
+
+        for (auto _ : state) {
+            std::mutex mutex;
+            std::condition_variable cv;
+            int64_t completedCount = 0;
+
+            for (int64_t i = 0; i < burstSize; ++i) {
+                // Use a different override value for each pipeline so that none of them are
+                // deduplicated by the pipeline cache.
+                constant.value += 1;
+                device.CreateComputePipelineAsync(
+                    &computeDesc, wgpu::CallbackMode::AllowSpontaneous,
+                    [&](wgpu::CreatePipelineAsyncStatus, wgpu::ComputePipeline pipeline,
+                        const char*) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        pipelines.push_back(std::move(pipeline));
+                        if (++completedCount == burstSize) {
+                            cv.notify_one();
+                        }
+                    });
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&] { return completedCount == burstSize; });
+            pipelines.clear();
+        }
+        state.SetItemsProcessed(state.iterations() * burstSize);
+    }
+
+  private:
+    wgpu::DeviceDescriptor GetDeviceDescriptor() const override {
+        wgpu::DeviceDescriptor deviceDesc = {};
+        deviceDesc.nextInChain = &mTogglesDesc;
+        return deviceDesc;
+    }
+
+    platform::Platform* GetPlatform() const override {
+        static WorkerTaskPoolPlatform<WorkerTaskPoolType> platform;
+        return &platform;
+    }
+
+    const char* mEnabledToggles[1] = {"null_backend_async_pipeline_creation"};
+    wgpu::DawnTogglesDescriptor mTogglesDesc = [this] {
+        wgpu::DawnTogglesDescriptor togglesDesc = {};
+        togglesDesc.enabledToggles = mEnabledToggles;
+        togglesDesc.enabledToggleCount = 1;
+        return togglesDesc;
+    }();
+};
+
+BENCHMARK_TEMPLATE_DEFINE_F(AsyncPipelineCreation, ThreadPerTask, ThreadPerTaskPool)
+(benchmark::State& state) {
+    CreateComputePipelineBurst(state);
+}
+BENCHMARK_REGISTER_F(AsyncPipelineCreation, ThreadPerTask)->Arg(1)->Arg(16)->Arg(256)->UseRealTime();
+
+BENCHMARK_TEMPLATE_DEFINE_F(AsyncPipelineCreation, WorkStealing, platform::AsyncWorkerThreadPool)
+(benchmark::State& state) {
+    CreateComputePipelineBurst(state);
+}
+BENCHMARK_REGISTER_F(AsyncPipelineCreation, WorkStealing)->Arg(1)->Arg(16)->Arg(256)->UseRealTime();
+
+}  // namespace
+}  // namespace dawn
@@ -0,0 +1,160 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/SystemUtils.h"
+#include "dawn/dawn_proc.h"
+#include "dawn/native/DawnNative.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+constexpr char kShader[] = R"(
+    @group(0) @binding(0) var<storage, read_write> data : array<vec4f>;
+
+    fn hash(v : vec4u) -> vec4u {
+        var x = v * 1664525u + 1013904223u;
+        x = x ^ (x >> vec4u(16u));
+        return x * 747796405u;
+    }
+
+    @compute @workgroup_size(64) fn main(@builtin(global_invocation_id) id : vec3u) {
+        var v = data[id.x];
+        for (var i = 0u; i < 16u; i++) {
+            v = vec4f(hash(bitcast<vec4u>(v) + vec4u(i))) * 0.5 + sin(v) * cos(v.yzwx);
+        }
+        data[id.x] = normalize(v) + fract(v * 3.0);
+    }
+)";
+
+dawn::native::Instance* GetInstance() {
+    static std::unique_ptr<dawn::native::Instance> instance = [] {
+        dawnProcSetProcs(&dawn::native::GetProcs());
+        return std::make_unique<dawn::native::Instance>();
+    }();
+    return instance.get();
+}
+
+std::string GetCacheDirectory() {
+    return GetExecutableDirectory().value_or("") + "dawn_blob_cache_benchmark";
+}
+
+void ClearCacheDirectory(const std::string& directory) {
+    // The files created by dawn::native::FileBlobCache.
+    for (const char* extension : {".index", ".pack"}) {
+        std::remove((directory + GetPathSeparator() + "dawn_blob_cache" + extension).c_str());
+    }
+}
+
+// Benchmarks for the startup of a device with a persistent blob cache: the time to create the
+// device and a compute pipeline with an empty (cold) or populated (warm) cache directory.
+class BlobCacheStartup : public benchmark::Fixture {
+  protected:
+    void Run(benchmark::State& state, wgpu::BackendType backendType, bool warm) {
+        wgpu::RequestAdapterOptions options = {};
+        options.backendType = backendType;
+        // Use SwiftShader for the Vulkan backend so that the results don't depend on the GPU.
+        options.forceFallbackAdapter = backendType != wgpu::BackendType::Null;
+        std::vector<dawn::native::Adapter> adapters = GetInstance()->EnumerateAdapters(&options);
+        if (adapters.empty()) {
+            state.SkipWithError("The adapter isn't available.");
+            return;
+        }
+        wgpu::Adapter adapter(adapters[0].Get());
+
+        std::string directory = GetCacheDirectory();
+        ClearCacheDirectory(directory);
+        if (warm) {
+            CreateDeviceAndPipeline(adapter, directory);
+        }
+
+        for (auto _ : state) {
+            if (!warm) {
+                state.PauseTiming();
+                ClearCacheDirectory(directory);
+                state.ResumeTiming();
+            }
+            CreateDeviceAndPipeline(adapter, directory);
+        }
+        ClearCacheDirectory(directory);
+    }
+
+  private:
+    void CreateDeviceAndPipeline(const wgpu::Adapter& adapter, const std::string& directory) {
+        wgpu::DawnCacheDeviceDescriptor cacheDesc = {};
+        cacheDesc.cacheDirectory = directory.c_str();
+
+        wgpu::DeviceDescriptor deviceDesc = {};
+        deviceDesc.nextInChain = &cacheDesc;
+        wgpu::Device device;
+        adapter.RequestDevice(
+            &deviceDesc, wgpu::CallbackMode::AllowSpontaneous,
+            [&device](wgpu::RequestDeviceStatus status, wgpu::Device result, const char*) {
+                DAWN_ASSERT(status == wgpu::RequestDeviceStatus::Success);
+                device = std::move(result);
+            });
+        DAWN_ASSERT(device != nullptr);
+
+        wgpu::ComputePipelineDescriptor computeDesc = {};
+        computeDesc.compute.module = utils::CreateShaderModule(device, kShader);
+        wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&computeDesc);
+        benchmark::DoNotOptimize(pipeline.Get());
+        // The index of the cache is written when the device is released at the end of the scope.
+    }
+};
+
+BENCHMARK_DEFINE_F(BlobCacheStartup, NullCold)(benchmark::State& state) {
+    Run(state, wgpu::BackendType::Null, false);
+}
+BENCHMARK_REGISTER_F(BlobCacheStartup, NullCold)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(BlobCacheStartup, NullWarm)(benchmark::State& state) {
+    Run(state, wgpu::BackendType::Null, true);
+}
+BENCHMARK_REGISTER_F(BlobCacheStartup, NullWarm)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(BlobCacheStartup, SwiftShaderCold)(benchmark::State& state) {
+    Run(state, wgpu::BackendType::Vulkan, false);
+}
+BENCHMARK_REGISTER_F(BlobCacheStartup, SwiftShaderCold)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(BlobCacheStartup, SwiftShaderWarm)(benchmark::State& state) {
+    Run(state, wgpu::BackendType::Vulkan, true);
+}
+BENCHMARK_REGISTER_F(BlobCacheStartup, SwiftShaderWarm)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace dawn
@@ -0,0 +1,94 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+
+#include "dawn/native/CommandAllocator.h"
+#include "dawn/native/Device.h"
+#include "dawn/tests/benchmarks/NullDeviceSetup.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+// Encodes and submits frames of draw calls like DrawCallPerf, and reports how many command
+// blocks are allocated per frame and how many of them come from the device's CommandBlockPool.
+class CommandEncoding : public NullDeviceBenchmarkFixture {
+  private:
+    wgpu::DeviceDescriptor GetDeviceDescriptor() const override { return {}; }
+};
+
+BENCHMARK_DEFINE_F(CommandEncoding, DrawsPerFrame)
+(benchmark::State& state) {
+    utils::ComboRenderPipelineDescriptor pipelineDesc;
+    pipelineDesc.vertex.module = utils::CreateShaderModule(device, R"(
+        @vertex fn main() -> @builtin(position) vec4f {
+            return vec4f(0.0, 0.0, 0.0, 1.0);
+        })");
+    pipelineDesc.cFragment.module = utils::CreateShaderModule(device, R"(
+        @fragment fn main() -> @location(0) vec4f {
+            return vec4f(0.0, 1.0, 0.0, 1.0);
+        })");
+    wgpu::RenderPipeline pipeline = device.CreateRenderPipeline(&pipelineDesc);
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 4, 4);
+    wgpu::Queue queue = device.GetQueue();
+
+    native::CommandBlockPool* pool = native::FromAPI(device.Get())->GetCommandBlockPool();
+    native::CommandBlockPool::Stats before = pool->GetStats();
+
+    const int64_t drawCount = state.range(0);
+    for (auto _ : state) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        pass.SetPipeline(pipeline);
+        for (int64_t i = 0; i < drawCount; ++i) {
+            pass.Draw(3, 1, i, 0);
+        }
+        pass.End();
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+    }
+
+    native::CommandBlockPool::Stats after = pool->GetStats();
+    double frames = state.iterations();
+    double blocks = after.allocationCount - before.allocationCount;
+    double reused = after.reuseCount - before.reuseCount;
+    state.counters["blocks_per_frame"] = blocks / frames;
+    state.counters["heap_blocks_per_frame"] = (blocks - reused) / frames;
+    state.counters["reuse_rate"] = blocks > 0 ? reused / blocks : 0.0;
+    state.SetItemsProcessed(state.iterations() * drawCount);
+}
+BENCHMARK_REGISTER_F(CommandEncoding, DrawsPerFrame)
+    ->ArgName("draws")
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000);
+
+}  // namespace
+}  // namespace dawn
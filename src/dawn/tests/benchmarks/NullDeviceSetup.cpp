@@ -29,6 +29,7 @@
 
 #include <benchmark/benchmark.h>
 #include <dawn/webgpu_cpp.h>
+#include <map>
 #include <memory>
 #include <utility>
 
@@ -38,18 +39,43 @@
 #include "dawn/native/DawnNative.h"
 
 namespace dawn {
+namespace {
 
-void NullDeviceBenchmarkFixture::SetUp(const benchmark::State& state) {
+dawn::native::Instance* GetOrCreateInstance(dawn::platform::Platform* platform) {
     // Static initialization that only happens on the first time that a fixture is created.
-    static std::unique_ptr<dawn::native::Instance> nativeInstance = []() {
+    static std::mutex mutex;
+    static std::map<dawn::platform::Platform*, std::unique_ptr<dawn::native::Instance>> instances;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (instances.empty()) {
         dawnProcSetProcs(&dawn::native::GetProcs());
-        return std::make_unique<dawn::native::Instance>();
-    }();
+    }
 
+    std::unique_ptr<dawn::native::Instance>& instance = instances[platform];
+    if (instance == nullptr) {
+        dawn::native::DawnInstanceDescriptor dawnInstanceDesc;
+        dawnInstanceDesc.platform = platform;
+
+        wgpu::InstanceDescriptor instanceDesc = {};
+        instanceDesc.nextInChain = &dawnInstanceDesc;
+        instance = std::make_unique<dawn::native::Instance>(
+            reinterpret_cast<const WGPUInstanceDescriptor*>(&instanceDesc));
+    }
+    return instance.get();
+}
+
+}  // anonymous namespace
+
+dawn::platform::Platform* NullDeviceBenchmarkFixture::GetPlatform() const {
+    return nullptr;
+}
+
+void NullDeviceBenchmarkFixture::SetUp(const benchmark::State& state) {
     if (state.thread_index() == 0) {
         // Only thread 0 is responsible for initializing the device on each iteration.
         {
             std::lock_guard<std::mutex> lock(mMutex);
+            dawn::native::Instance* nativeInstance = GetOrCreateInstance(GetPlatform());
 
             // Get an adapter to create the device with.
             wgpu::RequestAdapterOptions options = {};
@@ -37,6 +37,10 @@ namespace wgpu {
 struct DeviceDescriptor;
 }  // namespace wgpu
 
+namespace dawn::platform {
+class Platform;
+}  // namespace dawn::platform
+
 namespace dawn {
 
 class NullDeviceBenchmarkFixture : public benchmark::Fixture {
@@ -50,6 +54,9 @@ class NullDeviceBenchmarkFixture : public benchmark::Fixture {
 
   private:
     virtual wgpu::DeviceDescriptor GetDeviceDescriptor() const = 0;
+    // The platform used by the instance that creates the device. Instances are shared between all
+    // the fixtures using the same platform.
+    virtual dawn::platform::Platform* GetPlatform() const;
 
     // Lock and conditional variable used to synchronize the benchmark global adapter/device.
     std::mutex mMutex;
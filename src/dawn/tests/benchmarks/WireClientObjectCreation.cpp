@@ -0,0 +1,101 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+#include <vector>
+
+#include "dawn/tests/benchmarks/WireNullDeviceSetup.h"
+
+namespace dawn {
+namespace {
+
+// Creates a burst of objects with `create` and then releases them all. Only the work on the
+// client is measured: the server handles the commands while the timing is paused.
+template <typename T, typename F>
+void CreateAndReleaseBursts(benchmark::State& state, WireNullDevice* wire, F create) {
+    const int64_t burstSize = state.range(0);
+    std::vector<T> objects;
+    objects.reserve(burstSize);
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < burstSize; ++i) {
+            objects.push_back(create());
+        }
+        objects.clear();
+
+        state.PauseTiming();
+        wire->Flush();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * burstSize);
+}
+
+void BM_WireClientBufferCreateRelease(benchmark::State& state) {
+    WireNullDevice wire;
+
+    wgpu::BufferDescriptor desc;
+    desc.size = 4;
+    desc.usage = wgpu::BufferUsage::Uniform;
+
+    CreateAndReleaseBursts<wgpu::Buffer>(state, &wire,
+                                         [&] { return wire.device.CreateBuffer(&desc); });
+}
+BENCHMARK(BM_WireClientBufferCreateRelease)->ArgName("burst")->Arg(64)->Arg(4096);
+
+void BM_WireClientBindGroupCreateRelease(benchmark::State& state) {
+    WireNullDevice wire;
+
+    wgpu::BindGroupLayoutEntry layoutEntry;
+    layoutEntry.binding = 0;
+    layoutEntry.visibility = wgpu::ShaderStage::Fragment;
+    layoutEntry.buffer.type = wgpu::BufferBindingType::Uniform;
+    wgpu::BindGroupLayoutDescriptor layoutDesc;
+    layoutDesc.entryCount = 1;
+    layoutDesc.entries = &layoutEntry;
+    wgpu::BindGroupLayout layout = wire.device.CreateBindGroupLayout(&layoutDesc);
+
+    wgpu::BufferDescriptor bufferDesc;
+    bufferDesc.size = 4;
+    bufferDesc.usage = wgpu::BufferUsage::Uniform;
+    wgpu::Buffer buffer = wire.device.CreateBuffer(&bufferDesc);
+
+    wgpu::BindGroupEntry entry;
+    entry.binding = 0;
+    entry.buffer = buffer;
+    wgpu::BindGroupDescriptor desc;
+    desc.layout = layout;
+    desc.entryCount = 1;
+    desc.entries = &entry;
+
+    CreateAndReleaseBursts<wgpu::BindGroup>(state, &wire,
+                                            [&] { return wire.device.CreateBindGroup(&desc); });
+}
+BENCHMARK(BM_WireClientBindGroupCreateRelease)->ArgName("burst")->Arg(64)->Arg(4096);
+
+}  // namespace
+}  // namespace dawn
@@ -0,0 +1,98 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/wire/BufferConsumer.h"
+#include "dawn/wire/WireCmd_autogen.h"
+#include "dawn/wire/WireDeserializeAllocator.h"
+
+namespace dawn::wire {
+namespace {
+
+// Serializes a compilation info with `messageCount` messages. Its arrays of structures and
+// strings are deserialized into the allocator like those of large bind group and pipeline
+// descriptors, but it doesn't reference any object so it can be deserialized without a server.
+std::vector<char> SerializeCompilationInfo(size_t messageCount) {
+    std::vector<std::string> strings(messageCount);
+    std::vector<WGPUCompilationMessage> messages(messageCount);
+    for (size_t i = 0; i < messageCount; ++i) {
+        strings[i] = "error: unresolved identifier 'value" + std::to_string(i) + "'";
+        messages[i] = {};
+        messages[i].message = strings[i].c_str();
+        messages[i].type = WGPUCompilationMessageType_Error;
+        messages[i].lineNum = i;
+    }
+
+    WGPUCompilationInfo info = {};
+    info.messageCount = messageCount;
+    info.messages = messages.data();
+
+    ReturnShaderModuleGetCompilationInfoCallbackCmd cmd = {};
+    cmd.status = WGPUCompilationInfoRequestStatus_Success;
+    cmd.info = &info;
+
+    size_t size = cmd.GetRequiredSize();
+    std::vector<char> data(size);
+    SerializeBuffer serializeBuffer(data.data(), size);
+    WireResult result = cmd.Serialize(size, &serializeBuffer);
+    DAWN_ASSERT(result == WireResult::Success);
+    return data;
+}
+
+// Deserializes the same command repeatedly, resetting the allocator after each command like the
+// wire does.
+void BM_WireDeserializeCompilationInfo(benchmark::State& state) {
+    std::vector<char> data = SerializeCompilationInfo(state.range(0));
+    WireDeserializeAllocator allocator;
+
+    for (auto _ : state) {
+        DeserializeBuffer deserializeBuffer(data.data(), data.size());
+        ReturnShaderModuleGetCompilationInfoCallbackCmd cmd;
+        WireResult result = cmd.Deserialize(&deserializeBuffer, &allocator);
+        DAWN_ASSERT(result == WireResult::Success);
+        benchmark::DoNotOptimize(cmd.info);
+        allocator.Reset();
+    }
+
+    const WireDeserializeAllocator::Stats& stats = allocator.GetStats();
+    state.SetBytesProcessed(state.iterations() * data.size());
+    state.counters["bytes_per_command"] = double(stats.allocatedBytes) / stats.commandCount;
+    state.counters["overflow_rate"] = double(stats.overflowCount) / stats.commandCount;
+    state.counters["chunk_allocations"] = stats.chunkAllocationCount;
+}
+BENCHMARK(BM_WireDeserializeCompilationInfo)
+    ->ArgName("messages")
+    ->Arg(4)
+    ->Arg(64)
+    ->Arg(1024);
+
+}  // anonymous namespace
+}  // namespace dawn::wire
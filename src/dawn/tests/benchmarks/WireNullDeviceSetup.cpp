@@ -0,0 +1,120 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/tests/benchmarks/WireNullDeviceSetup.h"
+
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/dawn_proc.h"
+#include "dawn/native/DawnNative.h"
+#include "dawn/utils/TerribleCommandBuffer.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+namespace dawn {
+
+// Counts the bytes of the commands sent by the wire client before handing them to the server.
+class ByteCountingHandler : public dawn::wire::CommandHandler {
+  public:
+    explicit ByteCountingHandler(dawn::wire::CommandHandler* handler) : mHandler(handler) {}
+
+    const volatile char* HandleCommands(const volatile char* commands, size_t size) override {
+        mByteCount += size;
+        return mHandler->HandleCommands(commands, size);
+    }
+
+    uint64_t mByteCount = 0;
+
+  private:
+    dawn::wire::CommandHandler* mHandler;
+};
+
+WireNullDevice::WireNullDevice(bool enableRenderPassCommandBatching)
+    : mNativeInstance(std::make_unique<dawn::native::Instance>()),
+      mS2cBuf(std::make_unique<utils::TerribleCommandBuffer>()) {
+    const DawnProcTable& nativeProcs = dawn::native::GetProcs();
+
+    dawn::wire::WireServerDescriptor serverDesc = {};
+    serverDesc.procs = &nativeProcs;
+    serverDesc.serializer = mS2cBuf.get();
+    mWireServer = std::make_unique<dawn::wire::WireServer>(serverDesc);
+    mByteCounter = std::make_unique<ByteCountingHandler>(mWireServer.get());
+    mC2sBuf = std::make_unique<utils::TerribleCommandBuffer>(mByteCounter.get());
+
+    dawn::wire::WireClientDescriptor clientDesc = {};
+    clientDesc.serializer = mC2sBuf.get();
+    clientDesc.enableRenderPassCommandBatching = enableRenderPassCommandBatching;
+    mWireClient = std::make_unique<dawn::wire::WireClient>(clientDesc);
+    mS2cBuf->SetHandler(mWireClient.get());
+    dawnProcSetProcs(&dawn::wire::client::GetProcs());
+
+    auto reserved = mWireClient->ReserveInstance();
+    mWireServer->InjectInstance(mNativeInstance->Get(), reserved.handle);
+    instance = wgpu::Instance::Acquire(reserved.instance);
+
+    wgpu::RequestAdapterOptions options = {};
+    options.backendType = wgpu::BackendType::Null;
+    instance.RequestAdapter(
+        &options, wgpu::CallbackMode::AllowSpontaneous,
+        [this](wgpu::RequestAdapterStatus status, wgpu::Adapter result, const char*) {
+            DAWN_ASSERT(status == wgpu::RequestAdapterStatus::Success);
+            adapter = std::move(result);
+        });
+    Flush();
+    DAWN_ASSERT(adapter != nullptr);
+
+    adapter.RequestDevice(
+        nullptr, wgpu::CallbackMode::AllowSpontaneous,
+        [this](wgpu::RequestDeviceStatus status, wgpu::Device result, const char*) {
+            DAWN_ASSERT(status == wgpu::RequestDeviceStatus::Success);
+            device = std::move(result);
+        });
+    Flush();
+    DAWN_ASSERT(device != nullptr);
+}
+
+WireNullDevice::~WireNullDevice() {
+    device = nullptr;
+    adapter = nullptr;
+    instance = nullptr;
+    Flush();
+    mWireClient = nullptr;
+    mWireServer = nullptr;
+    dawnProcSetProcs(&dawn::native::GetProcs());
+}
+
+void WireNullDevice::Flush() {
+    mC2sBuf->Flush();
+    mS2cBuf->Flush();
+}
+
+uint64_t WireNullDevice::GetSentByteCount() const {
+    return mByteCounter->mByteCount;
+}
+
+}  // namespace dawn
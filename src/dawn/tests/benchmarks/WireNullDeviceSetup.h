@@ -0,0 +1,79 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_TESTS_BENCHMARKS_WIRENULLDEVICESETUP_H_
+#define SRC_DAWN_TESTS_BENCHMARKS_WIRENULLDEVICESETUP_H_
+
+#include <dawn/webgpu_cpp.h>
+#include <memory>
+
+namespace dawn::native {
+class Instance;
+}  // namespace dawn::native
+
+namespace dawn::utils {
+class TerribleCommandBuffer;
+}  // namespace dawn::utils
+
+namespace dawn::wire {
+class WireClient;
+class WireServer;
+}  // namespace dawn::wire
+
+namespace dawn {
+
+class ByteCountingHandler;
+
+// A wire client and server running on the same thread, with the server on a Null device. The
+// wgpu procs are pointed at the wire client while it is alive.
+class WireNullDevice {
+  public:
+    explicit WireNullDevice(bool enableRenderPassCommandBatching = false);
+    ~WireNullDevice();
+
+    // Sends the commands of the client to the server and the replies of the server back.
+    void Flush();
+
+    // The number of bytes of commands sent by the client so far.
+    uint64_t GetSentByteCount() const;
+
+    wgpu::Instance instance;
+    wgpu::Adapter adapter;
+    wgpu::Device device;
+
+  private:
+    std::unique_ptr<dawn::native::Instance> mNativeInstance;
+    std::unique_ptr<utils::TerribleCommandBuffer> mS2cBuf;
+    std::unique_ptr<dawn::wire::WireServer> mWireServer;
+    std::unique_ptr<ByteCountingHandler> mByteCounter;
+    std::unique_ptr<utils::TerribleCommandBuffer> mC2sBuf;
+    std::unique_ptr<dawn::wire::WireClient> mWireClient;
+};
+
+}  // namespace dawn
+
+#endif  // SRC_DAWN_TESTS_BENCHMARKS_WIRENULLDEVICESETUP_H_
@@ -0,0 +1,125 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+#include <vector>
+
+#include "dawn/tests/benchmarks/WireNullDeviceSetup.h"
+
+namespace dawn {
+namespace {
+
+// Objects are created and destroyed in batches, and the wire is flushed after each batch like it
+// would be once per frame.
+constexpr int64_t kObjectsPerFlush = 64;
+constexpr int64_t kLookupsPerFlush = 256;
+
+std::vector<wgpu::Buffer> CreateBuffers(const wgpu::Device& device, int64_t count) {
+    wgpu::BufferDescriptor desc;
+    desc.size = 4;
+    desc.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+
+    std::vector<wgpu::Buffer> buffers;
+    buffers.reserve(count);
+    for (int64_t i = 0; i < count; ++i) {
+        buffers.push_back(device.CreateBuffer(&desc));
+    }
+    return buffers;
+}
+
+// Creates and destroys buffers while a number of other buffers are alive.
+void BM_WireBufferChurn(benchmark::State& state) {
+    WireNullDevice wire;
+    std::vector<wgpu::Buffer> liveBuffers = CreateBuffers(wire.device, state.range(0));
+    wire.Flush();
+
+    for (auto _ : state) {
+        std::vector<wgpu::Buffer> buffers = CreateBuffers(wire.device, kObjectsPerFlush);
+        buffers.clear();
+        wire.Flush();
+    }
+    state.SetItemsProcessed(state.iterations() * kObjectsPerFlush);
+}
+BENCHMARK(BM_WireBufferChurn)->ArgName("live")->Arg(0)->Arg(16 * 1024)->Arg(64 * 1024);
+
+// Creates and destroys textures and their views while a number of other textures are alive.
+void BM_WireTextureChurn(benchmark::State& state) {
+    WireNullDevice wire;
+
+    wgpu::TextureDescriptor desc;
+    desc.size = {1, 1, 1};
+    desc.format = wgpu::TextureFormat::RGBA8Unorm;
+    desc.usage = wgpu::TextureUsage::TextureBinding;
+
+    std::vector<wgpu::Texture> liveTextures;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        liveTextures.push_back(wire.device.CreateTexture(&desc));
+    }
+    wire.Flush();
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < kObjectsPerFlush; ++i) {
+            wgpu::Texture texture = wire.device.CreateTexture(&desc);
+            wgpu::TextureView view = texture.CreateView();
+        }
+        wire.Flush();
+    }
+    state.SetItemsProcessed(state.iterations() * kObjectsPerFlush);
+}
+BENCHMARK(BM_WireTextureChurn)->ArgName("live")->Arg(0)->Arg(16 * 1024)->Arg(64 * 1024);
+
+// Encodes commands referencing buffers scattered among a number of live buffers, which stresses
+// the lookup of the objects in the server.
+void BM_WireObjectLookup(benchmark::State& state) {
+    WireNullDevice wire;
+    std::vector<wgpu::Buffer> buffers = CreateBuffers(wire.device, state.range(0));
+    wire.Flush();
+
+    // A fixed pseudo-random sequence of buffer indices.
+    std::vector<size_t> indices(2 * kLookupsPerFlush);
+    uint32_t seed = 1;
+    for (size_t& index : indices) {
+        seed = seed * 1664525u + 1013904223u;
+        index = seed % buffers.size();
+    }
+
+    for (auto _ : state) {
+        wgpu::CommandEncoder encoder = wire.device.CreateCommandEncoder();
+        for (int64_t i = 0; i < kLookupsPerFlush; ++i) {
+            encoder.CopyBufferToBuffer(buffers[indices[2 * i]], 0, buffers[indices[2 * i + 1]], 0,
+                                       4);
+        }
+        wgpu::CommandBuffer commands = encoder.Finish();
+        wire.Flush();
+    }
+    state.SetItemsProcessed(state.iterations() * kLookupsPerFlush * 2);
+}
+BENCHMARK(BM_WireObjectLookup)->ArgName("live")->Arg(1024)->Arg(16 * 1024)->Arg(64 * 1024);
+
+}  // namespace
+}  // namespace dawn
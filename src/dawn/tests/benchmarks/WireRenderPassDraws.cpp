@@ -0,0 +1,111 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+#include <array>
+
+#include "dawn/tests/benchmarks/WireNullDeviceSetup.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+constexpr uint32_t kDrawsPerPass = 1000;
+constexpr uint32_t kBindGroupCount = 16;
+
+// Encodes render passes where every draw sets its whole state like a simple renderer would, with
+// the pipeline and vertex buffer shared by all draws and a bind group per object.
+void BM_WireRenderPassDraws(benchmark::State& state) {
+    WireNullDevice wire(state.range(0) != 0);
+    const wgpu::Device& device = wire.device;
+
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, R"(
+        @group(0) @binding(0) var<uniform> offset : vec4f;
+
+        @vertex fn vs(@location(0) position : vec4f) -> @builtin(position) vec4f {
+            return position + offset;
+        }
+
+        @fragment fn fs() -> @location(0) vec4f {
+            return vec4f(1.0);
+        })");
+
+    utils::ComboRenderPipelineDescriptor pipelineDesc;
+    pipelineDesc.vertex.module = module;
+    pipelineDesc.vertex.bufferCount = 1;
+    pipelineDesc.cBuffers[0].arrayStride = 4 * sizeof(float);
+    pipelineDesc.cBuffers[0].attributeCount = 1;
+    pipelineDesc.cAttributes[0].format = wgpu::VertexFormat::Float32x4;
+    pipelineDesc.cFragment.module = module;
+    pipelineDesc.cTargets[0].format = utils::BasicRenderPass::kDefaultColorFormat;
+    wgpu::RenderPipeline pipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+    wgpu::BufferDescriptor vertexBufferDesc;
+    vertexBufferDesc.size = 3 * 4 * sizeof(float);
+    vertexBufferDesc.usage = wgpu::BufferUsage::Vertex;
+    wgpu::Buffer vertexBuffer = device.CreateBuffer(&vertexBufferDesc);
+
+    wgpu::BufferDescriptor uniformBufferDesc;
+    uniformBufferDesc.size = kBindGroupCount * 256;
+    uniformBufferDesc.usage = wgpu::BufferUsage::Uniform;
+    wgpu::Buffer uniformBuffer = device.CreateBuffer(&uniformBufferDesc);
+
+    std::array<wgpu::BindGroup, kBindGroupCount> bindGroups;
+    for (uint32_t i = 0; i < kBindGroupCount; ++i) {
+        bindGroups[i] = utils::MakeBindGroup(device, pipeline.GetBindGroupLayout(0),
+                                             {{0, uniformBuffer, i * 256, 4 * sizeof(float)}});
+    }
+
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 1, 1);
+    wire.Flush();
+
+    uint64_t startByteCount = wire.GetSentByteCount();
+    for (auto _ : state) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        for (uint32_t i = 0; i < kDrawsPerPass; ++i) {
+            pass.SetPipeline(pipeline);
+            pass.SetVertexBuffer(0, vertexBuffer);
+            pass.SetBindGroup(0, bindGroups[i % kBindGroupCount]);
+            pass.Draw(3, 1, 0, i);
+        }
+        pass.End();
+        wgpu::CommandBuffer commands = encoder.Finish();
+        wire.Flush();
+    }
+
+    uint64_t drawCount = state.iterations() * kDrawsPerPass;
+    state.SetItemsProcessed(drawCount);
+    state.counters["bytes_per_draw"] =
+        static_cast<double>(wire.GetSentByteCount() - startByteCount) / drawCount;
+}
+BENCHMARK(BM_WireRenderPassDraws)->ArgName("batching")->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace dawn
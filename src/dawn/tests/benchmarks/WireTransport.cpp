@@ -0,0 +1,106 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "dawn/utils/SharedMemoryCommandBuffer.h"
+#include "dawn/utils/TerribleCommandBuffer.h"
+
+namespace dawn {
+namespace {
+
+// The commands are flushed in batches like the wire client does once per frame.
+constexpr int64_t kCommandsPerFlush = 64;
+constexpr size_t kRingBufferCapacity = 16 * 1024 * 1024;
+
+// A handler that reads every command, standing in for the deserialization of the wire server.
+class CountingHandler : public dawn::wire::CommandHandler {
+  public:
+    const volatile char* HandleCommands(const volatile char* commands, size_t size) override {
+        for (size_t i = 0; i < size; i += 64) {
+            mChecksum += commands[i];
+        }
+        mByteCount += size;
+        return commands + size;
+    }
+
+    uint64_t mByteCount = 0;
+    uint64_t mChecksum = 0;
+};
+
+void SerializeCommands(benchmark::State& state, dawn::wire::CommandSerializer* serializer) {
+    const size_t commandSize = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        for (int64_t i = 0; i < kCommandsPerFlush; ++i) {
+            void* space = serializer->GetCmdSpace(commandSize);
+            memset(space, static_cast<int>(i), commandSize);
+        }
+        serializer->Flush();
+    }
+    state.SetItemsProcessed(state.iterations() * kCommandsPerFlush);
+    state.SetBytesProcessed(state.iterations() * kCommandsPerFlush * commandSize);
+}
+
+// The current in-process path: the commands are handled synchronously when they are flushed.
+void BM_InProcessTransport(benchmark::State& state) {
+    CountingHandler handler;
+    auto commandBuffer = std::make_unique<utils::TerribleCommandBuffer>(&handler);
+    SerializeCommands(state, commandBuffer.get());
+    benchmark::DoNotOptimize(handler.mChecksum);
+}
+BENCHMARK(BM_InProcessTransport)->Arg(64)->Arg(4096)->Arg(256 * 1024)->UseRealTime();
+
+// The shared memory ring buffer, with the commands handled concurrently on another thread.
+void BM_SharedMemoryTransport(benchmark::State& state) {
+    struct alignas(utils::kSharedMemoryCommandBufferAlignment) MemoryChunk {
+        char data[utils::kSharedMemoryCommandBufferAlignment];
+    };
+    size_t memorySize = utils::GetSharedMemoryCommandBufferSize(kRingBufferCapacity);
+    std::vector<MemoryChunk> memory(memorySize / sizeof(MemoryChunk));
+    utils::InitializeSharedMemoryCommandBuffer(memory.data(), memorySize);
+
+    CountingHandler handler;
+    std::thread receiverThread([&] {
+        utils::SharedMemoryCommandReceiver receiver(memory.data(), memorySize);
+        while (receiver.HandleCommands(&handler)) {
+        }
+    });
+
+    utils::SharedMemoryCommandSerializer serializer(memory.data(), memorySize);
+    SerializeCommands(state, &serializer);
+    serializer.Close();
+    receiverThread.join();
+    benchmark::DoNotOptimize(handler.mChecksum);
+}
+BENCHMARK(BM_SharedMemoryTransport)->Arg(64)->Arg(4096)->Arg(256 * 1024)->UseRealTime();
+
+}  // namespace
+}  // namespace dawn
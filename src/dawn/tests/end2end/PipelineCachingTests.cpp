@@ -111,21 +111,34 @@ static constexpr std::string_view kFragmentShaderBindGroup01Uniform = R"(
 
 class PipelineCachingTests : public DawnTest {
   protected:
+    void SetUp() override {
+        DawnTest::SetUp();
+        // The lowered Tint IR of a shader stage is cached in its own blob when SPIR-V is generated
+        // from the IR. It is only looked up when the SPIR-V itself misses the cache.
+        counts.loweredIR = IsVulkan() && HasToggleEnabled("use_tint_ir") ? 1u : 0u;
+    }
+
     std::unique_ptr<platform::Platform> CreateTestPlatform() override {
-        return std::make_unique<DawnCachingMockPlatform>(&mMockCache);
+        auto platform = std::make_unique<DawnCachingMockPlatform>(&mMockCache);
+        mMockPlatform = platform.get();
+        return platform;
     }
 
     struct EntryCounts {
         unsigned pipeline;
         unsigned shaderModule;
+        unsigned loweredIR;
     };
-    const EntryCounts counts = {
+    EntryCounts counts = {
         // pipeline caching is only implemented on D3D12/Vulkan
         IsD3D12() || IsVulkan() ? 1u : 0u,
         // One blob per shader module
         1u,
+        // Set in SetUp() as it depends on the device toggles.
+        0u,
     };
     NiceMock<CachingInterfaceMock> mMockCache;
+    raw_ptr<DawnCachingMockPlatform> mMockPlatform = nullptr;
 };
 
 class SinglePipelineCachingTests : public PipelineCachingTests {};
@@ -165,7 +178,8 @@ TEST_P(SinglePipelineCachingTests, ComputePipelineFrontedCache) {
 
     // First creation should create a cache entry.
     wgpu::ComputePipeline pipeline;
-    EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(counts.shaderModule + counts.pipeline),
+    EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                       Add(counts.shaderModule + counts.loweredIR + counts.pipeline),
                        pipeline = device.CreateComputePipeline(&desc));
 
     // Second creation on the same device should just return from frontend cache and should not
@@ -187,7 +201,8 @@ TEST_P(SinglePipelineCachingTests, ComputePipelineBlobCache) {
         wgpu::ComputePipelineDescriptor desc;
         desc.compute.module = utils::CreateShaderModule(device, kComputeShaderDefault.data());
         desc.compute.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(counts.shaderModule + counts.loweredIR + counts.pipeline),
                            device.CreateComputePipeline(&desc));
     }
 
@@ -211,7 +226,8 @@ TEST_P(SinglePipelineCachingTests, ComputePipelineBlobCacheExplictLayout) {
         wgpu::ComputePipelineDescriptor desc;
         desc.compute.module = utils::CreateShaderModule(device, kComputeShaderDefault.data());
         desc.compute.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(counts.shaderModule + counts.loweredIR + counts.pipeline),
                            device.CreateComputePipeline(&desc));
     }
 
@@ -235,7 +251,8 @@ TEST_P(SinglePipelineCachingTests, ComputePipelineBlobCacheShaderNegativeCases)
         wgpu::ComputePipelineDescriptor desc;
         desc.compute.module = utils::CreateShaderModule(device, kComputeShaderDefault.data());
         desc.compute.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(counts.shaderModule + counts.loweredIR + counts.pipeline),
                            device.CreateComputePipeline(&desc));
     }
 
@@ -246,7 +263,8 @@ TEST_P(SinglePipelineCachingTests, ComputePipelineBlobCacheShaderNegativeCases)
         desc.compute.module =
             utils::CreateShaderModule(device, kComputeShaderMultipleEntryPoints.data());
         desc.compute.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(counts.shaderModule + counts.loweredIR + counts.pipeline),
                            device.CreateComputePipeline(&desc));
     }
 
@@ -257,7 +275,8 @@ TEST_P(SinglePipelineCachingTests, ComputePipelineBlobCacheShaderNegativeCases)
         desc.compute.module =
             utils::CreateShaderModule(device, kComputeShaderMultipleEntryPoints.data());
         desc.compute.entryPoint = "main2";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(counts.shaderModule + counts.loweredIR + counts.pipeline),
                            device.CreateComputePipeline(&desc));
     }
 }
@@ -271,7 +290,8 @@ TEST_P(SinglePipelineCachingTests, ComputePipelineBlobCacheIsolationKey) {
         wgpu::ComputePipelineDescriptor desc;
         desc.compute.module = utils::CreateShaderModule(device, kComputeShaderDefault.data());
         desc.compute.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(counts.shaderModule + counts.loweredIR + counts.pipeline),
                            device.CreateComputePipeline(&desc));
     }
 
@@ -281,7 +301,8 @@ TEST_P(SinglePipelineCachingTests, ComputePipelineBlobCacheIsolationKey) {
         wgpu::ComputePipelineDescriptor desc;
         desc.compute.module = utils::CreateShaderModule(device, kComputeShaderDefault.data());
         desc.compute.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(counts.shaderModule + counts.loweredIR + counts.pipeline),
                            device.CreateComputePipeline(&desc));
     }
 }
@@ -327,7 +348,8 @@ TEST_P(SinglePipelineCachingTests, RenderPipelineFrontedCache) {
 
     // First creation should create a cache entry.
     wgpu::RenderPipeline pipeline;
-    EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(2 * counts.shaderModule + counts.pipeline),
+    EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                       Add(2 * (counts.shaderModule + counts.loweredIR) + counts.pipeline),
                        pipeline = device.CreateRenderPipeline(&desc));
 
     // Second creation on the same device should just return from frontend cache and should not
@@ -351,7 +373,8 @@ TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCache) {
         desc.vertex.entryPoint = "main";
         desc.cFragment.module = utils::CreateShaderModule(device, kFragmentShaderDefault.data());
         desc.cFragment.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(2 * counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(2 * (counts.shaderModule + counts.loweredIR) + counts.pipeline),
                            device.CreateRenderPipeline(&desc));
     }
 
@@ -379,7 +402,8 @@ TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCacheExplictLayout) {
         desc.vertex.entryPoint = "main";
         desc.cFragment.module = utils::CreateShaderModule(device, kFragmentShaderDefault.data());
         desc.cFragment.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(2 * counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(2 * (counts.shaderModule + counts.loweredIR) + counts.pipeline),
                            device.CreateRenderPipeline(&desc));
     }
 
@@ -408,7 +432,8 @@ TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCacheDescriptorNegativeCase
         desc.vertex.entryPoint = "main";
         desc.cFragment.module = utils::CreateShaderModule(device, kFragmentShaderDefault.data());
         desc.cFragment.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(2 * counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(2 * (counts.shaderModule + counts.loweredIR) + counts.pipeline),
                            device.CreateRenderPipeline(&desc));
     }
 
@@ -437,7 +462,8 @@ TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCacheShaderNegativeCases) {
         desc.vertex.entryPoint = "main";
         desc.cFragment.module = utils::CreateShaderModule(device, kFragmentShaderDefault.data());
         desc.cFragment.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(2 * counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(2 * (counts.shaderModule + counts.loweredIR) + counts.pipeline),
                            device.CreateRenderPipeline(&desc));
     }
 
@@ -452,7 +478,7 @@ TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCacheShaderNegativeCases) {
         desc.cFragment.module = utils::CreateShaderModule(device, kFragmentShaderDefault.data());
         desc.cFragment.entryPoint = "main";
         EXPECT_CACHE_STATS(mMockCache, Hit(counts.shaderModule),
-                           Add(counts.shaderModule + counts.pipeline),
+                           Add(counts.shaderModule + counts.loweredIR + counts.pipeline),
                            device.CreateRenderPipeline(&desc));
     }
 
@@ -467,7 +493,7 @@ TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCacheShaderNegativeCases) {
         desc.cFragment.module = utils::CreateShaderModule(device, kFragmentShaderDefault.data());
         desc.cFragment.entryPoint = "main";
         EXPECT_CACHE_STATS(mMockCache, Hit(counts.shaderModule),
-                           Add(counts.shaderModule + counts.pipeline),
+                           Add(counts.shaderModule + counts.loweredIR + counts.pipeline),
                            device.CreateRenderPipeline(&desc));
     }
 }
@@ -491,7 +517,8 @@ TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCacheNegativeCasesFragmentC
         desc.cFragment.module =
             utils::CreateShaderModule(device, kFragmentShaderMultipleOutput.data());
         desc.cFragment.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(2 * counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(2 * (counts.shaderModule + counts.loweredIR) + counts.pipeline),
                            device.CreateRenderPipeline(&desc));
     }
 
@@ -552,7 +579,8 @@ TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCacheLayout) {
                                 {0, wgpu::ShaderStage::Fragment, wgpu::BufferBindingType::Uniform},
                             }),
                     });
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(2 * counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(2 * (counts.shaderModule + counts.loweredIR) + counts.pipeline),
                            device.CreateRenderPipeline(&desc));
     }
 
@@ -626,15 +654,56 @@ TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCacheLayout) {
                     });
         if (IsMetal() || IsVulkan()) {
             EXPECT_CACHE_STATS(mMockCache, Hit(counts.shaderModule + counts.pipeline),
-                               Add(counts.shaderModule), device.CreateRenderPipeline(&desc));
+                               Add(counts.shaderModule + counts.loweredIR),
+                               device.CreateRenderPipeline(&desc));
         } else {
             EXPECT_CACHE_STATS(mMockCache, Hit(counts.shaderModule),
-                               Add(counts.shaderModule + counts.pipeline),
+                               Add(counts.shaderModule + counts.loweredIR + counts.pipeline),
                                device.CreateRenderPipeline(&desc));
         }
     }
 }
 
+// Tests that the lowered Tint IR of a shader stage is shared by pipelines that only differ in the
+// SPIR-V writer options of that stage.
+TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCacheLoweredIR) {
+    DAWN_TEST_UNSUPPORTED_IF(counts.loweredIR == 0);
+
+    static constexpr char kLoweredIRCacheHit[] = "Vulkan.CompileShaderToSPIRV.LoweredIRCacheHit";
+
+    // First time should create and write out the SPIR-V and the lowered IR of both stages.
+    {
+        wgpu::Device device = CreateDevice();
+        utils::ComboRenderPipelineDescriptor desc;
+        desc.vertex.module = utils::CreateShaderModule(device, kVertexShaderDefault.data());
+        desc.vertex.entryPoint = "main";
+        desc.cFragment.module = utils::CreateShaderModule(device, kFragmentShaderDefault.data());
+        desc.cFragment.entryPoint = "main";
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(2 * (counts.shaderModule + counts.loweredIR) + counts.pipeline),
+                           device.CreateRenderPipeline(&desc));
+        EXPECT_EQ(2u, mMockPlatform->GetHistogramBooleanCount(kLoweredIRCacheHit, false));
+        EXPECT_EQ(0u, mMockPlatform->GetHistogramBooleanCount(kLoweredIRCacheHit, true));
+    }
+
+    // The point list topology makes the SPIR-V of the vertex stage emit the point size, so it
+    // misses the cache. Its lowered IR doesn't depend on that and should hit the cache.
+    {
+        wgpu::Device device = CreateDevice();
+        utils::ComboRenderPipelineDescriptor desc;
+        desc.vertex.module = utils::CreateShaderModule(device, kVertexShaderDefault.data());
+        desc.vertex.entryPoint = "main";
+        desc.cFragment.module = utils::CreateShaderModule(device, kFragmentShaderDefault.data());
+        desc.cFragment.entryPoint = "main";
+        desc.primitive.topology = wgpu::PrimitiveTopology::PointList;
+        EXPECT_CACHE_STATS(mMockCache, Hit(counts.shaderModule + counts.loweredIR),
+                           Add(counts.shaderModule + counts.pipeline),
+                           device.CreateRenderPipeline(&desc));
+        EXPECT_EQ(2u, mMockPlatform->GetHistogramBooleanCount(kLoweredIRCacheHit, false));
+        EXPECT_EQ(1u, mMockPlatform->GetHistogramBooleanCount(kLoweredIRCacheHit, true));
+    }
+}
+
 // Tests that pipeline creation does not hits the cache when it is enabled but we use different
 // isolation keys.
 TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCacheIsolationKey) {
@@ -646,7 +715,8 @@ TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCacheIsolationKey) {
         desc.vertex.entryPoint = "main";
         desc.cFragment.module = utils::CreateShaderModule(device, kFragmentShaderDefault.data());
         desc.cFragment.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(2 * counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(2 * (counts.shaderModule + counts.loweredIR) + counts.pipeline),
                            device.CreateRenderPipeline(&desc));
     }
 
@@ -658,7 +728,8 @@ TEST_P(SinglePipelineCachingTests, RenderPipelineBlobCacheIsolationKey) {
         desc.vertex.entryPoint = "main";
         desc.cFragment.module = utils::CreateShaderModule(device, kFragmentShaderDefault.data());
         desc.cFragment.entryPoint = "main";
-        EXPECT_CACHE_STATS(mMockCache, Hit(0), Add(2 * counts.shaderModule + counts.pipeline),
+        EXPECT_CACHE_STATS(mMockCache, Hit(0),
+                           Add(2 * (counts.shaderModule + counts.loweredIR) + counts.pipeline),
                            device.CreateRenderPipeline(&desc));
     }
 }
@@ -2561,12 +2561,14 @@ DAWN_INSTANTIATE_TEST(ShaderTests,
                       D3D11Backend(),
                       D3D12Backend(),
                       D3D12Backend({"use_dxc"}),
+                      D3D12Backend({"parallel_shader_compilation"}),
                       MetalBackend(),
                       OpenGLBackend(),
                       OpenGLESBackend(),
                       OpenGLBackend({"disable_symbol_renaming"}),
                       OpenGLESBackend({"disable_symbol_renaming"}),
-                      VulkanBackend());
+                      VulkanBackend(),
+                      VulkanBackend({"parallel_shader_compilation"}));
 
 }  // anonymous namespace
 }  // namespace dawn
@@ -95,3 +95,18 @@ DawnCachingMockPlatform::DawnCachingMockPlatform(dawn::platform::CachingInterfac
 dawn::platform::CachingInterface* DawnCachingMockPlatform::GetCachingInterface() {
     return mCachingInterface;
 }
+
+void DawnCachingMockPlatform::HistogramBoolean(const char* name, bool sample) {
+    std::lock_guard<std::mutex> lock(mHistogramMutex);
+    mBooleanHistograms[name][sample ? 1 : 0]++;
+}
+
+size_t DawnCachingMockPlatform::GetHistogramBooleanCount(const std::string& name,
+                                                         bool sample) const {
+    std::lock_guard<std::mutex> lock(mHistogramMutex);
+    auto it = mBooleanHistograms.find(name);
+    if (it == mBooleanHistograms.end()) {
+        return 0;
+    }
+    return it->second[sample ? 1 : 0];
+}
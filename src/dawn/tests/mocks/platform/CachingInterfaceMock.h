@@ -31,6 +31,8 @@
 #include <dawn/platform/DawnPlatform.h>
 #include <gmock/gmock.h>
 
+#include <array>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -102,8 +104,18 @@ class DawnCachingMockPlatform : public dawn::platform::Platform {
 
     dawn::platform::CachingInterface* GetCachingInterface() override;
 
+    // Records the samples of boolean histograms so that tests can check them.
+    void HistogramBoolean(const char* name, bool sample) override;
+
+    // Returns the number of times |sample| was recorded for the boolean histogram |name|.
+    size_t GetHistogramBooleanCount(const std::string& name, bool sample) const;
+
   private:
     raw_ptr<dawn::platform::CachingInterface> mCachingInterface = nullptr;
+
+    // Histograms may be recorded from the worker threads of asynchronous pipeline creation.
+    mutable std::mutex mHistogramMutex;
+    std::unordered_map<std::string, std::array<size_t, 2>> mBooleanHistograms;
 };
 
 #endif  // SRC_DAWN_TESTS_MOCKS_PLATFORM_CACHINGINTERFACEMOCK_H_
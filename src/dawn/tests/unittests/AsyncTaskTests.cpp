@@ -29,6 +29,7 @@
 // AsyncTaskTests:
 //     Simple tests for native::AsyncTask and native::AsnycTaskManager.
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -103,5 +104,118 @@ TEST_F(AsyncTaskTest, Basic) {
     ASSERT_TRUE(idset.empty());
 }
 
+// Test that a burst of tasks much larger than the number of workers all run to completion.
+TEST_F(AsyncTaskTest, ManyTasks) {
+    platform::Platform platform;
+    std::unique_ptr<platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+
+    constexpr uint32_t kTaskCount = 1000u;
+    std::atomic<uint32_t> completedTaskCount = 0;
+    std::vector<std::unique_ptr<platform::WaitableEvent>> events;
+    for (uint32_t i = 0; i < kTaskCount; ++i) {
+        events.push_back(pool->PostWorkerTask(
+            [](void* userdata) { static_cast<std::atomic<uint32_t>*>(userdata)->fetch_add(1); },
+            &completedTaskCount));
+    }
+
+    for (std::unique_ptr<platform::WaitableEvent>& event : events) {
+        event->Wait();
+        ASSERT_TRUE(event->IsComplete());
+    }
+    ASSERT_EQ(kTaskCount, completedTaskCount.load());
+}
+
+// Test that RunTasksInParallel makes each call exactly once before returning.
+TEST_F(AsyncTaskTest, RunTasksInParallel) {
+    platform::Platform platform;
+    std::unique_ptr<platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+
+    constexpr size_t kTaskCount = 64u;
+    std::vector<std::atomic<uint32_t>> callCounts(kTaskCount);
+    native::RunTasksInParallel(pool.get(), kTaskCount,
+                               [&](size_t i) { callCounts[i].fetch_add(1); });
+
+    for (std::atomic<uint32_t>& callCount : callCounts) {
+        ASSERT_EQ(1u, callCount.load());
+    }
+}
+
+// Test that RunTasksInParallel can be used from all the workers of a pool at the same time
+// without waiting on tasks that can't run.
+TEST_F(AsyncTaskTest, RunTasksInParallelFromWorkerTasks) {
+    platform::Platform platform;
+    std::unique_ptr<platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+
+    constexpr uint32_t kOuterTaskCount = 64u;
+    constexpr size_t kInnerTaskCount = 8u;
+    struct TaskData {
+        platform::WorkerTaskPool* pool;
+        std::atomic<uint32_t> callCount = 0;
+    } data;
+    data.pool = pool.get();
+
+    std::vector<std::unique_ptr<platform::WaitableEvent>> events;
+    for (uint32_t i = 0; i < kOuterTaskCount; ++i) {
+        events.push_back(pool->PostWorkerTask(
+            [](void* userdata) {
+                TaskData* data = static_cast<TaskData*>(userdata);
+                native::RunTasksInParallel(data->pool, kInnerTaskCount,
+                                           [&](size_t) { data->callCount.fetch_add(1); });
+            },
+            &data));
+    }
+
+    for (std::unique_ptr<platform::WaitableEvent>& event : events) {
+        event->Wait();
+    }
+    ASSERT_EQ(kOuterTaskCount * kInnerTaskCount, data.callCount.load());
+}
+
+// Test that tasks can post other tasks to the pool they are running on, and that destroying the
+// pool waits for all of them.
+TEST_F(AsyncTaskTest, PostFromWorkerTask) {
+    struct NestedTaskData {
+        platform::WorkerTaskPool* pool;
+        std::mutex mutex;
+        std::vector<std::unique_ptr<platform::WaitableEvent>> nestedEvents;
+        std::atomic<uint32_t> nestedTaskCount = 0;
+    };
+
+    constexpr uint32_t kTaskCount = 16u;
+    NestedTaskData data;
+    {
+        platform::Platform platform;
+        std::unique_ptr<platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+        data.pool = pool.get();
+
+        std::vector<std::unique_ptr<platform::WaitableEvent>> events;
+        for (uint32_t i = 0; i < kTaskCount; ++i) {
+            events.push_back(pool->PostWorkerTask(
+                [](void* userdata) {
+                    NestedTaskData* data = static_cast<NestedTaskData*>(userdata);
+                    std::unique_ptr<platform::WaitableEvent> event = data->pool->PostWorkerTask(
+                        [](void* userdata) {
+                            static_cast<NestedTaskData*>(userdata)->nestedTaskCount.fetch_add(1);
+                        },
+                        data);
+                    std::lock_guard<std::mutex> lock(data->mutex);
+                    data->nestedEvents.push_back(std::move(event));
+                },
+                &data));
+        }
+
+        for (std::unique_ptr<platform::WaitableEvent>& event : events) {
+            event->Wait();
+        }
+    }
+
+    // The events must stay valid after the pool is destroyed.
+    ASSERT_EQ(kTaskCount, data.nestedEvents.size());
+    for (std::unique_ptr<platform::WaitableEvent>& event : data.nestedEvents) {
+        ASSERT_TRUE(event->IsComplete());
+    }
+    ASSERT_EQ(kTaskCount, data.nestedTaskCount.load());
+}
+
 }  // anonymous namespace
 }  // namespace dawn
@@ -513,4 +513,92 @@ TEST(CommandAllocator, AcquireCommandBlocks) {
     iterator.MakeEmptyAsDataWasDestroyed();
 }
 
+// Test that the blocks of a pooled allocator are returned to the pool when the commands are
+// destroyed, and reused by the next allocator.
+TEST(CommandAllocator, PooledBlocksAreReused) {
+    Ref<CommandBlockPool> pool = AcquireRef(new CommandBlockPool());
+
+    for (int frame = 0; frame < 3; ++frame) {
+        CommandAllocator allocator(pool.Get());
+        for (int i = 0; i < 2000; ++i) {
+            CommandDraw* draw = allocator.Allocate<CommandDraw>(CommandType::Draw);
+            draw->first = i;
+            draw->count = i;
+        }
+
+        CommandIterator iterator(std::move(allocator));
+        CommandType type;
+        int count = 0;
+        while (iterator.NextCommandId(&type)) {
+            ASSERT_EQ(type, CommandType::Draw);
+            CommandDraw* draw = iterator.NextCommand<CommandDraw>();
+            ASSERT_EQ(draw->first, uint32_t(count));
+            count++;
+        }
+        ASSERT_EQ(count, 2000);
+        iterator.MakeEmptyAsDataWasDestroyed();
+    }
+
+    // All the blocks of the following frames come from the pool.
+    CommandBlockPool::Stats stats = pool->GetStats();
+    ASSERT_GT(stats.allocationCount, 3u);
+    EXPECT_EQ(stats.allocationCount % 3, 0u);
+    EXPECT_EQ(stats.reuseCount, stats.allocationCount / 3 * 2);
+    EXPECT_EQ(stats.releaseCount, stats.allocationCount);
+    EXPECT_EQ(stats.freeCount, 0u);
+}
+
+// Test that blocks larger than the size classes aren't kept by the pool.
+TEST(CommandAllocator, PooledLargeBlocksAreFreed) {
+    Ref<CommandBlockPool> pool = AcquireRef(new CommandBlockPool());
+    {
+        CommandAllocator allocator(pool.Get());
+        allocator.Allocate<CommandBig>(CommandType::Big);
+        CommandIterator iterator(std::move(allocator));
+        iterator.MakeEmptyAsDataWasDestroyed();
+    }
+
+    CommandBlockPool::Stats stats = pool->GetStats();
+    EXPECT_EQ(stats.allocationCount, 1u);
+    EXPECT_EQ(stats.reuseCount, 0u);
+    EXPECT_EQ(stats.freeCount, 1u);
+}
+
+// Test that a moved-from pooled allocator keeps using the pool.
+TEST(CommandAllocator, PooledAllocatorKeepsPoolWhenMoved) {
+    Ref<CommandBlockPool> pool = AcquireRef(new CommandBlockPool());
+    CommandAllocator allocator(pool.Get());
+    allocator.Allocate<CommandDraw>(CommandType::Draw);
+    CommandAllocator other = std::move(allocator);
+    allocator.Allocate<CommandDraw>(CommandType::Draw);
+
+    EXPECT_EQ(pool->GetStats().allocationCount, 2u);
+
+    CommandIterator iterator(std::move(other));
+    iterator.MakeEmptyAsDataWasDestroyed();
+    allocator.Reset();
+    EXPECT_EQ(pool->GetStats().releaseCount, 2u);
+}
+
+// Test that move-assigning a pooled allocator transfers its pool.
+TEST(CommandAllocator, PooledAllocatorMoveAssignTransfersPool) {
+    Ref<CommandBlockPool> pool = AcquireRef(new CommandBlockPool());
+    CommandAllocator allocator(pool.Get());
+    allocator.Allocate<CommandDraw>(CommandType::Draw);
+
+    CommandAllocator other;
+    other = std::move(allocator);
+    EXPECT_EQ(pool->GetStats().allocationCount, 1u);
+
+    // Once its commands are acquired, the assigned allocator allocates its next block from the
+    // pool.
+    CommandIterator iterator(std::move(other));
+    iterator.MakeEmptyAsDataWasDestroyed();
+    other.Allocate<CommandDraw>(CommandType::Draw);
+    EXPECT_EQ(pool->GetStats().allocationCount, 2u);
+
+    other.Reset();
+    EXPECT_EQ(pool->GetStats().releaseCount, 2u);
+}
+
 }  // namespace dawn::native
@@ -0,0 +1,192 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "dawn/utils/SharedMemoryCommandBuffer.h"
+#include "gtest/gtest.h"
+
+namespace dawn::utils {
+namespace {
+
+// The commands used by the tests: a header followed by |size| bytes all equal to the low byte of
+// |id|.
+struct TestCommand {
+    uint32_t size;
+    uint32_t id;
+};
+
+// A handler that checks the contents of the commands and that their ids are consecutive.
+class TestCommandHandler : public dawn::wire::CommandHandler {
+  public:
+    const volatile char* HandleCommands(const volatile char* commands, size_t size) override {
+        const volatile char* end = commands + size;
+        while (commands != end) {
+            TestCommand command;
+            if (size_t(end - commands) < sizeof(command)) {
+                return nullptr;
+            }
+            memcpy(&command, const_cast<const char*>(commands), sizeof(command));
+            commands += sizeof(command);
+            if (size_t(end - commands) < command.size || command.id != mCommandCount ||
+                mFailAtCommand == command.id) {
+                return nullptr;
+            }
+            for (uint32_t i = 0; i < command.size; ++i) {
+                if (commands[i] != static_cast<char>(command.id)) {
+                    return nullptr;
+                }
+            }
+            commands += command.size;
+            mCommandCount++;
+        }
+        return commands;
+    }
+
+    uint32_t mCommandCount = 0;
+    uint32_t mFailAtCommand = ~0u;
+};
+
+class SharedMemoryCommandBufferTests : public testing::Test {
+  protected:
+    void Initialize(size_t capacity) {
+        mMemorySize = GetSharedMemoryCommandBufferSize(capacity);
+        mMemory.resize(mMemorySize / sizeof(MemoryChunk));
+        InitializeSharedMemoryCommandBuffer(mMemory.data(), mMemorySize);
+    }
+
+    void* GetMemory() { return mMemory.data(); }
+
+    static bool Serialize(dawn::wire::CommandSerializer* serializer, uint32_t id, uint32_t size) {
+        char* space = static_cast<char*>(serializer->GetCmdSpace(sizeof(TestCommand) + size));
+        if (space == nullptr) {
+            return false;
+        }
+        TestCommand command = {size, id};
+        memcpy(space, &command, sizeof(command));
+        memset(space + sizeof(command), static_cast<char>(id), size);
+        return true;
+    }
+
+    struct alignas(kSharedMemoryCommandBufferAlignment) MemoryChunk {
+        char data[kSharedMemoryCommandBufferAlignment];
+    };
+    size_t mMemorySize = 0;
+    std::vector<MemoryChunk> mMemory;
+};
+
+// Test that flushed commands are handled in order, and that unflushed commands aren't.
+TEST_F(SharedMemoryCommandBufferTests, FlushThenHandle) {
+    Initialize(4096);
+    SharedMemoryCommandSerializer serializer(GetMemory(), mMemorySize);
+    SharedMemoryCommandReceiver receiver(GetMemory(), mMemorySize);
+    TestCommandHandler handler;
+
+    EXPECT_TRUE(receiver.TryHandleCommands(&handler));
+    EXPECT_EQ(handler.mCommandCount, 0u);
+
+    for (uint32_t i = 0; i < 10; ++i) {
+        ASSERT_TRUE(Serialize(&serializer, i, i * 3));
+    }
+    EXPECT_TRUE(receiver.TryHandleCommands(&handler));
+    EXPECT_EQ(handler.mCommandCount, 0u);
+
+    ASSERT_TRUE(serializer.Flush());
+    EXPECT_TRUE(receiver.TryHandleCommands(&handler));
+    EXPECT_EQ(handler.mCommandCount, 10u);
+
+    // The receiver stops once the serializer is closed and its commands are handled.
+    ASSERT_TRUE(Serialize(&serializer, 10, 5));
+    serializer.Close();
+    EXPECT_TRUE(receiver.HandleCommands(&handler));
+    EXPECT_EQ(handler.mCommandCount, 11u);
+    EXPECT_FALSE(receiver.HandleCommands(&handler));
+}
+
+// Test that commands wrap around the end of the ring buffer, including the largest ones.
+TEST_F(SharedMemoryCommandBufferTests, Wrapping) {
+    Initialize(1024);
+    SharedMemoryCommandSerializer serializer(GetMemory(), mMemorySize);
+    SharedMemoryCommandReceiver receiver(GetMemory(), mMemorySize);
+    TestCommandHandler handler;
+
+    const uint32_t kMaxSize = serializer.GetMaximumAllocationSize() - sizeof(TestCommand);
+    for (uint32_t i = 0; i < 100; ++i) {
+        ASSERT_TRUE(Serialize(&serializer, i, i % 2 == 0 ? kMaxSize : i * 7 % 200));
+        ASSERT_TRUE(serializer.Flush());
+        ASSERT_TRUE(receiver.TryHandleCommands(&handler));
+        ASSERT_EQ(handler.mCommandCount, i + 1);
+    }
+}
+
+// Test that the serializer waits for the receiver when the ring buffer is full.
+TEST_F(SharedMemoryCommandBufferTests, Backpressure) {
+    Initialize(4096);
+    constexpr uint32_t kCommandCount = 20000;
+
+    std::thread receiverThread([&] {
+        SharedMemoryCommandReceiver receiver(GetMemory(), mMemorySize);
+        TestCommandHandler handler;
+        while (receiver.HandleCommands(&handler)) {
+        }
+        EXPECT_EQ(handler.mCommandCount, kCommandCount);
+    });
+
+    SharedMemoryCommandSerializer serializer(GetMemory(), mMemorySize);
+    for (uint32_t i = 0; i < kCommandCount; ++i) {
+        ASSERT_TRUE(Serialize(&serializer, i, i * 13 % 1500));
+        if (i % 7 == 0) {
+            ASSERT_TRUE(serializer.Flush());
+        }
+    }
+    serializer.Close();
+    receiverThread.join();
+}
+
+// Test that a failure of the handler closes the ring buffer for the serializer.
+TEST_F(SharedMemoryCommandBufferTests, HandlerFailure) {
+    Initialize(4096);
+    SharedMemoryCommandSerializer serializer(GetMemory(), mMemorySize);
+    SharedMemoryCommandReceiver receiver(GetMemory(), mMemorySize);
+    TestCommandHandler handler;
+    handler.mFailAtCommand = 1;
+
+    ASSERT_TRUE(Serialize(&serializer, 0, 10));
+    ASSERT_TRUE(serializer.Flush());
+    ASSERT_TRUE(Serialize(&serializer, 1, 10));
+    ASSERT_TRUE(serializer.Flush());
+    EXPECT_FALSE(receiver.TryHandleCommands(&handler));
+    EXPECT_EQ(handler.mCommandCount, 1u);
+
+    ASSERT_TRUE(Serialize(&serializer, 2, 10));
+    EXPECT_FALSE(serializer.Flush());
+}
+
+}  // anonymous namespace
+}  // namespace dawn::utils
@@ -0,0 +1,273 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dawn/common/SystemUtils.h"
+#include "dawn/native/FileBlobCache.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+namespace {
+
+class FileBlobCacheTests : public testing::Test {
+  protected:
+    void SetUp() override {
+        const testing::TestInfo* info = testing::UnitTest::GetInstance()->current_test_info();
+        mDirectory = testing::TempDir() + "dawn_" + info->name();
+        RemoveFiles();
+    }
+
+    void TearDown() override { RemoveFiles(); }
+
+    std::shared_ptr<FileBlobCache> Open(uint64_t maxSize = 0) {
+        return FileBlobCache::Open(mDirectory, maxSize);
+    }
+
+    std::string GetPath(const char* extension) const {
+        return mDirectory + GetPathSeparator() + "dawn_blob_cache" + extension;
+    }
+
+    void RemoveFiles() {
+        for (const char* extension : {".index", ".index.tmp", ".pack", ".pack.tmp"}) {
+            std::remove(GetPath(extension).c_str());
+        }
+        std::remove(mDirectory.c_str());
+    }
+
+    static void Store(FileBlobCache* cache, const std::string& key, const std::string& value) {
+        cache->Store(key.data(), key.size(), value.data(), value.size());
+    }
+
+    // Loads the value the same way BlobCache does, with a size query followed by the load.
+    static std::string Load(FileBlobCache* cache, const std::string& key) {
+        size_t size = cache->Load(key.data(), key.size(), nullptr, 0);
+        if (size == 0) {
+            return "";
+        }
+        std::string value(size, '\0');
+        EXPECT_EQ(cache->Load(key.data(), key.size(), value.data(), size), size);
+        return value;
+    }
+
+    // Overwrites the bytes at the end of a cache file.
+    void GarbleFileEnd(const char* extension, size_t byteCount) {
+        FILE* file = fopen(GetPath(extension).c_str(), "r+b");
+        ASSERT_NE(file, nullptr);
+        ASSERT_EQ(fseek(file, -static_cast<long>(byteCount), SEEK_END), 0);
+        std::vector<char> garbage(byteCount, '\x5a');
+        ASSERT_EQ(fwrite(garbage.data(), 1, byteCount, file), byteCount);
+        fclose(file);
+    }
+
+    std::string mDirectory;
+};
+
+// Test that a missing key is a miss.
+TEST_F(FileBlobCacheTests, LoadMiss) {
+    std::shared_ptr<FileBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(Load(cache.get(), "key"), "");
+}
+
+// Test that stored values are loaded back, and that storing a key again replaces its value.
+TEST_F(FileBlobCacheTests, StoreThenLoad) {
+    std::shared_ptr<FileBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    Store(cache.get(), "key1", "value1");
+    Store(cache.get(), "key2", "value2");
+    EXPECT_EQ(Load(cache.get(), "key1"), "value1");
+    EXPECT_EQ(Load(cache.get(), "key2"), "value2");
+
+    Store(cache.get(), "key1", "another value");
+    EXPECT_EQ(Load(cache.get(), "key1"), "another value");
+    EXPECT_EQ(cache->GetEntryCountForTesting(), 2u);
+}
+
+// Test that opening the same directory again returns the cache that is already open.
+TEST_F(FileBlobCacheTests, SharedBetweenOpens) {
+    std::shared_ptr<FileBlobCache> cache1 = Open();
+    std::shared_ptr<FileBlobCache> cache2 = Open();
+    ASSERT_NE(cache1, nullptr);
+    EXPECT_EQ(cache1, cache2);
+}
+
+// Test that a load with a buffer of the wrong size fails.
+TEST_F(FileBlobCacheTests, LoadWrongSize) {
+    std::shared_ptr<FileBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    Store(cache.get(), "key", "value");
+
+    std::string value(3, '\0');
+    EXPECT_EQ(cache->Load("key", 3, value.data(), value.size()), 0u);
+    EXPECT_EQ(Load(cache.get(), "key"), "value");
+}
+
+// Test that the values persist when the cache is reopened.
+TEST_F(FileBlobCacheTests, Reopen) {
+    {
+        std::shared_ptr<FileBlobCache> cache = Open();
+        ASSERT_NE(cache, nullptr);
+        Store(cache.get(), "key1", "value1");
+        Store(cache.get(), "key2", "value2");
+    }
+    std::shared_ptr<FileBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(Load(cache.get(), "key1"), "value1");
+    EXPECT_EQ(Load(cache.get(), "key2"), "value2");
+}
+
+// Test that values stored after the index was written are recovered from the pack file.
+TEST_F(FileBlobCacheTests, RecoverRecordsMissingFromIndex) {
+    {
+        std::shared_ptr<FileBlobCache> cache = Open();
+        ASSERT_NE(cache, nullptr);
+        Store(cache.get(), "key1", "value1");
+    }
+    {
+        // Keep the index of the first session, as if the second one crashed.
+        std::shared_ptr<FileBlobCache> cache = Open();
+        ASSERT_NE(cache, nullptr);
+        Store(cache.get(), "key2", "value2");
+        ASSERT_EQ(std::rename(GetPath(".index").c_str(), GetPath(".index.old").c_str()), 0);
+    }
+    ASSERT_EQ(std::remove(GetPath(".index").c_str()), 0);
+    ASSERT_EQ(std::rename(GetPath(".index.old").c_str(), GetPath(".index").c_str()), 0);
+
+    std::shared_ptr<FileBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(Load(cache.get(), "key1"), "value1");
+    EXPECT_EQ(Load(cache.get(), "key2"), "value2");
+}
+
+// Test that a corrupted index is rebuilt from the pack file.
+TEST_F(FileBlobCacheTests, CorruptedIndex) {
+    {
+        std::shared_ptr<FileBlobCache> cache = Open();
+        ASSERT_NE(cache, nullptr);
+        Store(cache.get(), "key1", "value1");
+        Store(cache.get(), "key2", "value2");
+    }
+    GarbleFileEnd(".index", 4);
+
+    std::shared_ptr<FileBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(Load(cache.get(), "key1"), "value1");
+    EXPECT_EQ(Load(cache.get(), "key2"), "value2");
+}
+
+// Test that a corrupted record is a miss and doesn't affect the other records.
+TEST_F(FileBlobCacheTests, CorruptedRecord) {
+    {
+        std::shared_ptr<FileBlobCache> cache = Open();
+        ASSERT_NE(cache, nullptr);
+        Store(cache.get(), "key1", "value1");
+        Store(cache.get(), "key2", "value2");
+    }
+    GarbleFileEnd(".pack", 2);
+
+    {
+        std::shared_ptr<FileBlobCache> cache = Open();
+        ASSERT_NE(cache, nullptr);
+        EXPECT_EQ(Load(cache.get(), "key1"), "value1");
+        EXPECT_EQ(Load(cache.get(), "key2"), "");
+        EXPECT_EQ(cache->GetEntryCountForTesting(), 1u);
+    }
+
+    // The same happens when the index is missing and the pack file is scanned.
+    ASSERT_EQ(std::remove(GetPath(".index").c_str()), 0);
+    std::shared_ptr<FileBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(Load(cache.get(), "key1"), "value1");
+    EXPECT_EQ(Load(cache.get(), "key2"), "");
+    EXPECT_EQ(cache->GetEntryCountForTesting(), 1u);
+
+    // New values can still be stored.
+    Store(cache.get(), "key3", "value3");
+    EXPECT_EQ(Load(cache.get(), "key3"), "value3");
+}
+
+// Test that a corrupted pack file header discards the cache.
+TEST_F(FileBlobCacheTests, CorruptedPack) {
+    {
+        std::shared_ptr<FileBlobCache> cache = Open();
+        ASSERT_NE(cache, nullptr);
+        Store(cache.get(), "key", "value");
+    }
+    FILE* file = fopen(GetPath(".pack").c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    fputs("garbage", file);
+    fclose(file);
+
+    std::shared_ptr<FileBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(Load(cache.get(), "key"), "");
+    Store(cache.get(), "key", "value");
+    EXPECT_EQ(Load(cache.get(), "key"), "value");
+}
+
+// Test that the pack file is compacted to the most recently used values when it grows too large.
+TEST_F(FileBlobCacheTests, Compaction) {
+    constexpr uint64_t kMaxSize = 4096;
+    const std::string kValue(500, 'v');
+
+    std::shared_ptr<FileBlobCache> cache = Open(kMaxSize);
+    ASSERT_NE(cache, nullptr);
+    for (int i = 0; i < 20; ++i) {
+        Store(cache.get(), "key" + std::to_string(i), kValue);
+        // Keep using the first key so that it isn't evicted.
+        EXPECT_EQ(Load(cache.get(), "key0"), kValue);
+        EXPECT_LE(cache->GetPackSizeForTesting(), kMaxSize);
+    }
+
+    EXPECT_LT(cache->GetEntryCountForTesting(), 20u);
+    EXPECT_EQ(Load(cache.get(), "key0"), kValue);
+    EXPECT_EQ(Load(cache.get(), "key19"), kValue);
+    EXPECT_EQ(Load(cache.get(), "key1"), "");
+
+    // The compacted cache is still valid after reopening.
+    size_t entryCount = cache->GetEntryCountForTesting();
+    cache = nullptr;
+    cache = Open(kMaxSize);
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(cache->GetEntryCountForTesting(), entryCount);
+    EXPECT_EQ(Load(cache.get(), "key0"), kValue);
+}
+
+// Test that values too large for the cache aren't stored.
+TEST_F(FileBlobCacheTests, ValueTooLarge) {
+    std::shared_ptr<FileBlobCache> cache = Open(1024);
+    ASSERT_NE(cache, nullptr);
+    Store(cache.get(), "key", std::string(1024, 'v'));
+    EXPECT_EQ(Load(cache.get(), "key"), "");
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
@@ -0,0 +1,144 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "dawn/native/Blob.h"
+#include "dawn/native/CacheKey.h"
+#include "dawn/native/MemoryBlobCache.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+namespace {
+
+CacheKey MakeKey(const std::string& str) {
+    return CacheKey(str.begin(), str.end());
+}
+
+Blob MakeBlob(const std::string& str) {
+    Blob blob = CreateBlob(str.size());
+    memcpy(blob.Data(), str.data(), str.size());
+    return blob;
+}
+
+std::string ToString(const Blob& blob) {
+    return std::string(reinterpret_cast<const char*>(blob.Data()), blob.Size());
+}
+
+// Test that loading a key that was never stored misses.
+TEST(MemoryBlobCacheTests, LoadMiss) {
+    MemoryBlobCache cache(1024 * 1024);
+    EXPECT_TRUE(cache.Load(MakeKey("key")).Empty());
+
+    MemoryBlobCache::Stats stats = cache.GetStats();
+    EXPECT_EQ(stats.hitCount, 0u);
+    EXPECT_EQ(stats.missCount, 1u);
+    EXPECT_EQ(stats.entryCount, 0u);
+}
+
+// Test that stored values are loaded back and that the returned blobs share the cached data.
+TEST(MemoryBlobCacheTests, StoreThenLoad) {
+    MemoryBlobCache cache(1024 * 1024);
+    Blob stored = cache.Store(MakeKey("key"), MakeBlob("value"));
+    EXPECT_EQ(ToString(stored), "value");
+
+    Blob loaded1 = cache.Load(MakeKey("key"));
+    Blob loaded2 = cache.Load(MakeKey("key"));
+    EXPECT_EQ(ToString(loaded1), "value");
+    EXPECT_EQ(loaded1.Data(), stored.Data());
+    EXPECT_EQ(loaded2.Data(), stored.Data());
+
+    MemoryBlobCache::Stats stats = cache.GetStats();
+    EXPECT_EQ(stats.hitCount, 2u);
+    EXPECT_EQ(stats.missCount, 0u);
+    EXPECT_EQ(stats.entryCount, 1u);
+    EXPECT_EQ(stats.sizeInBytes, std::string("keyvalue").size());
+}
+
+// Test that storing an existing key replaces its value.
+TEST(MemoryBlobCacheTests, StoreReplaces) {
+    MemoryBlobCache cache(1024 * 1024);
+    cache.Store(MakeKey("key"), MakeBlob("value1"));
+    cache.Store(MakeKey("key"), MakeBlob("value2"));
+
+    EXPECT_EQ(ToString(cache.Load(MakeKey("key"))), "value2");
+    EXPECT_EQ(cache.GetStats().entryCount, 1u);
+}
+
+// Test that loaded blobs stay valid after their entry is evicted.
+TEST(MemoryBlobCacheTests, LoadedBlobOutlivesEntry) {
+    // The cache only has room for a single entry.
+    MemoryBlobCache cache(10, 1);
+    Blob loaded = cache.Store(MakeKey("key"), MakeBlob("value"));
+    cache.Store(MakeKey("key2"), MakeBlob("value"));
+
+    EXPECT_EQ(cache.GetStats().evictionCount, 1u);
+    EXPECT_TRUE(cache.Load(MakeKey("key")).Empty());
+    EXPECT_EQ(ToString(loaded), "value");
+}
+
+// Test that the least recently used entries are evicted first.
+TEST(MemoryBlobCacheTests, EvictsLeastRecentlyUsed) {
+    // Each entry is 8 bytes and the cache has room for 3 entries.
+    MemoryBlobCache cache(3 * 8, 1);
+    cache.Store(MakeKey("key0"), MakeBlob("val0"));
+    cache.Store(MakeKey("key1"), MakeBlob("val1"));
+    cache.Store(MakeKey("key2"), MakeBlob("val2"));
+
+    // Touch the first key so that the second one becomes the least recently used.
+    EXPECT_FALSE(cache.Load(MakeKey("key0")).Empty());
+    cache.Store(MakeKey("key3"), MakeBlob("val3"));
+
+    EXPECT_EQ(cache.GetStats().evictionCount, 1u);
+    EXPECT_EQ(ToString(cache.Load(MakeKey("key0"))), "val0");
+    EXPECT_TRUE(cache.Load(MakeKey("key1")).Empty());
+    EXPECT_EQ(ToString(cache.Load(MakeKey("key2"))), "val2");
+    EXPECT_EQ(ToString(cache.Load(MakeKey("key3"))), "val3");
+}
+
+// Test that the size budget is split between the shards.
+TEST(MemoryBlobCacheTests, ShardedBudget) {
+    MemoryBlobCache cache(4 * 8, 4);
+    for (uint32_t i = 0; i < 100; ++i) {
+        cache.Store(MakeKey("key" + std::to_string(i % 10)), MakeBlob("valu"));
+        EXPECT_LE(cache.GetStats().sizeInBytes, cache.GetMaxSizeInBytes());
+    }
+}
+
+// Test that values larger than the budget of a shard are returned but not cached.
+TEST(MemoryBlobCacheTests, TooLargeValueIsNotCached) {
+    MemoryBlobCache cache(32, 1);
+    Blob stored = cache.Store(MakeKey("key"), MakeBlob(std::string(64, 'x')));
+    EXPECT_EQ(stored.Size(), 64u);
+    EXPECT_TRUE(cache.Load(MakeKey("key")).Empty());
+    EXPECT_EQ(cache.GetStats().entryCount, 0u);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
@@ -25,12 +25,16 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <vector>
+
 #include "dawn/tests/unittests/wire/WireTest.h"
 
 namespace dawn::wire {
 namespace {
 
+using testing::_;
 using testing::Return;
+using testing::Sequence;
 
 class WireBasicTests : public WireTest {
   public:
@@ -93,5 +97,42 @@ TEST_F(WireBasicTests, ReleaseCalledOnRefCount0) {
     FlushClient();
 }
 
+// Test that objects keep being forwarded correctly when their IDs span many storage chunks in the
+// server and IDs of released objects are reused.
+TEST_F(WireBasicTests, ManyObjectsWithReusedIds) {
+    constexpr size_t kObjectCount = 1000;
+
+    std::vector<WGPUCommandEncoder> encoders;
+    std::vector<WGPUCommandEncoder> apiEncoders;
+    auto CreateEncoders = [&](size_t count) {
+        Sequence s;
+        for (size_t i = 0; i < count; ++i) {
+            encoders.push_back(wgpuDeviceCreateCommandEncoder(device, nullptr));
+            apiEncoders.push_back(api.GetNewCommandEncoder());
+            EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr))
+                .InSequence(s)
+                .WillOnce(Return(apiEncoders.back()));
+        }
+        FlushClient();
+    };
+    CreateEncoders(kObjectCount);
+
+    // Release half of the encoders and create new ones, which reuse the freed IDs.
+    for (size_t i = 0; i < kObjectCount / 2; ++i) {
+        wgpuCommandEncoderRelease(encoders[i]);
+        EXPECT_CALL(api, CommandEncoderRelease(apiEncoders[i]));
+    }
+    FlushClient();
+    encoders.erase(encoders.begin(), encoders.begin() + kObjectCount / 2);
+    apiEncoders.erase(apiEncoders.begin(), apiEncoders.begin() + kObjectCount / 2);
+    CreateEncoders(kObjectCount / 2);
+
+    for (size_t i = 0; i < encoders.size(); ++i) {
+        wgpuCommandEncoderInsertDebugMarker(encoders[i], "marker");
+        EXPECT_CALL(api, CommandEncoderInsertDebugMarker(apiEncoders[i], _));
+    }
+    FlushClient();
+}
+
 }  // anonymous namespace
 }  // namespace dawn::wire
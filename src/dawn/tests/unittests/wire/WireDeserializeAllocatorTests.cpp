@@ -0,0 +1,131 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "dawn/common/Math.h"
+#include "dawn/wire/WireDeserializeAllocator.h"
+#include "gtest/gtest.h"
+
+namespace dawn::wire {
+namespace {
+
+using Allocator = WireDeserializeAllocator;
+
+// Check that small commands are served from the inline buffer without allocating chunks.
+TEST(WireDeserializeAllocatorTests, SmallCommandsUseInlineBuffer) {
+    Allocator allocator;
+    for (int i = 0; i < 10; i++) {
+        void* a = allocator.GetSpace(100);
+        void* b = allocator.GetSpace(200);
+        ASSERT_NE(a, nullptr);
+        ASSERT_NE(b, nullptr);
+        EXPECT_NE(a, b);
+        allocator.Reset();
+    }
+
+    const Allocator::Stats& stats = allocator.GetStats();
+    EXPECT_EQ(stats.commandCount, 10u);
+    EXPECT_EQ(stats.allocatedBytes, 10u * (104u + 200u));
+    EXPECT_EQ(stats.maxCommandBytes, 304u);
+    EXPECT_EQ(stats.overflowCount, 0u);
+    EXPECT_EQ(stats.chunkAllocationCount, 0u);
+    EXPECT_EQ(allocator.GetRetainedChunkSize(), 0u);
+}
+
+// Check that allocations are aligned even after odd-sized ones.
+TEST(WireDeserializeAllocatorTests, AllocationsAreAligned) {
+    Allocator allocator;
+    for (size_t size : {1, 3, 8, 13, 3000, 5, 7000}) {
+        void* space = allocator.GetSpace(size);
+        ASSERT_NE(space, nullptr);
+        EXPECT_TRUE(IsPtrAligned(space, kWireBufferAlignment));
+        memset(space, 0xAA, size);
+    }
+}
+
+// Check that chunks are kept across commands and reused instead of being reallocated.
+TEST(WireDeserializeAllocatorTests, ChunksAreRetainedAcrossCommands) {
+    Allocator allocator;
+
+    allocator.GetSpace(Allocator::kInlineSize);
+    void* overflow = allocator.GetSpace(1000);
+    allocator.Reset();
+    EXPECT_EQ(allocator.GetStats().chunkAllocationCount, 1u);
+    EXPECT_EQ(allocator.GetRetainedChunkSize(), Allocator::kMinChunkSize);
+
+    for (int i = 0; i < 5; i++) {
+        allocator.GetSpace(Allocator::kInlineSize);
+        EXPECT_EQ(allocator.GetSpace(1000), overflow);
+        allocator.Reset();
+    }
+
+    const Allocator::Stats& stats = allocator.GetStats();
+    EXPECT_EQ(stats.commandCount, 6u);
+    EXPECT_EQ(stats.overflowCount, 6u);
+    EXPECT_EQ(stats.chunkAllocationCount, 1u);
+    EXPECT_EQ(stats.chunkFreeCount, 0u);
+}
+
+// Check that chunks grow geometrically, and that allocations larger than the next chunk get a
+// chunk of their own size.
+TEST(WireDeserializeAllocatorTests, ChunksGrow) {
+    Allocator allocator;
+    allocator.GetSpace(Allocator::kInlineSize);
+    allocator.GetSpace(Allocator::kMinChunkSize);
+    allocator.GetSpace(Allocator::kMinChunkSize);
+    EXPECT_EQ(allocator.GetRetainedChunkSize(), 3 * Allocator::kMinChunkSize);
+
+    allocator.GetSpace(100 * Allocator::kMinChunkSize);
+    EXPECT_EQ(allocator.GetRetainedChunkSize(), 103 * Allocator::kMinChunkSize);
+    EXPECT_EQ(allocator.GetStats().chunkAllocationCount, 3u);
+}
+
+// Check that the chunks over the retention limit are freed on Reset.
+TEST(WireDeserializeAllocatorTests, LargeChunksAreFreed) {
+    Allocator allocator;
+    allocator.GetSpace(Allocator::kMinChunkSize);
+    allocator.GetSpace(2 * Allocator::kMaxRetainedChunkSize);
+    allocator.Reset();
+
+    EXPECT_EQ(allocator.GetRetainedChunkSize(), Allocator::kMinChunkSize);
+    EXPECT_EQ(allocator.GetStats().chunkAllocationCount, 2u);
+    EXPECT_EQ(allocator.GetStats().chunkFreeCount, 1u);
+    EXPECT_EQ(allocator.GetStats().maxCommandBytes,
+              Allocator::kMinChunkSize + 2 * Allocator::kMaxRetainedChunkSize);
+}
+
+// Check that allocations that would overflow when aligned fail.
+TEST(WireDeserializeAllocatorTests, HugeAllocationFails) {
+    Allocator allocator;
+    EXPECT_EQ(allocator.GetSpace(std::numeric_limits<size_t>::max()), nullptr);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
@@ -0,0 +1,335 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+
+namespace dawn::wire {
+namespace {
+
+using testing::_;
+using testing::InSequence;
+using testing::Return;
+
+class WireRenderPassCommandBatchTests : public WireTest {
+  protected:
+    bool EnableRenderPassCommandBatching() override { return true; }
+
+    void SetUp() override {
+        WireTest::SetUp();
+
+        WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(device, nullptr);
+        apiEncoder = api.GetNewCommandEncoder();
+        EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr))
+            .WillOnce(Return(apiEncoder));
+
+        WGPURenderPassDescriptor passDescriptor = WGPU_RENDER_PASS_DESCRIPTOR_INIT;
+        pass = wgpuCommandEncoderBeginRenderPass(encoder, &passDescriptor);
+        apiPass = api.GetNewRenderPassEncoder();
+        EXPECT_CALL(api, CommandEncoderBeginRenderPass(apiEncoder, _)).WillOnce(Return(apiPass));
+
+        WGPUBindGroupLayoutDescriptor bglDescriptor = WGPU_BIND_GROUP_LAYOUT_DESCRIPTOR_INIT;
+        bgl = wgpuDeviceCreateBindGroupLayout(device, &bglDescriptor);
+        EXPECT_CALL(api, DeviceCreateBindGroupLayout(apiDevice, _))
+            .WillOnce(Return(api.GetNewBindGroupLayout()));
+
+        FlushClient();
+    }
+
+    WGPUBuffer CreateBuffer(WGPUBuffer* apiBuffer) {
+        WGPUBufferDescriptor descriptor = WGPU_BUFFER_DESCRIPTOR_INIT;
+        descriptor.size = 256;
+        descriptor.usage = static_cast<WGPUBufferUsage>(WGPUBufferUsage_Vertex |
+                                                        WGPUBufferUsage_Index);
+
+        WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+        *apiBuffer = api.GetNewBuffer();
+        EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _))
+            .WillOnce(Return(*apiBuffer))
+            .RetiresOnSaturation();
+        FlushClient();
+        return buffer;
+    }
+
+    WGPUBindGroup CreateBindGroup(WGPUBindGroup* apiBindGroup) {
+        WGPUBindGroupDescriptor descriptor = WGPU_BIND_GROUP_DESCRIPTOR_INIT;
+        descriptor.layout = bgl;
+
+        WGPUBindGroup bindGroup = wgpuDeviceCreateBindGroup(device, &descriptor);
+        *apiBindGroup = api.GetNewBindGroup();
+        EXPECT_CALL(api, DeviceCreateBindGroup(apiDevice, _))
+            .WillOnce(Return(*apiBindGroup))
+            .RetiresOnSaturation();
+        FlushClient();
+        return bindGroup;
+    }
+
+    WGPURenderPipeline CreateRenderPipeline(WGPURenderPipeline* apiPipeline) {
+        WGPUShaderModuleDescriptor moduleDescriptor = WGPU_SHADER_MODULE_DESCRIPTOR_INIT;
+        WGPUShaderModule module = wgpuDeviceCreateShaderModule(device, &moduleDescriptor);
+        EXPECT_CALL(api, DeviceCreateShaderModule(apiDevice, _))
+            .WillOnce(Return(api.GetNewShaderModule()));
+
+        WGPURenderPipelineDescriptor descriptor = WGPU_RENDER_PIPELINE_DESCRIPTOR_INIT;
+        descriptor.vertex.module = module;
+        WGPURenderPipeline pipeline = wgpuDeviceCreateRenderPipeline(device, &descriptor);
+        *apiPipeline = api.GetNewRenderPipeline();
+        EXPECT_CALL(api, DeviceCreateRenderPipeline(apiDevice, _))
+            .WillOnce(Return(*apiPipeline))
+            .RetiresOnSaturation();
+
+        FlushClient();
+        return pipeline;
+    }
+
+    WGPURenderPassEncoder pass;
+    WGPURenderPassEncoder apiPass;
+    WGPUCommandEncoder apiEncoder;
+    WGPUBindGroupLayout bgl;
+};
+
+// Test that all the batched commands are forwarded with their arguments.
+TEST_F(WireRenderPassCommandBatchTests, AllCommands) {
+    WGPURenderPipeline apiPipeline;
+    WGPURenderPipeline pipeline = CreateRenderPipeline(&apiPipeline);
+    WGPUBindGroup apiBindGroup;
+    WGPUBindGroup bindGroup = CreateBindGroup(&apiBindGroup);
+    WGPUBuffer apiBuffer;
+    WGPUBuffer buffer = CreateBuffer(&apiBuffer);
+
+    std::array<uint32_t, 3> offsets = {0, 256, 0xFFFF'FFFFu};
+    wgpuRenderPassEncoderSetPipeline(pass, pipeline);
+    wgpuRenderPassEncoderSetBindGroup(pass, 1, bindGroup, offsets.size(), offsets.data());
+    wgpuRenderPassEncoderSetBindGroup(pass, 2, nullptr, 0, nullptr);
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 3, buffer, 16, WGPU_WHOLE_SIZE);
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 4, nullptr, 0, 0);
+    wgpuRenderPassEncoderSetIndexBuffer(pass, buffer, WGPUIndexFormat_Uint32, 32, 64);
+    wgpuRenderPassEncoderDraw(pass, 3, 2, 1, 0xFFFF'FFFFu);
+    wgpuRenderPassEncoderDrawIndexed(pass, 6, 1, 5, -7, 0);
+    wgpuRenderPassEncoderDrawIndexed(pass, 6, 1, 5, std::numeric_limits<int32_t>::min(), 0);
+    wgpuRenderPassEncoderEnd(pass);
+
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass, apiPipeline));
+        EXPECT_CALL(api, RenderPassEncoderSetBindGroup(
+                             apiPass, 1, apiBindGroup, offsets.size(),
+                             MatchesLambda([offsets](const uint32_t* actual) -> bool {
+                                 return std::equal(offsets.begin(), offsets.end(), actual);
+                             })));
+        EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 2, nullptr, 0, _));
+        EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 3, apiBuffer, 16,
+                                                          WGPU_WHOLE_SIZE));
+        EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 4, nullptr, 0, 0));
+        EXPECT_CALL(api, RenderPassEncoderSetIndexBuffer(apiPass, apiBuffer,
+                                                         WGPUIndexFormat_Uint32, 32, 64));
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 2, 1, 0xFFFF'FFFFu));
+        EXPECT_CALL(api, RenderPassEncoderDrawIndexed(apiPass, 6, 1, 5, -7, 0));
+        EXPECT_CALL(api, RenderPassEncoderDrawIndexed(apiPass, 6, 1, 5,
+                                                      std::numeric_limits<int32_t>::min(), 0));
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass));
+    }
+    FlushClient();
+}
+
+// Test that commands setting the state to its current value are skipped.
+TEST_F(WireRenderPassCommandBatchTests, RedundantStateIsSkipped) {
+    WGPURenderPipeline apiPipeline;
+    WGPURenderPipeline pipeline = CreateRenderPipeline(&apiPipeline);
+    WGPUBindGroup apiBindGroup;
+    WGPUBindGroup bindGroup = CreateBindGroup(&apiBindGroup);
+    WGPUBuffer apiBuffer;
+    WGPUBuffer buffer = CreateBuffer(&apiBuffer);
+
+    uint32_t offset = 0;
+    for (int i = 0; i < 3; ++i) {
+        wgpuRenderPassEncoderSetPipeline(pass, pipeline);
+        wgpuRenderPassEncoderSetBindGroup(pass, 0, bindGroup, 0, nullptr);
+        // Bind groups with dynamic offsets are never skipped.
+        wgpuRenderPassEncoderSetBindGroup(pass, 1, bindGroup, 1, &offset);
+        wgpuRenderPassEncoderSetVertexBuffer(pass, 0, buffer, 0, WGPU_WHOLE_SIZE);
+        wgpuRenderPassEncoderSetIndexBuffer(pass, buffer, WGPUIndexFormat_Uint16, 0, 128);
+        wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    }
+    wgpuRenderPassEncoderEnd(pass);
+
+    EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass, apiPipeline)).Times(1);
+    EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 0, apiBindGroup, 0, _)).Times(1);
+    EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 1, apiBindGroup, 1, _)).Times(3);
+    EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 0, apiBuffer, 0, WGPU_WHOLE_SIZE))
+        .Times(1);
+    EXPECT_CALL(api,
+                RenderPassEncoderSetIndexBuffer(apiPass, apiBuffer, WGPUIndexFormat_Uint16, 0, 128))
+        .Times(1);
+    EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, 0, 0)).Times(3);
+    EXPECT_CALL(api, RenderPassEncoderEnd(apiPass));
+    FlushClient();
+}
+
+// Test that changing the state back to a previous value isn't skipped.
+TEST_F(WireRenderPassCommandBatchTests, StateChangesAreForwarded) {
+    WGPUBindGroup apiBindGroupA;
+    WGPUBindGroup bindGroupA = CreateBindGroup(&apiBindGroupA);
+    WGPUBindGroup apiBindGroupB;
+    WGPUBindGroup bindGroupB = CreateBindGroup(&apiBindGroupB);
+
+    wgpuRenderPassEncoderSetBindGroup(pass, 0, bindGroupA, 0, nullptr);
+    wgpuRenderPassEncoderSetBindGroup(pass, 0, bindGroupB, 0, nullptr);
+    wgpuRenderPassEncoderSetBindGroup(pass, 0, bindGroupA, 0, nullptr);
+    wgpuRenderPassEncoderEnd(pass);
+
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 0, apiBindGroupA, 0, _));
+        EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 0, apiBindGroupB, 0, _));
+        EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 0, apiBindGroupA, 0, _));
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass));
+    }
+    FlushClient();
+}
+
+// Test that the draw arguments that aren't sent are restored from the previous draws.
+TEST_F(WireRenderPassCommandBatchTests, DrawArgumentsAreDeltaEncoded) {
+    wgpuRenderPassEncoderDraw(pass, 0, 1, 0, 0);
+    wgpuRenderPassEncoderDraw(pass, 6, 1, 0, 0);
+    wgpuRenderPassEncoderDraw(pass, 6, 1, 6, 0);
+    wgpuRenderPassEncoderDrawIndexed(pass, 6, 4, 6, -1, 0);
+    wgpuRenderPassEncoderDraw(pass, 6, 4, 6, 2);
+    wgpuRenderPassEncoderDrawIndexed(pass, 12, 4, 6, -1, 2);
+    wgpuRenderPassEncoderDrawIndexed(pass, 12, 4, 6, 0, 2);
+    wgpuRenderPassEncoderEnd(pass);
+
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 0, 1, 0, 0));
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 6, 1, 0, 0));
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 6, 1, 6, 0));
+        EXPECT_CALL(api, RenderPassEncoderDrawIndexed(apiPass, 6, 4, 6, -1, 0));
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 6, 4, 6, 2));
+        EXPECT_CALL(api, RenderPassEncoderDrawIndexed(apiPass, 12, 4, 6, -1, 2));
+        EXPECT_CALL(api, RenderPassEncoderDrawIndexed(apiPass, 12, 4, 6, 0, 2));
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass));
+    }
+    FlushClient();
+}
+
+// Test that commands that aren't batched are ordered correctly with the batched ones, and that the
+// state tracking doesn't skip commands across them.
+TEST_F(WireRenderPassCommandBatchTests, InterleavedCommands) {
+    WGPURenderPipeline apiPipeline;
+    WGPURenderPipeline pipeline = CreateRenderPipeline(&apiPipeline);
+
+    wgpuRenderPassEncoderSetPipeline(pass, pipeline);
+    wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    wgpuRenderPassEncoderSetViewport(pass, 0, 0, 1, 1, 0, 1);
+    wgpuRenderPassEncoderSetPipeline(pass, pipeline);
+    wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    wgpuRenderPassEncoderEnd(pass);
+
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass, apiPipeline));
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, 0, 0));
+        EXPECT_CALL(api, RenderPassEncoderSetViewport(apiPass, 0, 0, 1, 1, 0, 1));
+        EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass, apiPipeline));
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, 0, 0));
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass));
+    }
+    FlushClient();
+}
+
+// Test that commands recorded on different encoders are kept in order.
+TEST_F(WireRenderPassCommandBatchTests, MultipleEncoders) {
+    WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(device, nullptr);
+    WGPUCommandEncoder apiEncoder2 = api.GetNewCommandEncoder();
+    EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr)).WillOnce(Return(apiEncoder2));
+
+    WGPURenderPassDescriptor passDescriptor = WGPU_RENDER_PASS_DESCRIPTOR_INIT;
+    WGPURenderPassEncoder pass2 = wgpuCommandEncoderBeginRenderPass(encoder, &passDescriptor);
+    WGPURenderPassEncoder apiPass2 = api.GetNewRenderPassEncoder();
+    EXPECT_CALL(api, CommandEncoderBeginRenderPass(apiEncoder2, _)).WillOnce(Return(apiPass2));
+    FlushClient();
+
+    wgpuRenderPassEncoderDraw(pass, 1, 1, 0, 0);
+    wgpuRenderPassEncoderDraw(pass2, 2, 1, 0, 0);
+    wgpuRenderPassEncoderDraw(pass2, 2, 1, 0, 0);
+    wgpuRenderPassEncoderDraw(pass, 1, 1, 0, 0);
+    wgpuRenderPassEncoderEnd(pass);
+    wgpuRenderPassEncoderEnd(pass2);
+
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 1, 1, 0, 0));
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass2, 2, 1, 0, 0)).Times(2);
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 1, 1, 0, 0));
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass));
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass2));
+    }
+    FlushClient();
+}
+
+// Test that releasing objects used by the batch keeps them alive until the batch is executed.
+TEST_F(WireRenderPassCommandBatchTests, ReleaseAfterUse) {
+    WGPUBuffer apiBuffer;
+    WGPUBuffer buffer = CreateBuffer(&apiBuffer);
+
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 0, buffer, 0, 4);
+    wgpuBufferRelease(buffer);
+
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 0, apiBuffer, 0, 4));
+        EXPECT_CALL(api, BufferRelease(apiBuffer));
+    }
+    FlushClient();
+}
+
+// Test that large batches are split without losing their state.
+TEST_F(WireRenderPassCommandBatchTests, ManyDraws) {
+    constexpr uint32_t kDrawCount = 100'000;
+    for (uint32_t i = 0; i < kDrawCount; ++i) {
+        wgpuRenderPassEncoderDraw(pass, 3, 1, i * 3, 0);
+    }
+    wgpuRenderPassEncoderEnd(pass);
+
+    uint32_t drawIndex = 0;
+    EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, _, 0))
+        .Times(kDrawCount)
+        .WillRepeatedly([&](WGPURenderPassEncoder, uint32_t, uint32_t, uint32_t firstVertex,
+                            uint32_t) {
+            EXPECT_EQ(firstVertex, drawIndex * 3);
+            drawIndex++;
+        });
+    EXPECT_CALL(api, RenderPassEncoderEnd(apiPass));
+    FlushClient();
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
@@ -0,0 +1,327 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/utils/SharedMemoryCommandBuffer.h"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+#include "dawn/common/Platform.h"
+
+#if DAWN_PLATFORM_IS(LINUX)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace dawn::utils {
+
+// The control block at the start of the shared memory. The positions are monotonically increasing
+// byte counts, wrapped to the capacity of the ring buffer when accessing it. The fields written by
+// each side are on different cache lines.
+struct SharedMemoryCommandBufferControl {
+    uint64_t capacity;
+
+    // Written by the serializer.
+    alignas(kSharedMemoryCommandBufferAlignment) std::atomic<uint64_t> head;
+    // Incremented when the head moves or the ring buffer is closed, to wake the receiver.
+    std::atomic<uint32_t> headSignal;
+    std::atomic<uint32_t> receiverWaiting;
+
+    // Written by the receiver.
+    alignas(kSharedMemoryCommandBufferAlignment) std::atomic<uint64_t> tail;
+    // Incremented when the tail moves or the ring buffer is closed, to wake the serializer.
+    std::atomic<uint32_t> tailSignal;
+    std::atomic<uint32_t> serializerWaiting;
+
+    alignas(kSharedMemoryCommandBufferAlignment) std::atomic<uint32_t> isClosed;
+};
+
+namespace {
+
+using Control = SharedMemoryCommandBufferControl;
+
+// The shared memory may be used from different processes, so the atomics must not use locks.
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+// The commands are published in blocks of contiguous commands that start with a BlockHeader
+// aligned to kBlockAlignment. A block with kWrapBlockSize as size marks that the next block
+// is at the start of the ring buffer.
+struct BlockHeader {
+    uint32_t size;
+    uint32_t padding;
+};
+constexpr size_t kBlockAlignment = sizeof(BlockHeader);
+constexpr uint32_t kWrapBlockSize = ~uint32_t(0);
+
+// The ring buffer starts right after the control block, which is a multiple of its alignment.
+constexpr size_t kControlSize = sizeof(Control);
+static_assert(kControlSize % kSharedMemoryCommandBufferAlignment == 0);
+
+void WaitForSignal(std::atomic<uint32_t>* signal, uint32_t value) {
+#if DAWN_PLATFORM_IS(LINUX)
+    // The futex isn't FUTEX_PRIVATE_FLAG since the memory may be shared between processes.
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(signal), FUTEX_WAIT, value, nullptr, nullptr,
+            0);
+#else
+    while (signal->load(std::memory_order_acquire) == value) {
+        std::this_thread::yield();
+    }
+#endif
+}
+
+void Signal(std::atomic<uint32_t>* signal, const std::atomic<uint32_t>& isWaiting) {
+    signal->fetch_add(1, std::memory_order_seq_cst);
+#if DAWN_PLATFORM_IS(LINUX)
+    if (isWaiting.load(std::memory_order_seq_cst) != 0) {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(signal), FUTEX_WAKE, INT32_MAX, nullptr,
+                nullptr, 0);
+    }
+#endif
+}
+
+// Waits until |isReady| returns true, with the signal of the other side.
+template <typename F>
+void WaitUntil(std::atomic<uint32_t>* signal, std::atomic<uint32_t>* isWaiting, F isReady) {
+    while (true) {
+        uint32_t value = signal->load(std::memory_order_seq_cst);
+        if (isReady()) {
+            return;
+        }
+        isWaiting->store(1, std::memory_order_seq_cst);
+        // Check again now that the other side will signal the change.
+        if (!isReady()) {
+            WaitForSignal(signal, value);
+        }
+        isWaiting->store(0, std::memory_order_seq_cst);
+    }
+}
+
+Control* GetControl(void* memory, size_t memorySize) {
+    DAWN_ASSERT(IsPtrAligned(memory, kSharedMemoryCommandBufferAlignment));
+    DAWN_ASSERT(memorySize > kControlSize);
+    Control* control = static_cast<Control*>(memory);
+    DAWN_ASSERT(control->capacity == memorySize - kControlSize);
+    return control;
+}
+
+char* GetData(void* memory) {
+    return static_cast<char*>(memory) + kControlSize;
+}
+
+}  // anonymous namespace
+
+size_t GetSharedMemoryCommandBufferSize(size_t capacity) {
+    return kControlSize + Align(capacity, kSharedMemoryCommandBufferAlignment);
+}
+
+void InitializeSharedMemoryCommandBuffer(void* memory, size_t memorySize) {
+    DAWN_ASSERT(IsPtrAligned(memory, kSharedMemoryCommandBufferAlignment));
+    DAWN_ASSERT(memorySize >= GetSharedMemoryCommandBufferSize(kBlockAlignment * 4));
+    DAWN_ASSERT(IsAligned(memorySize, kSharedMemoryCommandBufferAlignment));
+    Control* control = new (memory) Control();
+    control->capacity = memorySize - kControlSize;
+    control->head.store(0);
+    control->headSignal.store(0);
+    control->receiverWaiting.store(0);
+    control->tail.store(0);
+    control->tailSignal.store(0);
+    control->serializerWaiting.store(0);
+    control->isClosed.store(0);
+}
+
+// SharedMemoryCommandSerializer
+
+SharedMemoryCommandSerializer::SharedMemoryCommandSerializer(void* memory, size_t memorySize)
+    : mControl(GetControl(memory, memorySize)),
+      mData(GetData(memory)),
+      mCapacity(mControl->capacity) {
+    mHead = mControl->head.load(std::memory_order_acquire);
+}
+
+SharedMemoryCommandSerializer::~SharedMemoryCommandSerializer() = default;
+
+size_t SharedMemoryCommandSerializer::GetMaximumAllocationSize() const {
+    // A block of this size always fits in an empty ring buffer, even after wrapping from its end.
+    return mCapacity / 2 - kBlockAlignment;
+}
+
+void* SharedMemoryCommandSerializer::GetCmdSpace(size_t size) {
+    DAWN_ASSERT(size <= GetMaximumAllocationSize());
+
+    // Append the commands to the current block if it doesn't need to wrap or wait.
+    if (mHasOpenBlock) {
+        uint64_t blockEnd = mBlockStart % mCapacity + (mHead - mBlockStart) + size;
+        if (blockEnd <= mCapacity && HasSpace(size)) {
+            char* result = mData + mHead % mCapacity;
+            mHead += size;
+            return result;
+        }
+        CloseBlock();
+    }
+
+    // Start a new block, wrapping to the start of the ring buffer if it doesn't fit at the end.
+    uint64_t offset = mHead % mCapacity;
+    uint64_t blockSize = sizeof(BlockHeader) + size;
+    uint64_t wrapSize = offset + blockSize > mCapacity ? mCapacity - offset : 0;
+    if (!WaitForSpace(wrapSize + blockSize)) {
+        return nullptr;
+    }
+    if (wrapSize != 0) {
+        BlockHeader wrapHeader = {kWrapBlockSize, 0};
+        memcpy(mData + offset, &wrapHeader, sizeof(wrapHeader));
+        mHead += wrapSize;
+    }
+
+    mBlockStart = mHead;
+    mHasOpenBlock = true;
+    mHead += sizeof(BlockHeader);
+    char* result = mData + mHead % mCapacity;
+    mHead += size;
+    return result;
+}
+
+bool SharedMemoryCommandSerializer::Flush() {
+    if (mControl->isClosed.load(std::memory_order_acquire)) {
+        return false;
+    }
+    CloseBlock();
+    Publish();
+    return true;
+}
+
+void SharedMemoryCommandSerializer::Close() {
+    CloseBlock();
+    Publish();
+    mControl->isClosed.store(1, std::memory_order_seq_cst);
+    Signal(&mControl->headSignal, mControl->receiverWaiting);
+}
+
+void SharedMemoryCommandSerializer::CloseBlock() {
+    if (!mHasOpenBlock) {
+        return;
+    }
+    BlockHeader header = {static_cast<uint32_t>(mHead - mBlockStart - sizeof(BlockHeader)), 0};
+    memcpy(mData + mBlockStart % mCapacity, &header, sizeof(header));
+    mHead = Align(mHead, kBlockAlignment);
+    mHasOpenBlock = false;
+}
+
+void SharedMemoryCommandSerializer::Publish() {
+    DAWN_ASSERT(!mHasOpenBlock);
+    if (mControl->head.load(std::memory_order_relaxed) == mHead) {
+        return;
+    }
+    mControl->head.store(mHead, std::memory_order_seq_cst);
+    Signal(&mControl->headSignal, mControl->receiverWaiting);
+}
+
+bool SharedMemoryCommandSerializer::HasSpace(uint64_t size) const {
+    return mCapacity - (mHead - mControl->tail.load(std::memory_order_acquire)) >= size;
+}
+
+bool SharedMemoryCommandSerializer::WaitForSpace(uint64_t size) {
+    DAWN_ASSERT(!mHasOpenBlock);
+    if (HasSpace(size)) {
+        return true;
+    }
+
+    // Let the receiver consume the commands that are waiting for space.
+    Publish();
+    WaitUntil(&mControl->tailSignal, &mControl->serializerWaiting, [&] {
+        return HasSpace(size) || mControl->isClosed.load(std::memory_order_acquire);
+    });
+    return !mControl->isClosed.load(std::memory_order_acquire);
+}
+
+// SharedMemoryCommandReceiver
+
+SharedMemoryCommandReceiver::SharedMemoryCommandReceiver(void* memory, size_t memorySize)
+    : mControl(GetControl(memory, memorySize)),
+      mData(GetData(memory)),
+      mCapacity(mControl->capacity) {
+    mTail = mControl->tail.load(std::memory_order_acquire);
+}
+
+SharedMemoryCommandReceiver::~SharedMemoryCommandReceiver() = default;
+
+bool SharedMemoryCommandReceiver::HandleCommands(dawn::wire::CommandHandler* handler) {
+    WaitUntil(&mControl->headSignal, &mControl->receiverWaiting, [&] {
+        return mControl->head.load(std::memory_order_acquire) != mTail ||
+               mControl->isClosed.load(std::memory_order_acquire);
+    });
+    uint64_t head = mControl->head.load(std::memory_order_acquire);
+    if (head == mTail) {
+        // The serializer is closed and all its commands were handled.
+        return false;
+    }
+    return HandlePublishedCommands(handler, head);
+}
+
+bool SharedMemoryCommandReceiver::TryHandleCommands(dawn::wire::CommandHandler* handler) {
+    uint64_t head = mControl->head.load(std::memory_order_acquire);
+    if (head == mTail) {
+        return !mControl->isClosed.load(std::memory_order_acquire);
+    }
+    return HandlePublishedCommands(handler, head);
+}
+
+bool SharedMemoryCommandReceiver::HandlePublishedCommands(dawn::wire::CommandHandler* handler,
+                                                          uint64_t head) {
+    while (mTail != head) {
+        uint64_t offset = mTail % mCapacity;
+        BlockHeader header;
+        memcpy(&header, mData + offset, sizeof(header));
+
+        // The serializer may be in another process, so the block is validated before use.
+        uint64_t blockEnd = header.size == kWrapBlockSize
+                                ? mTail + (mCapacity - offset)
+                                : Align(mTail + sizeof(BlockHeader) + header.size, kBlockAlignment);
+        bool isValid = blockEnd <= head && (header.size == kWrapBlockSize ||
+                                            offset + sizeof(BlockHeader) + header.size <= mCapacity);
+        if (!isValid || (header.size != kWrapBlockSize &&
+                         handler->HandleCommands(mData + offset + sizeof(BlockHeader),
+                                                 header.size) == nullptr)) {
+            mControl->isClosed.store(1, std::memory_order_seq_cst);
+            Signal(&mControl->tailSignal, mControl->serializerWaiting);
+            return false;
+        }
+
+        // Release the space of each block as soon as it is handled.
+        mTail = blockEnd;
+        mControl->tail.store(mTail, std::memory_order_seq_cst);
+        Signal(&mControl->tailSignal, mControl->serializerWaiting);
+    }
+    return true;
+}
+
+}  // namespace dawn::utils
@@ -0,0 +1,118 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_UTILS_SHAREDMEMORYCOMMANDBUFFER_H_
+#define SRC_DAWN_UTILS_SHAREDMEMORYCOMMANDBUFFER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "dawn/wire/Wire.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+namespace dawn::utils {
+
+// A single-producer single-consumer ring buffer of wire commands in memory that is shared between
+// the wire client and server, for example with memfd_create or shm_open and mmap when they run in
+// different processes. It can also be used between two threads of the same process.
+//
+// The serializer returns space in the ring buffer from GetCmdSpace so that commands are
+// serialized in place, and Flush publishes them to the receiver which passes them to its
+// CommandHandler directly from the ring buffer. When the ring buffer is full the serializer waits
+// for the receiver to consume commands instead of failing. The threads are woken with futexes on
+// Linux and Android and by polling on the other platforms.
+//
+// The shared memory starts with a control block followed by the ring buffer. It must be
+// initialized with InitializeSharedMemoryCommandBuffer before the serializer and receiver are
+// created.
+constexpr size_t kSharedMemoryCommandBufferAlignment = 64;
+
+// Returns the size of the shared memory needed for a ring buffer of |capacity| bytes.
+size_t GetSharedMemoryCommandBufferSize(size_t capacity);
+
+// Initializes the control block of |memory|. |memory| must be aligned to
+// kSharedMemoryCommandBufferAlignment and its size be returned by GetSharedMemoryCommandBufferSize.
+void InitializeSharedMemoryCommandBuffer(void* memory, size_t memorySize);
+
+struct SharedMemoryCommandBufferControl;
+
+class SharedMemoryCommandSerializer : public dawn::wire::CommandSerializer {
+  public:
+    SharedMemoryCommandSerializer(void* memory, size_t memorySize);
+    ~SharedMemoryCommandSerializer() override;
+
+    size_t GetMaximumAllocationSize() const override;
+    void* GetCmdSpace(size_t size) override;
+    bool Flush() override;
+
+    // Flushes the commands and makes the receiver stop once it handled them.
+    void Close();
+
+  private:
+    void CloseBlock();
+    void Publish();
+    bool HasSpace(uint64_t size) const;
+    // Waits until |size| bytes are free in the ring buffer. Returns false if the receiver closed.
+    bool WaitForSpace(uint64_t size);
+
+    raw_ptr<SharedMemoryCommandBufferControl> mControl;
+    raw_ptr<char, AllowPtrArithmetic> mData;
+    uint64_t mCapacity;
+
+    // The position after the last serialized command, which is ahead of the published position
+    // until the next Flush.
+    uint64_t mHead = 0;
+    // The position of the header of the block of commands being serialized, if any.
+    uint64_t mBlockStart = 0;
+    bool mHasOpenBlock = false;
+};
+
+class SharedMemoryCommandReceiver {
+  public:
+    SharedMemoryCommandReceiver(void* memory, size_t memorySize);
+    ~SharedMemoryCommandReceiver();
+
+    // Passes the published commands to |handler|, waiting for some if there are none. Returns
+    // false once the serializer is closed and all its commands are handled, or if |handler|
+    // fails, which also closes the ring buffer.
+    bool HandleCommands(dawn::wire::CommandHandler* handler);
+
+    // Like HandleCommands, but returns without waiting when no commands are published.
+    bool TryHandleCommands(dawn::wire::CommandHandler* handler);
+
+  private:
+    bool HandlePublishedCommands(dawn::wire::CommandHandler* handler, uint64_t head);
+
+    raw_ptr<SharedMemoryCommandBufferControl> mControl;
+    raw_ptr<char, AllowPtrArithmetic> mData;
+    uint64_t mCapacity;
+    uint64_t mTail = 0;
+};
+
+}  // namespace dawn::utils
+
+#endif  // SRC_DAWN_UTILS_SHAREDMEMORYCOMMANDBUFFER_H_
@@ -0,0 +1,93 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/wire/PassCommandBatch.h"
+
+#include <limits>
+
+namespace dawn::wire {
+
+void AppendVarint(std::vector<uint8_t>* data, uint64_t value) {
+    while (value >= 0x80) {
+        data->push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    data->push_back(static_cast<uint8_t>(value));
+}
+
+PassCommandBatchReader::PassCommandBatchReader(const uint8_t* data, size_t size)
+    : mData(data), mEnd(data + size) {}
+
+bool PassCommandBatchReader::IsEmpty() const {
+    return mData == mEnd;
+}
+
+size_t PassCommandBatchReader::GetRemainingSize() const {
+    return static_cast<size_t>(mEnd - mData);
+}
+
+WireResult PassCommandBatchReader::ReadByte(uint8_t* value) {
+    if (IsEmpty()) {
+        return WireResult::FatalError;
+    }
+    *value = *mData;
+    mData++;
+    return WireResult::Success;
+}
+
+WireResult PassCommandBatchReader::ReadVarint(uint64_t* value) {
+    uint64_t result = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7) {
+        uint8_t byte;
+        WIRE_TRY(ReadByte(&byte));
+
+        uint64_t bits = byte & 0x7F;
+        // The last byte of a 64-bit value only has a single significant bit.
+        if (shift == 63 && bits > 1) {
+            return WireResult::FatalError;
+        }
+        result |= bits << shift;
+
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            return WireResult::Success;
+        }
+    }
+    return WireResult::FatalError;
+}
+
+WireResult PassCommandBatchReader::ReadVarint(uint32_t* value) {
+    uint64_t result;
+    WIRE_TRY(ReadVarint(&result));
+    if (result > std::numeric_limits<uint32_t>::max()) {
+        return WireResult::FatalError;
+    }
+    *value = static_cast<uint32_t>(result);
+    return WireResult::Success;
+}
+
+}  // namespace dawn::wire
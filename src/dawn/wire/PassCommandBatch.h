@@ -0,0 +1,111 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_WIRE_PASSCOMMANDBATCH_H_
+#define SRC_DAWN_WIRE_PASSCOMMANDBATCH_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "dawn/wire/WireResult.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+namespace dawn::wire {
+
+// Format of the data of a RenderPassEncoderCommandBatchCmd, which packs consecutive commands
+// recorded on a render pass encoder. Each command starts with a byte holding its opcode in the low
+// bits, followed by its arguments encoded as LEB128 varints. Object IDs are encoded as is, with 0
+// meaning nullptr, and buffer sizes are encoded as size + 1, wrapping around, so that
+// WGPU_WHOLE_SIZE takes a single byte.
+//
+// Draws don't repeat the arguments that are the same as in the previous draw of the batch: the
+// high bits of their opcode byte hold a mask of the arguments that follow, indexed by
+// BatchedDrawArgument. Arguments that aren't in the mask keep their previous value, starting from
+// kInitialBatchedDrawArguments at the start of the batch.
+enum class BatchedPassCommand : uint8_t {
+    SetPipeline = 0,
+    SetBindGroup = 1,
+    SetVertexBuffer = 2,
+    SetIndexBuffer = 3,
+    Draw = 4,
+    DrawIndexed = 5,
+};
+
+static constexpr uint8_t kBatchedPassCommandMask = 0x7;
+static constexpr uint32_t kBatchedDrawArgumentMaskShift = 3;
+
+// The vertex or index count and first vertex or index are shared between Draw and DrawIndexed.
+// Draw doesn't use the base vertex, which is stored zigzag encoded.
+enum BatchedDrawArgument : uint8_t {
+    Count = 0,
+    InstanceCount = 1,
+    First = 2,
+    BaseVertex = 3,
+    FirstInstance = 4,
+};
+
+static constexpr size_t kBatchedDrawArgumentCount = 5;
+using BatchedDrawArguments = std::array<uint32_t, kBatchedDrawArgumentCount>;
+static constexpr BatchedDrawArguments kInitialBatchedDrawArguments = {0, 1, 0, 0, 0};
+
+// The arguments of each kind of draw, as a mask of BatchedDrawArgument.
+static constexpr uint8_t kBatchedDrawArgumentsMask = 0b10111;
+static constexpr uint8_t kBatchedDrawIndexedArgumentsMask = 0b11111;
+
+inline uint32_t ZigZagEncode(int32_t value) {
+    return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+}
+
+inline int32_t ZigZagDecode(uint32_t value) {
+    return static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+void AppendVarint(std::vector<uint8_t>* data, uint64_t value);
+
+// Reads the data of a RenderPassEncoderCommandBatchCmd, failing on truncated data and on values
+// that overflow their type.
+class PassCommandBatchReader {
+  public:
+    PassCommandBatchReader(const uint8_t* data, size_t size);
+
+    bool IsEmpty() const;
+    size_t GetRemainingSize() const;
+
+    WireResult ReadByte(uint8_t* value);
+    WireResult ReadVarint(uint64_t* value);
+    WireResult ReadVarint(uint32_t* value);
+
+  private:
+    raw_ptr<const uint8_t, AllowPtrArithmetic> mData;
+    raw_ptr<const uint8_t, AllowPtrArithmetic> mEnd;
+};
+
+}  // namespace dawn::wire
+
+#endif  // SRC_DAWN_WIRE_PASSCOMMANDBATCH_H_
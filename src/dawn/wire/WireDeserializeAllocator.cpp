@@ -28,46 +28,91 @@
 #include "dawn/wire/WireDeserializeAllocator.h"
 
 #include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "dawn/common/Alloc.h"
+#include "dawn/common/Math.h"
 
 namespace dawn::wire {
 WireDeserializeAllocator::WireDeserializeAllocator() {
-    Reset();
+    UseBuffer(mStaticBuffer, sizeof(mStaticBuffer));
 }
 
-WireDeserializeAllocator::~WireDeserializeAllocator() {
-    Reset();
-}
+WireDeserializeAllocator::~WireDeserializeAllocator() = default;
 
 void* WireDeserializeAllocator::GetSpace(size_t size) {
-    // Return space in the current buffer if possible first.
-    if (mRemainingSize >= size) {
-        char* buffer = mCurrentBuffer;
-        mCurrentBuffer += size;
-        mRemainingSize -= size;
-        return buffer;
+    // Keep all the allocations aligned, even after odd-sized ones like strings.
+    if (size > std::numeric_limits<size_t>::max() - kWireBufferAlignment) {
+        return nullptr;
     }
+    size = Align(size, kWireBufferAlignment);
 
-    // Otherwise allocate a new buffer and try again.
-    size_t allocationSize = std::max(size, size_t(2048));
-    char* allocation = static_cast<char*>(malloc(allocationSize));
-    if (allocation == nullptr) {
-        return nullptr;
+    // Return space in the current buffer if possible first.
+    if (mRemainingSize < size) {
+        // Then look for a retained chunk large enough. Chunks that are skipped stay unused for
+        // the rest of the command.
+        while (mNextChunk < mChunks.size() && mChunks[mNextChunk].size < size) {
+            mNextChunk++;
+        }
+
+        // Otherwise allocate a new chunk, growing geometrically up to kMaxChunkSize unless the
+        // allocation itself is larger.
+        if (mNextChunk == mChunks.size()) {
+            size_t chunkSize = mChunks.empty() ? kMinChunkSize : mChunks.back().size * 2;
+            chunkSize = std::max(size, std::min(chunkSize, kMaxChunkSize));
+
+            std::unique_ptr<char[]> data(AllocNoThrow<char>(chunkSize));
+            if (data == nullptr) {
+                return nullptr;
+            }
+            mChunks.push_back({std::move(data), chunkSize});
+            mRetainedChunkSize += chunkSize;
+            mStats.chunkAllocationCount++;
+        }
+
+        Chunk& chunk = mChunks[mNextChunk++];
+        UseBuffer(chunk.data.get(), chunk.size);
     }
 
-    mAllocations.push_back(allocation);
-    mCurrentBuffer = allocation;
-    mRemainingSize = allocationSize;
-    return GetSpace(size);
+    char* buffer = mCurrentBuffer;
+    mCurrentBuffer += size;
+    mRemainingSize -= size;
+    mCommandBytes += size;
+    return buffer;
 }
 
 void WireDeserializeAllocator::Reset() {
-    // The initial buffer is the inline buffer so that some allocations can be skipped
-    mCurrentBuffer = mStaticBuffer;
-    mRemainingSize = sizeof(mStaticBuffer);
+    mStats.commandCount++;
+    mStats.allocatedBytes += mCommandBytes;
+    mStats.maxCommandBytes = std::max(mStats.maxCommandBytes, uint64_t(mCommandBytes));
+    if (mNextChunk != 0) {
+        mStats.overflowCount++;
+    }
+    mCommandBytes = 0;
 
-    for (auto& allocation : mAllocations) {
-        free(allocation.ExtractAsDangling());
+    // Free the most recent, and largest, chunks until the retained size is under the limit.
+    while (mRetainedChunkSize > kMaxRetainedChunkSize) {
+        mRetainedChunkSize -= mChunks.back().size;
+        mChunks.pop_back();
+        mStats.chunkFreeCount++;
     }
-    mAllocations.clear();
+
+    // The initial buffer is the inline buffer so that some allocations can be skipped
+    mNextChunk = 0;
+    UseBuffer(mStaticBuffer, sizeof(mStaticBuffer));
+}
+
+const WireDeserializeAllocator::Stats& WireDeserializeAllocator::GetStats() const {
+    return mStats;
+}
+
+size_t WireDeserializeAllocator::GetRetainedChunkSize() const {
+    return mRetainedChunkSize;
+}
+
+void WireDeserializeAllocator::UseBuffer(char* buffer, size_t size) {
+    mCurrentBuffer = buffer;
+    mRemainingSize = size;
 }
 }  // namespace dawn::wire
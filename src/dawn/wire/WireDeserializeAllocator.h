@@ -28,17 +28,43 @@
 #ifndef SRC_DAWN_WIRE_WIREDESERIALIZEALLOCATOR_H_
 #define SRC_DAWN_WIRE_WIREDESERIALIZEALLOCATOR_H_
 
+#include <cstdint>
+#include <memory>
 #include <vector>
 
+#include "dawn/common/Constants.h"
 #include "dawn/wire/WireCmd_autogen.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
 namespace dawn::wire {
-// A really really simple implementation of the DeserializeAllocator. It's main feature
-// is that it has some inline storage so as to avoid allocations for the majority of
-// commands.
+
+// An arena used to store the structures pointed to by deserialized commands. Space is handed out
+// from an inline buffer first, then from heap chunks of geometrically increasing size. Reset()
+// rewinds the arena after each command but keeps the heap chunks so that the following commands
+// and batches of commands don't need to allocate again. Only the chunks beyond
+// kMaxRetainedChunkSize bytes are freed, so that a single huge command doesn't pin its memory.
 class WireDeserializeAllocator : public DeserializeAllocator {
   public:
+    static constexpr size_t kInlineSize = 2048;
+    static constexpr size_t kMinChunkSize = 4096;
+    static constexpr size_t kMaxChunkSize = 256 * 1024;
+    static constexpr size_t kMaxRetainedChunkSize = 1024 * 1024;
+
+    // Counters accumulated over the lifetime of the allocator, used to size the arena.
+    struct Stats {
+        // The number of commands, counted as the number of calls to Reset().
+        uint64_t commandCount = 0;
+        // The total number of bytes requested by all the commands.
+        uint64_t allocatedBytes = 0;
+        // The largest number of bytes requested by a single command.
+        uint64_t maxCommandBytes = 0;
+        // The number of commands that didn't fit in the inline buffer.
+        uint64_t overflowCount = 0;
+        // The number of heap chunks allocated, and then freed because they were over the limit.
+        uint64_t chunkAllocationCount = 0;
+        uint64_t chunkFreeCount = 0;
+    };
+
     WireDeserializeAllocator();
     virtual ~WireDeserializeAllocator();
 
@@ -46,11 +72,30 @@ class WireDeserializeAllocator : public DeserializeAllocator {
 
     void Reset();
 
+    const Stats& GetStats() const;
+    // The number of bytes in heap chunks currently owned by the allocator.
+    size_t GetRetainedChunkSize() const;
+
   private:
+    struct Chunk {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    void UseBuffer(char* buffer, size_t size);
+
     size_t mRemainingSize = 0;
     raw_ptr<char, AllowPtrArithmetic> mCurrentBuffer = nullptr;
-    char mStaticBuffer[2048];
-    std::vector<raw_ptr<char>> mAllocations;
+    alignas(kWireBufferAlignment) char mStaticBuffer[kInlineSize];
+
+    // The heap chunks, in the order they are used. mNextChunk is the index of the first chunk
+    // that hasn't been used by the current command.
+    std::vector<Chunk> mChunks;
+    size_t mNextChunk = 0;
+    size_t mRetainedChunkSize = 0;
+
+    size_t mCommandBytes = 0;
+    Stats mStats;
 };
 }  // namespace dawn::wire
 
@@ -50,13 +50,18 @@ class NoopCommandSerializer final : public CommandSerializer {
 
 }  // anonymous namespace
 
-Client::Client(CommandSerializer* serializer, MemoryTransferService* memoryTransferService)
+Client::Client(CommandSerializer* serializer,
+               MemoryTransferService* memoryTransferService,
+               bool enableRenderPassCommandBatching)
     : ClientBase(), mSerializer(serializer), mMemoryTransferService(memoryTransferService) {
     if (mMemoryTransferService == nullptr) {
         // If a MemoryTransferService is not provided, fall back to inline memory.
         mOwnedMemoryTransferService = CreateInlineMemoryTransferService();
         mMemoryTransferService = mOwnedMemoryTransferService.get();
     }
+    if (enableRenderPassCommandBatching) {
+        mRenderPassCommandBatch = std::make_unique<RenderPassCommandBatch>();
+    }
 }
 
 Client::~Client() {
@@ -166,6 +171,24 @@ void Client::ReclaimInstanceReservation(const ReservedInstance& reservation) {
     Free(FromAPI(reservation.instance));
 }
 
+RenderPassCommandBatch* Client::GetRenderPassCommandBatch(ObjectId encoderId) {
+    if (mRenderPassCommandBatch == nullptr) {
+        return nullptr;
+    }
+    if (mRenderPassCommandBatch->GetEncoderId() != encoderId || mRenderPassCommandBatch->IsFull()) {
+        FlushRenderPassCommandBatch();
+        mRenderPassCommandBatch->SetEncoderId(encoderId);
+    }
+    return mRenderPassCommandBatch.get();
+}
+
+void Client::FlushRenderPassCommandBatch() {
+    if (!mRenderPassCommandBatch->IsEmpty()) {
+        mSerializer.SerializeCommand(mRenderPassCommandBatch->GetCommand(), *this);
+    }
+    mRenderPassCommandBatch->Reset();
+}
+
 EventManager& Client::GetEventManager(const ObjectHandle& instance) {
     auto it = mEventManagers.find(instance);
     DAWN_ASSERT(it != mEventManagers.end());
@@ -175,6 +198,9 @@ EventManager& Client::GetEventManager(const ObjectHandle& instance) {
 void Client::Disconnect() {
     mDisconnected = true;
     mSerializer = ChunkedCommandSerializer(NoopCommandSerializer::GetInstance());
+    if (mRenderPassCommandBatch != nullptr) {
+        mRenderPassCommandBatch->Reset();
+    }
 
     // Transition all event managers to ClientDropped state.
     for (auto& [_, eventManager] : mEventManagers) {
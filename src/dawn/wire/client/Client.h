@@ -29,6 +29,7 @@
 #define SRC_DAWN_WIRE_CLIENT_CLIENT_H_
 
 #include <memory>
+#include <new>
 #include <utility>
 
 #include "absl/container/flat_hash_map.h"
@@ -53,7 +54,9 @@ class EventManager;
 
 class Client : public ClientBase {
   public:
-    Client(CommandSerializer* serializer, MemoryTransferService* memoryTransferService);
+    Client(CommandSerializer* serializer,
+           MemoryTransferService* memoryTransferService,
+           bool enableRenderPassCommandBatching = false);
     ~Client() override;
 
     // Make<T>(arg1, arg2, arg3) creates a new T, calling a constructor of the form:
@@ -63,11 +66,15 @@ class Client : public ClientBase {
     Ref<T> Make(Args&&... args) {
         constexpr ObjectType type = ObjectTypeToTypeEnum<T>;
 
-        ObjectBaseParams params = {this, mObjectStores[type].ReserveHandle()};
-        T* object = new T(params, std::forward<Args>(args)...);
+        ObjectStore& store = mObjectStores[type];
+        ObjectBaseParams params = {this, store.ReserveHandle()};
+        void* memory = store.Allocate(sizeof(T), alignof(T));
+        T* object = new (memory) T(params, std::forward<Args>(args)...);
+        // The store frees the memory from the ObjectBase pointer.
+        DAWN_ASSERT(static_cast<ObjectBase*>(object) == memory);
 
         mObjects[type].Append(object);
-        mObjectStores[type].Insert(std::unique_ptr<T>(object));
+        store.Insert(object);
 
         Ref<T> ref;
         ref.Acquire(object);
@@ -100,14 +107,21 @@ class Client : public ClientBase {
 
     template <typename Cmd>
     void SerializeCommand(const Cmd& cmd) {
+        MaybeFlushRenderPassCommandBatch();
         mSerializer.SerializeCommand(cmd, *this);
     }
 
     template <typename Cmd, typename... Extensions>
     void SerializeCommand(const Cmd& cmd, Extensions&&... es) {
+        MaybeFlushRenderPassCommandBatch();
         mSerializer.SerializeCommand(cmd, *this, std::forward<Extensions>(es)...);
     }
 
+    // Returns the batch to record the commands of the render pass encoder |encoderId| in, flushing
+    // the commands of other encoders first, or nullptr if render pass command batching is
+    // disabled.
+    RenderPassCommandBatch* GetRenderPassCommandBatch(ObjectId encoderId);
+
     EventManager& GetEventManager(const ObjectHandle& instance);
 
     void Disconnect();
@@ -116,6 +130,13 @@ class Client : public ClientBase {
   private:
     void DestroyAllObjects();
 
+    void MaybeFlushRenderPassCommandBatch() {
+        if (mRenderPassCommandBatch != nullptr && !mRenderPassCommandBatch->IsEmpty()) {
+            FlushRenderPassCommandBatch();
+        }
+    }
+    void FlushRenderPassCommandBatch();
+
     template <typename T>
     void Free(T* obj) {
         Free(obj, ObjectTypeToTypeEnum<T>);
@@ -128,6 +149,7 @@ class Client : public ClientBase {
     PerObjectType<ObjectStore> mObjectStores;
     std::unique_ptr<MemoryTransferService> mOwnedMemoryTransferService = nullptr;
     raw_ptr<MemoryTransferService> mMemoryTransferService = nullptr;
+    std::unique_ptr<RenderPassCommandBatch> mRenderPassCommandBatch;
     PerObjectType<LinkedList<ObjectBase>> mObjects;
     // Map of instance object handles to a corresponding event manager. Note that for now because we
     // do not have an internal refcount on the instances, i.e. we don't know when the last object
@@ -28,16 +28,42 @@
 #include "dawn/wire/client/ObjectStore.h"
 
 #include <limits>
-#include <utility>
+
+#include "dawn/common/Numeric.h"
+#include "dawn/common/SlabAllocator.h"
 
 namespace dawn::wire::client {
 
+namespace {
+
+// The number of objects in each slab of the allocator.
+constexpr SlabAllocatorImpl::Index kObjectsPerSlab = 64;
+
+}  // anonymous namespace
+
+// A type-erased SlabAllocator, since the type of objects is only known when they are made.
+class ObjectStore::ObjectAllocator final : public SlabAllocatorImpl {
+  public:
+    ObjectAllocator(size_t size, size_t alignment)
+        : SlabAllocatorImpl(kObjectsPerSlab, checked_cast<uint32_t>(size),
+                            checked_cast<uint32_t>(alignment)),
+          mSize(size),
+          mAlignment(alignment) {}
+
+    using SlabAllocatorImpl::Allocate;
+    using SlabAllocatorImpl::Deallocate;
+
+    const size_t mSize;
+    const size_t mAlignment;
+};
+
 ObjectStore::ObjectStore() {
     // ID 0 is nullptr
-    mObjects.emplace_back(nullptr);
     mCurrentId = 1;
 }
 
+ObjectStore::~ObjectStore() = default;
+
 ObjectHandle ObjectStore::ReserveHandle() {
     if (mFreeHandles.empty()) {
         return {mCurrentId++, 0};
@@ -47,19 +73,25 @@ ObjectHandle ObjectStore::ReserveHandle() {
     return handle;
 }
 
-void ObjectStore::Insert(std::unique_ptr<ObjectBase> obj) {
+void* ObjectStore::Allocate(size_t size, size_t alignment) {
+    if (mAllocator == nullptr) {
+        mAllocator = std::make_unique<ObjectAllocator>(size, alignment);
+    }
+    DAWN_ASSERT(mAllocator->mSize == size && mAllocator->mAlignment == alignment);
+    return mAllocator->Allocate();
+}
+
+void ObjectStore::Insert(ObjectBase* obj) {
     ObjectId id = obj->GetWireId();
 
-    if (id >= mObjects.size()) {
-        DAWN_ASSERT(id == mObjects.size());
-        mObjects.emplace_back(std::move(obj));
-    } else {
-        // The generation should never overflow. We don't recycle ObjectIds that would
-        // overflow their next generation.
-        DAWN_ASSERT(obj->GetWireGeneration() != 0);
-        DAWN_ASSERT(mObjects[id] == nullptr);
-        mObjects[id] = std::move(obj);
+    // Add the chunks up to the ID. Chunks are never moved so the entries stay in place.
+    while ((id >> kObjectsPerChunkLog2) >= mObjectChunks.size()) {
+        mObjectChunks.push_back(std::make_unique<raw_ptr<ObjectBase>[]>(kObjectsPerChunk));
     }
+
+    raw_ptr<ObjectBase>& entry = GetEntry(id);
+    DAWN_ASSERT(entry == nullptr);
+    entry = obj;
 }
 
 void ObjectStore::Free(ObjectBase* obj) {
@@ -72,14 +104,22 @@ void ObjectStore::Free(ObjectBase* obj) {
     if (DAWN_LIKELY(currentHandle.generation != std::numeric_limits<ObjectGeneration>::max())) {
         mFreeHandles.push_back({currentHandle.id, currentHandle.generation + 1});
     }
-    mObjects[currentHandle.id] = nullptr;
+    GetEntry(currentHandle.id) = nullptr;
+
+    obj->~ObjectBase();
+    mAllocator->Deallocate(obj);
 }
 
 ObjectBase* ObjectStore::Get(ObjectId id) const {
-    if (id >= mObjects.size()) {
+    if ((id >> kObjectsPerChunkLog2) >= mObjectChunks.size()) {
         return nullptr;
     }
-    return mObjects[id].get();
+    return mObjectChunks[id >> kObjectsPerChunkLog2][id & (kObjectsPerChunk - 1)];
+}
+
+raw_ptr<ObjectBase>& ObjectStore::GetEntry(ObjectId id) {
+    DAWN_ASSERT((id >> kObjectsPerChunkLog2) < mObjectChunks.size());
+    return mObjectChunks[id >> kObjectsPerChunkLog2][id & (kObjectsPerChunk - 1)];
 }
 
 }  // namespace dawn::wire::client
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "dawn/wire/client/ObjectBase.h"
+#include "partition_alloc/pointers/raw_ptr.h"
 
 namespace dawn::wire::client {
 
@@ -44,19 +45,36 @@ class Client;
 // Since the wire has one "ID" namespace per type of object, each ObjectStore should contain a
 // single type of objects. However no templates are used because Client wraps ObjectStore and is
 // type-generic, so ObjectStore is type-erased to only work on ObjectBase.
+//
+// The memory of the objects comes from a slab allocator owned by the store, created on the first
+// allocation since all objects of the store have the same size. The ID to object table is split in
+// fixed-size chunks so that it never moves or copies existing entries when it grows.
 class ObjectStore {
   public:
     ObjectStore();
+    ~ObjectStore();
 
     ObjectHandle ReserveHandle();
-    void Insert(std::unique_ptr<ObjectBase> obj);
+    // Returns memory for an object of the type of this store. The object must be constructed
+    // in it and then passed to Insert.
+    void* Allocate(size_t size, size_t alignment);
+    void Insert(ObjectBase* obj);
+    // Destroys the object and returns its memory to the allocator.
     void Free(ObjectBase* obj);
     ObjectBase* Get(ObjectId id) const;
 
   private:
+    class ObjectAllocator;
+
+    static constexpr uint32_t kObjectsPerChunkLog2 = 8;
+    static constexpr uint32_t kObjectsPerChunk = 1u << kObjectsPerChunkLog2;
+
+    raw_ptr<ObjectBase>& GetEntry(ObjectId id);
+
     uint32_t mCurrentId;
     std::vector<ObjectHandle> mFreeHandles;
-    std::vector<std::unique_ptr<ObjectBase>> mObjects;
+    std::vector<std::unique_ptr<raw_ptr<ObjectBase>[]>> mObjectChunks;
+    std::unique_ptr<ObjectAllocator> mAllocator;
 };
 
 }  // namespace dawn::wire::client
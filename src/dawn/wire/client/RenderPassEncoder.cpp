@@ -0,0 +1,321 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/wire/client/RenderPassEncoder.h"
+
+#include "dawn/common/Assert.h"
+#include "dawn/wire/client/ApiObjects.h"
+#include "dawn/wire/client/Client.h"
+
+namespace dawn::wire::client {
+namespace {
+
+template <typename T>
+ObjectId GetWireIdOrZero(T object) {
+    if (object == nullptr) {
+        return 0;
+    }
+    return FromAPI(object)->GetWireId();
+}
+
+}  // anonymous namespace
+
+ObjectType RenderPassEncoder::GetObjectType() const {
+    return ObjectType::RenderPassEncoder;
+}
+
+void RenderPassEncoder::SetPipeline(WGPURenderPipeline pipeline) {
+    if (RenderPassCommandBatch* batch = GetClient()->GetRenderPassCommandBatch(GetWireId())) {
+        batch->SetPipeline(GetWireIdOrZero(pipeline));
+        return;
+    }
+
+    RenderPassEncoderSetPipelineCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.pipeline = pipeline;
+    GetClient()->SerializeCommand(cmd);
+}
+
+void RenderPassEncoder::SetBindGroup(uint32_t groupIndex,
+                                     WGPUBindGroup group,
+                                     size_t dynamicOffsetCount,
+                                     const uint32_t* dynamicOffsets) {
+    if (RenderPassCommandBatch* batch = GetClient()->GetRenderPassCommandBatch(GetWireId())) {
+        batch->SetBindGroup(groupIndex, GetWireIdOrZero(group), dynamicOffsetCount,
+                            dynamicOffsets);
+        return;
+    }
+
+    RenderPassEncoderSetBindGroupCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.groupIndex = groupIndex;
+    cmd.group = group;
+    cmd.dynamicOffsetCount = dynamicOffsetCount;
+    cmd.dynamicOffsets = dynamicOffsets;
+    GetClient()->SerializeCommand(cmd);
+}
+
+void RenderPassEncoder::SetVertexBuffer(uint32_t slot,
+                                        WGPUBuffer buffer,
+                                        uint64_t offset,
+                                        uint64_t size) {
+    if (RenderPassCommandBatch* batch = GetClient()->GetRenderPassCommandBatch(GetWireId())) {
+        batch->SetVertexBuffer(slot, GetWireIdOrZero(buffer), offset, size);
+        return;
+    }
+
+    RenderPassEncoderSetVertexBufferCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.slot = slot;
+    cmd.buffer = buffer;
+    cmd.offset = offset;
+    cmd.size = size;
+    GetClient()->SerializeCommand(cmd);
+}
+
+void RenderPassEncoder::SetIndexBuffer(WGPUBuffer buffer,
+                                       WGPUIndexFormat format,
+                                       uint64_t offset,
+                                       uint64_t size) {
+    if (RenderPassCommandBatch* batch = GetClient()->GetRenderPassCommandBatch(GetWireId())) {
+        batch->SetIndexBuffer(GetWireIdOrZero(buffer), format, offset, size);
+        return;
+    }
+
+    RenderPassEncoderSetIndexBufferCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.buffer = buffer;
+    cmd.format = format;
+    cmd.offset = offset;
+    cmd.size = size;
+    GetClient()->SerializeCommand(cmd);
+}
+
+void RenderPassEncoder::Draw(uint32_t vertexCount,
+                             uint32_t instanceCount,
+                             uint32_t firstVertex,
+                             uint32_t firstInstance) {
+    if (RenderPassCommandBatch* batch = GetClient()->GetRenderPassCommandBatch(GetWireId())) {
+        batch->Draw(vertexCount, instanceCount, firstVertex, firstInstance);
+        return;
+    }
+
+    RenderPassEncoderDrawCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.vertexCount = vertexCount;
+    cmd.instanceCount = instanceCount;
+    cmd.firstVertex = firstVertex;
+    cmd.firstInstance = firstInstance;
+    GetClient()->SerializeCommand(cmd);
+}
+
+void RenderPassEncoder::DrawIndexed(uint32_t indexCount,
+                                    uint32_t instanceCount,
+                                    uint32_t firstIndex,
+                                    int32_t baseVertex,
+                                    uint32_t firstInstance) {
+    if (RenderPassCommandBatch* batch = GetClient()->GetRenderPassCommandBatch(GetWireId())) {
+        batch->DrawIndexed(indexCount, instanceCount, firstIndex, baseVertex, firstInstance);
+        return;
+    }
+
+    RenderPassEncoderDrawIndexedCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.indexCount = indexCount;
+    cmd.instanceCount = instanceCount;
+    cmd.firstIndex = firstIndex;
+    cmd.baseVertex = baseVertex;
+    cmd.firstInstance = firstInstance;
+    GetClient()->SerializeCommand(cmd);
+}
+
+bool RenderPassCommandBatch::BufferBinding::operator==(const BufferBinding& other) const {
+    return buffer == other.buffer && offset == other.offset && size == other.size &&
+           format == other.format;
+}
+
+RenderPassCommandBatch::RenderPassCommandBatch() {
+    mData.reserve(kMaxBatchSize);
+}
+
+bool RenderPassCommandBatch::IsEmpty() const {
+    return mData.empty();
+}
+
+bool RenderPassCommandBatch::IsFull() const {
+    return mData.size() >= kMaxBatchSize;
+}
+
+ObjectId RenderPassCommandBatch::GetEncoderId() const {
+    return mEncoderId;
+}
+
+void RenderPassCommandBatch::SetEncoderId(ObjectId encoderId) {
+    DAWN_ASSERT(IsEmpty());
+    mEncoderId = encoderId;
+}
+
+void RenderPassCommandBatch::SetPipeline(ObjectId pipeline) {
+    if (mPipeline == pipeline) {
+        return;
+    }
+    mPipeline = pipeline;
+
+    AppendCommand(BatchedPassCommand::SetPipeline);
+    AppendVarint(&mData, pipeline);
+}
+
+void RenderPassCommandBatch::SetBindGroup(uint32_t groupIndex,
+                                          ObjectId group,
+                                          size_t dynamicOffsetCount,
+                                          const uint32_t* dynamicOffsets) {
+    if (groupIndex < kMaxBindGroups) {
+        // The dynamic offsets aren't tracked so bind groups that use them are never skipped.
+        std::optional<ObjectId>& current = mBindGroups[groupIndex];
+        if (dynamicOffsetCount != 0) {
+            current.reset();
+        } else if (current == group) {
+            return;
+        } else {
+            current = group;
+        }
+    }
+
+    AppendCommand(BatchedPassCommand::SetBindGroup);
+    AppendVarint(&mData, groupIndex);
+    AppendVarint(&mData, group);
+    AppendVarint(&mData, dynamicOffsetCount);
+    for (size_t i = 0; i < dynamicOffsetCount; ++i) {
+        AppendVarint(&mData, dynamicOffsets[i]);
+    }
+}
+
+void RenderPassCommandBatch::SetVertexBuffer(uint32_t slot,
+                                             ObjectId buffer,
+                                             uint64_t offset,
+                                             uint64_t size) {
+    if (slot < kMaxVertexBuffers) {
+        BufferBinding binding = {buffer, offset, size, WGPUIndexFormat_Undefined};
+        if (mVertexBuffers[slot] == binding) {
+            return;
+        }
+        mVertexBuffers[slot] = binding;
+    }
+
+    AppendCommand(BatchedPassCommand::SetVertexBuffer);
+    AppendVarint(&mData, slot);
+    AppendVarint(&mData, buffer);
+    AppendVarint(&mData, offset);
+    AppendVarint(&mData, size + 1);
+}
+
+void RenderPassCommandBatch::SetIndexBuffer(ObjectId buffer,
+                                            WGPUIndexFormat format,
+                                            uint64_t offset,
+                                            uint64_t size) {
+    BufferBinding binding = {buffer, offset, size, format};
+    if (mIndexBuffer == binding) {
+        return;
+    }
+    mIndexBuffer = binding;
+
+    AppendCommand(BatchedPassCommand::SetIndexBuffer);
+    AppendVarint(&mData, buffer);
+    AppendVarint(&mData, format);
+    AppendVarint(&mData, offset);
+    AppendVarint(&mData, size + 1);
+}
+
+void RenderPassCommandBatch::Draw(uint32_t vertexCount,
+                                  uint32_t instanceCount,
+                                  uint32_t firstVertex,
+                                  uint32_t firstInstance) {
+    BatchedDrawArguments arguments = mDrawArguments;
+    arguments[BatchedDrawArgument::Count] = vertexCount;
+    arguments[BatchedDrawArgument::InstanceCount] = instanceCount;
+    arguments[BatchedDrawArgument::First] = firstVertex;
+    arguments[BatchedDrawArgument::FirstInstance] = firstInstance;
+    AppendDraw(BatchedPassCommand::Draw, kBatchedDrawArgumentsMask, arguments);
+}
+
+void RenderPassCommandBatch::DrawIndexed(uint32_t indexCount,
+                                         uint32_t instanceCount,
+                                         uint32_t firstIndex,
+                                         int32_t baseVertex,
+                                         uint32_t firstInstance) {
+    BatchedDrawArguments arguments;
+    arguments[BatchedDrawArgument::Count] = indexCount;
+    arguments[BatchedDrawArgument::InstanceCount] = instanceCount;
+    arguments[BatchedDrawArgument::First] = firstIndex;
+    arguments[BatchedDrawArgument::BaseVertex] = ZigZagEncode(baseVertex);
+    arguments[BatchedDrawArgument::FirstInstance] = firstInstance;
+    AppendDraw(BatchedPassCommand::DrawIndexed, kBatchedDrawIndexedArgumentsMask, arguments);
+}
+
+void RenderPassCommandBatch::AppendCommand(BatchedPassCommand command, uint8_t argumentsMask) {
+    mData.push_back(static_cast<uint8_t>(command) |
+                    static_cast<uint8_t>(argumentsMask << kBatchedDrawArgumentMaskShift));
+}
+
+void RenderPassCommandBatch::AppendDraw(BatchedPassCommand command,
+                                        uint8_t usedArgumentsMask,
+                                        const BatchedDrawArguments& arguments) {
+    uint8_t changedArgumentsMask = 0;
+    for (size_t i = 0; i < kBatchedDrawArgumentCount; ++i) {
+        if ((usedArgumentsMask & (1u << i)) != 0 && arguments[i] != mDrawArguments[i]) {
+            changedArgumentsMask |= 1u << i;
+        }
+    }
+
+    AppendCommand(command, changedArgumentsMask);
+    for (size_t i = 0; i < kBatchedDrawArgumentCount; ++i) {
+        if ((changedArgumentsMask & (1u << i)) != 0) {
+            AppendVarint(&mData, arguments[i]);
+        }
+    }
+    mDrawArguments = arguments;
+}
+
+RenderPassEncoderCommandBatchCmd RenderPassCommandBatch::GetCommand() const {
+    RenderPassEncoderCommandBatchCmd cmd;
+    cmd.renderPassEncoderId = mEncoderId;
+    cmd.data = mData.data();
+    cmd.dataSize = mData.size();
+    return cmd;
+}
+
+void RenderPassCommandBatch::Reset() {
+    mData.clear();
+    mEncoderId = 0;
+    mPipeline.reset();
+    mBindGroups.fill(std::nullopt);
+    mVertexBuffers.fill(std::nullopt);
+    mIndexBuffer.reset();
+    mDrawArguments = kInitialBatchedDrawArguments;
+}
+
+}  // namespace dawn::wire::client
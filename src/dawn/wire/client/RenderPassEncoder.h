@@ -0,0 +1,140 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_WIRE_CLIENT_RENDERPASSENCODER_H_
+#define SRC_DAWN_WIRE_CLIENT_RENDERPASSENCODER_H_
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "dawn/common/Constants.h"
+#include "dawn/common/NonCopyable.h"
+#include "dawn/webgpu.h"
+#include "dawn/wire/ObjectHandle.h"
+#include "dawn/wire/PassCommandBatch.h"
+#include "dawn/wire/WireCmd_autogen.h"
+#include "dawn/wire/client/ObjectBase.h"
+
+namespace dawn::wire::client {
+
+class RenderPassEncoder final : public ObjectBase {
+  public:
+    using ObjectBase::ObjectBase;
+
+    ObjectType GetObjectType() const override;
+
+    // These commands are recorded in the client's RenderPassCommandBatch when pass command
+    // batching is enabled, and serialized as individual commands otherwise.
+    void SetPipeline(WGPURenderPipeline pipeline);
+    void SetBindGroup(uint32_t groupIndex,
+                      WGPUBindGroup group,
+                      size_t dynamicOffsetCount,
+                      const uint32_t* dynamicOffsets);
+    void SetVertexBuffer(uint32_t slot, WGPUBuffer buffer, uint64_t offset, uint64_t size);
+    void SetIndexBuffer(WGPUBuffer buffer, WGPUIndexFormat format, uint64_t offset, uint64_t size);
+    void Draw(uint32_t vertexCount,
+              uint32_t instanceCount,
+              uint32_t firstVertex,
+              uint32_t firstInstance);
+    void DrawIndexed(uint32_t indexCount,
+                     uint32_t instanceCount,
+                     uint32_t firstIndex,
+                     int32_t baseVertex,
+                     uint32_t firstInstance);
+};
+
+// Packs consecutive commands recorded on the same render pass encoder into the data of a single
+// RenderPassEncoderCommandBatchCmd (see PassCommandBatch.h). Commands setting state that the batch
+// already set to the same value are skipped. The batch is flushed by the client before any other
+// command is serialized so that the order of the commands is preserved on the server.
+class RenderPassCommandBatch : NonCopyable {
+  public:
+    // Batches are flushed once they reach this size, even if more commands could be added.
+    static constexpr size_t kMaxBatchSize = 64 * 1024;
+
+    RenderPassCommandBatch();
+
+    bool IsEmpty() const;
+    bool IsFull() const;
+
+    ObjectId GetEncoderId() const;
+    // Starts recording the commands of another encoder. The batch must be empty.
+    void SetEncoderId(ObjectId encoderId);
+
+    void SetPipeline(ObjectId pipeline);
+    void SetBindGroup(uint32_t groupIndex,
+                      ObjectId group,
+                      size_t dynamicOffsetCount,
+                      const uint32_t* dynamicOffsets);
+    void SetVertexBuffer(uint32_t slot, ObjectId buffer, uint64_t offset, uint64_t size);
+    void SetIndexBuffer(ObjectId buffer, WGPUIndexFormat format, uint64_t offset, uint64_t size);
+    void Draw(uint32_t vertexCount,
+              uint32_t instanceCount,
+              uint32_t firstVertex,
+              uint32_t firstInstance);
+    void DrawIndexed(uint32_t indexCount,
+                     uint32_t instanceCount,
+                     uint32_t firstIndex,
+                     int32_t baseVertex,
+                     uint32_t firstInstance);
+
+    // The returned command points to the data of the batch and is only valid until the next
+    // command is added.
+    RenderPassEncoderCommandBatchCmd GetCommand() const;
+    // Empties the batch and forgets the state set by its commands.
+    void Reset();
+
+  private:
+    void AppendCommand(BatchedPassCommand command, uint8_t argumentsMask = 0);
+    void AppendDraw(BatchedPassCommand command,
+                    uint8_t usedArgumentsMask,
+                    const BatchedDrawArguments& arguments);
+
+    struct BufferBinding {
+        ObjectId buffer;
+        uint64_t offset;
+        uint64_t size;
+        WGPUIndexFormat format;
+
+        bool operator==(const BufferBinding& other) const;
+    };
+
+    std::vector<uint8_t> mData;
+    ObjectId mEncoderId = 0;
+
+    // The state set by the commands in the batch, unset when it is unknown.
+    std::optional<ObjectId> mPipeline;
+    std::array<std::optional<ObjectId>, kMaxBindGroups> mBindGroups;
+    std::array<std::optional<BufferBinding>, kMaxVertexBuffers> mVertexBuffers;
+    std::optional<BufferBinding> mIndexBuffer;
+    BatchedDrawArguments mDrawArguments = kInitialBatchedDrawArguments;
+};
+
+}  // namespace dawn::wire::client
+
+#endif  // SRC_DAWN_WIRE_CLIENT_RENDERPASSENCODER_H_
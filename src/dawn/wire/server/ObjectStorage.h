@@ -135,6 +135,11 @@ struct Known {
 };
 
 // Keeps track of the mapping between client IDs and backend objects.
+//
+// The client allocates IDs densely and reuses the IDs of freed objects, so the data is stored in
+// slots indexed by ID. Slots are grouped in fixed-size chunks that are never moved, which keeps the
+// Data* returned by Get and Allocate valid when more objects are allocated, and makes growing the
+// storage cost a single chunk allocation instead of moving every existing ObjectData.
 template <typename T>
 class KnownObjectsBase {
   public:
@@ -144,20 +149,19 @@ class KnownObjectsBase {
         // Reserve ID 0 so that it can be used to represent nullptr for optional object values
         // in the wire format. However don't tag it as allocated so that it is an error to ask
         // KnownObjects for ID 0.
-        Data reservation;
-        reservation.handle = nullptr;
-        reservation.state = AllocationState::Free;
-        mKnown.push_back(std::move(reservation));
+        Data* reservation = AppendSlot();
+        reservation->handle = nullptr;
+        reservation->state = AllocationState::Free;
     }
 
     // Get a backend objects for a given client ID.
     // Returns an error if the object wasn't previously allocated.
     WireResult GetNativeHandle(ObjectId id, T* handle) const {
-        if (id >= mKnown.size()) {
+        if (id >= mSlotCount) {
             return WireResult::FatalError;
         }
 
-        const Data* data = &mKnown[id];
+        const Data* data = GetSlot(id);
         if (data->state != AllocationState::Allocated) {
             return WireResult::FatalError;
         }
@@ -167,11 +171,11 @@ class KnownObjectsBase {
     }
 
     WireResult Get(ObjectId id, Reserved<T>* result) {
-        if (id >= mKnown.size()) {
+        if (id >= mSlotCount) {
             return WireResult::FatalError;
         }
 
-        Data* data = &mKnown[id];
+        Data* data = GetSlot(id);
         if (data->state == AllocationState::Free) {
             return WireResult::FatalError;
         }
@@ -181,11 +185,11 @@ class KnownObjectsBase {
     }
 
     WireResult Get(ObjectId id, Known<T>* result) {
-        if (id >= mKnown.size()) {
+        if (id >= mSlotCount) {
             return WireResult::FatalError;
         }
 
-        Data* data = &mKnown[id];
+        Data* data = GetSlot(id);
         if (data->state != AllocationState::Allocated) {
             return WireResult::FatalError;
         }
@@ -195,9 +199,9 @@ class KnownObjectsBase {
     }
 
     WireResult FillReservation(ObjectId id, T handle, Known<T>* known = nullptr) {
-        DAWN_ASSERT(id < mKnown.size());
+        DAWN_ASSERT(id < mSlotCount);
         DAWN_ASSERT(handle != nullptr);
-        Data* data = &mKnown[id];
+        Data* data = GetSlot(id);
 
         if (data->state != AllocationState::Reserved) {
             return WireResult::FatalError;
@@ -212,54 +216,57 @@ class KnownObjectsBase {
 
     // Allocates the data for a given ID and returns it in result.
     // Returns false if the ID is already allocated, or too far ahead, or if ID is 0 (ID 0 is
-    // reserved for nullptr). Invalidates all the Data*
+    // reserved for nullptr).
     WireResult Allocate(Reserved<T>* result,
                         ObjectHandle handle,
                         AllocationState state = AllocationState::Allocated) {
-        if (handle.id == 0 || handle.id > mKnown.size()) {
+        if (handle.id == 0 || handle.id > mSlotCount) {
             return WireResult::FatalError;
         }
 
-        Data data;
-        data.state = state;
-        data.handle = nullptr;
-
-        if (handle.id >= mKnown.size()) {
-            mKnown.push_back(std::move(data));
-            *result = {handle.id, &mKnown.back()};
+        if (handle.id == mSlotCount) {
+            Data* data = AppendSlot();
+            data->state = state;
+            data->handle = nullptr;
+            *result = {handle.id, data};
             return WireResult::Success;
         }
 
-        if (mKnown[handle.id].state != AllocationState::Free) {
+        Data* data = GetSlot(handle.id);
+        if (data->state != AllocationState::Free) {
             return WireResult::FatalError;
         }
 
         // The generation should be strictly increasing.
-        if (handle.generation <= mKnown[handle.id].generation) {
+        if (handle.generation <= data->generation) {
             return WireResult::FatalError;
         }
-        // update the generation in the slot
-        data.generation = handle.generation;
 
-        mKnown[handle.id] = std::move(data);
+        // Reset the slot to release the per-object data of the previous generation.
+        *data = Data();
+        data->state = state;
+        data->handle = nullptr;
+        // update the generation in the slot
+        data->generation = handle.generation;
 
-        *result = {handle.id, &mKnown[handle.id]};
+        *result = {handle.id, data};
         return WireResult::Success;
     }
 
     // Marks an ID as deallocated
     void Free(ObjectId id) {
-        DAWN_ASSERT(id < mKnown.size());
-        mKnown[id].state = AllocationState::Free;
+        DAWN_ASSERT(id < mSlotCount);
+        GetSlot(id)->state = AllocationState::Free;
     }
 
     std::vector<T> AcquireAllHandles() {
         std::vector<T> objects;
-        for (Data& data : mKnown) {
-            if (data.state == AllocationState::Allocated && data.handle != nullptr) {
-                objects.push_back(data.handle);
-                data.state = AllocationState::Free;
-                data.handle = nullptr;
+        for (ObjectId id = 0; id < mSlotCount; ++id) {
+            Data* data = GetSlot(id);
+            if (data->state == AllocationState::Allocated && data->handle != nullptr) {
+                objects.push_back(data->handle);
+                data->state = AllocationState::Free;
+                data->handle = nullptr;
             }
         }
 
@@ -268,9 +275,10 @@ class KnownObjectsBase {
 
     std::vector<T> GetAllHandles() const {
         std::vector<T> objects;
-        for (const Data& data : mKnown) {
-            if (data.state == AllocationState::Allocated && data.handle != nullptr) {
-                objects.push_back(data.handle);
+        for (ObjectId id = 0; id < mSlotCount; ++id) {
+            const Data* data = GetSlot(id);
+            if (data->state == AllocationState::Allocated && data->handle != nullptr) {
+                objects.push_back(data->handle);
             }
         }
 
@@ -278,7 +286,29 @@ class KnownObjectsBase {
     }
 
   protected:
-    std::vector<Data> mKnown;
+    static constexpr uint32_t kSlotsPerChunkLog2 = 8;
+    static constexpr uint32_t kSlotsPerChunk = 1u << kSlotsPerChunkLog2;
+
+    Data* GetSlot(ObjectId id) {
+        DAWN_ASSERT(id < mSlotCount);
+        return &mChunks[id >> kSlotsPerChunkLog2][id & (kSlotsPerChunk - 1)];
+    }
+    const Data* GetSlot(ObjectId id) const {
+        DAWN_ASSERT(id < mSlotCount);
+        return &mChunks[id >> kSlotsPerChunkLog2][id & (kSlotsPerChunk - 1)];
+    }
+
+  private:
+    Data* AppendSlot() {
+        if ((mSlotCount & (kSlotsPerChunk - 1)) == 0) {
+            mChunks.push_back(std::make_unique<Data[]>(kSlotsPerChunk));
+        }
+        ObjectId id = mSlotCount++;
+        return GetSlot(id);
+    }
+
+    std::vector<std::unique_ptr<Data[]>> mChunks;
+    ObjectId mSlotCount = 0;
 };
 
 template <typename T>
@@ -308,7 +338,7 @@ class KnownObjects<WGPUDevice> : public KnownObjectsBase<WGPUDevice> {
     }
 
     void Free(ObjectId id) {
-        mKnownSet.erase(mKnown[id].handle);
+        mKnownSet.erase(GetSlot(id)->handle);
         KnownObjectsBase<WGPUDevice>::Free(id);
     }
 
@@ -0,0 +1,178 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <limits>
+#include <vector>
+
+#include "dawn/wire/PassCommandBatch.h"
+#include "dawn/wire/server/Server.h"
+
+namespace dawn::wire::server {
+namespace {
+
+// Reads the ID of an object and gets its backend handle. ID 0 is only allowed for nullable objects.
+template <typename T>
+WireResult ReadObject(PassCommandBatchReader* reader,
+                      const KnownObjects<T>& objects,
+                      bool nullable,
+                      T* handle) {
+    ObjectId id;
+    WIRE_TRY(reader->ReadVarint(&id));
+    if (id == 0 && nullable) {
+        *handle = nullptr;
+        return WireResult::Success;
+    }
+    return objects.GetNativeHandle(id, handle);
+}
+
+WireResult ReadBufferSize(PassCommandBatchReader* reader, uint64_t* size) {
+    uint64_t sizePlusOne;
+    WIRE_TRY(reader->ReadVarint(&sizePlusOne));
+    *size = sizePlusOne - 1;
+    return WireResult::Success;
+}
+
+}  // anonymous namespace
+
+WireResult Server::DoRenderPassEncoderCommandBatch(Known<WGPURenderPassEncoder> encoder,
+                                                   const uint8_t* data,
+                                                   uint64_t dataSize) {
+    if (dataSize > std::numeric_limits<size_t>::max()) {
+        return WireResult::FatalError;
+    }
+
+    PassCommandBatchReader reader(data, static_cast<size_t>(dataSize));
+    BatchedDrawArguments drawArguments = kInitialBatchedDrawArguments;
+    std::vector<uint32_t> dynamicOffsets;
+
+    while (!reader.IsEmpty()) {
+        uint8_t header;
+        WIRE_TRY(reader.ReadByte(&header));
+        auto command = static_cast<BatchedPassCommand>(header & kBatchedPassCommandMask);
+        uint8_t argumentsMask = header >> kBatchedDrawArgumentMaskShift;
+        // Only draws use the high bits of the header.
+        if (argumentsMask != 0 && command != BatchedPassCommand::Draw &&
+            command != BatchedPassCommand::DrawIndexed) {
+            return WireResult::FatalError;
+        }
+
+        switch (command) {
+            case BatchedPassCommand::SetPipeline: {
+                WGPURenderPipeline pipeline;
+                WIRE_TRY(ReadObject(&reader, Objects<WGPURenderPipeline>(), false, &pipeline));
+                mProcs.renderPassEncoderSetPipeline(encoder->handle, pipeline);
+                break;
+            }
+
+            case BatchedPassCommand::SetBindGroup: {
+                uint32_t groupIndex;
+                WGPUBindGroup group;
+                uint64_t dynamicOffsetCount;
+                WIRE_TRY(reader.ReadVarint(&groupIndex));
+                WIRE_TRY(ReadObject(&reader, Objects<WGPUBindGroup>(), true, &group));
+                WIRE_TRY(reader.ReadVarint(&dynamicOffsetCount));
+                // Each offset takes at least one byte, which bounds the allocation below.
+                if (dynamicOffsetCount > reader.GetRemainingSize()) {
+                    return WireResult::FatalError;
+                }
+                dynamicOffsets.resize(static_cast<size_t>(dynamicOffsetCount));
+                for (uint32_t& offset : dynamicOffsets) {
+                    WIRE_TRY(reader.ReadVarint(&offset));
+                }
+                mProcs.renderPassEncoderSetBindGroup(encoder->handle, groupIndex, group,
+                                                     dynamicOffsets.size(), dynamicOffsets.data());
+                break;
+            }
+
+            case BatchedPassCommand::SetVertexBuffer: {
+                uint32_t slot;
+                WGPUBuffer buffer;
+                uint64_t offset;
+                uint64_t size;
+                WIRE_TRY(reader.ReadVarint(&slot));
+                WIRE_TRY(ReadObject(&reader, Objects<WGPUBuffer>(), true, &buffer));
+                WIRE_TRY(reader.ReadVarint(&offset));
+                WIRE_TRY(ReadBufferSize(&reader, &size));
+                mProcs.renderPassEncoderSetVertexBuffer(encoder->handle, slot, buffer, offset,
+                                                        size);
+                break;
+            }
+
+            case BatchedPassCommand::SetIndexBuffer: {
+                WGPUBuffer buffer;
+                uint32_t format;
+                uint64_t offset;
+                uint64_t size;
+                WIRE_TRY(ReadObject(&reader, Objects<WGPUBuffer>(), false, &buffer));
+                WIRE_TRY(reader.ReadVarint(&format));
+                WIRE_TRY(reader.ReadVarint(&offset));
+                WIRE_TRY(ReadBufferSize(&reader, &size));
+                mProcs.renderPassEncoderSetIndexBuffer(
+                    encoder->handle, buffer, static_cast<WGPUIndexFormat>(format), offset, size);
+                break;
+            }
+
+            case BatchedPassCommand::Draw:
+            case BatchedPassCommand::DrawIndexed: {
+                uint8_t usedArgumentsMask = command == BatchedPassCommand::Draw
+                                                ? kBatchedDrawArgumentsMask
+                                                : kBatchedDrawIndexedArgumentsMask;
+                if ((argumentsMask & ~usedArgumentsMask) != 0) {
+                    return WireResult::FatalError;
+                }
+                for (size_t i = 0; i < kBatchedDrawArgumentCount; ++i) {
+                    if ((argumentsMask & (1u << i)) != 0) {
+                        WIRE_TRY(reader.ReadVarint(&drawArguments[i]));
+                    }
+                }
+
+                if (command == BatchedPassCommand::Draw) {
+                    mProcs.renderPassEncoderDraw(encoder->handle,
+                                                 drawArguments[BatchedDrawArgument::Count],
+                                                 drawArguments[BatchedDrawArgument::InstanceCount],
+                                                 drawArguments[BatchedDrawArgument::First],
+                                                 drawArguments[BatchedDrawArgument::FirstInstance]);
+                } else {
+                    mProcs.renderPassEncoderDrawIndexed(
+                        encoder->handle, drawArguments[BatchedDrawArgument::Count],
+                        drawArguments[BatchedDrawArgument::InstanceCount],
+                        drawArguments[BatchedDrawArgument::First],
+                        ZigZagDecode(drawArguments[BatchedDrawArgument::BaseVertex]),
+                        drawArguments[BatchedDrawArgument::FirstInstance]);
+                }
+                break;
+            }
+
+            default:
+                return WireResult::FatalError;
+        }
+    }
+
+    return WireResult::Success;
+}
+
+}  // namespace dawn::wire::server
@@ -50,6 +50,7 @@ tint_target_add_dependencies(tint_api lib
   tint_lang_core
   tint_lang_core_constant
   tint_lang_core_ir
+  tint_lang_core_ir_binary_flat
   tint_lang_core_type
   tint_lang_hlsl_writer_common
   tint_lang_wgsl
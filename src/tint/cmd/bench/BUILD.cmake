@@ -48,8 +48,12 @@ tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
   tint_lang_core_constant
   tint_lang_core_type
   tint_lang_core_bench
+  tint_lang_core_intrinsic_bench
+  tint_lang_core_ir_binary_flat_bench
+  tint_lang_core_ir_transform_bench
   tint_lang_wgsl
   tint_lang_wgsl_ast
+  tint_lang_wgsl_ast_transform_bench
   tint_lang_wgsl_program
   tint_lang_wgsl_sem
   tint_lang_wgsl_bench
@@ -100,6 +104,7 @@ endif(TINT_BUILD_SPV_WRITER)
 if(TINT_BUILD_WGSL_READER)
   tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
     tint_lang_wgsl_reader_bench
+    tint_lang_wgsl_resolver_bench
   )
 endif(TINT_BUILD_WGSL_READER)
 
@@ -134,6 +139,7 @@ tint_target_add_dependencies(tint_cmd_bench_bench bench
   tint_lang_wgsl_sem
   tint_lang_wgsl_writer_ir_to_program
   tint_utils_containers
+  tint_utils_debug
   tint_utils_diagnostic
   tint_utils_ice
   tint_utils_id
@@ -25,6 +25,7 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <chrono>
 #include <filesystem>
 #include <iostream>
 #include <utility>
@@ -175,4 +176,12 @@ Result<ProgramAndFile> LoadProgram(std::string name) {
     return ProgramAndFile{std::move(program), std::move(file)};
 }
 
+void ReportPassTimings(benchmark::State& state, const PassTimings& timings) {
+    for (auto& entry : timings.Entries()) {
+        std::chrono::duration<double, std::micro> us = entry.duration;
+        state.counters[std::string(entry.name) + "_us"] =
+            benchmark::Counter(us.count(), benchmark::Counter::kAvgIterations);
+    }
+}
+
 }  // namespace tint::bench
@@ -34,6 +34,7 @@
 
 #include "benchmark/benchmark.h"
 #include "src/tint/lang/wgsl/program/program.h"
+#include "src/tint/utils/debug/phase_timer.h"
 #include "src/tint/utils/macros/compiler.h"
 #include "src/tint/utils/macros/concat.h"
 #include "src/tint/utils/result/result.h"
@@ -66,6 +67,12 @@ Result<Source::File> LoadInputFile(std::string name);
 /// @returns the loaded Program
 Result<ProgramAndFile> LoadProgram(std::string name);
 
+/// Adds a counter to @p state for each pass in @p timings, holding the average time in microseconds
+/// spent in the pass per iteration.
+/// @param state the benchmark state
+/// @param timings the pass timings accumulated over all the iterations
+void ReportPassTimings(benchmark::State& state, const PassTimings& timings);
+
 // If TINT_BENCHMARK_EXTERNAL_SHADERS_HEADER is defined, include that to
 // declare the TINT_BENCHMARK_EXTERNAL_WGSL_PROGRAMS() and TINT_BENCHMARK_EXTERNAL_SPV_PROGRAMS()
 // macros, which appends external programs to the TINT_BENCHMARK_WGSL_PROGRAMS() and
@@ -192,6 +192,7 @@ ProgramInfo LoadProgramInfo(const LoadProgramOptions& opts) {
                 tint::wgsl::reader::Options options;
                 options.allowed_features = tint::wgsl::AllowedFeatures::Everything();
                 options.mode = opts.mode;
+                options.max_resolver_threads = opts.max_resolver_threads;
 
                 auto file = std::make_unique<tint::Source::File>(
                     opts.filename, std::string(data.begin(), data.end()));
@@ -80,6 +80,8 @@ struct LoadProgramOptions {
     std::string filename;
     /// The WGSL validation mode to use.
     tint::wgsl::ValidationMode mode = tint::wgsl::ValidationMode::kFull;
+    /// The maximum number of threads used to analyze independent WGSL functions.
+    uint32_t max_resolver_threads = 1;
 #if TINT_BUILD_SPV_READER
     /// Spirv-reader options
     bool use_ir = false;
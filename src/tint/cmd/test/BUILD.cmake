@@ -47,6 +47,7 @@ tint_target_add_dependencies(tint_cmd_test_test_cmd test_cmd
   tint_api_common_test
   tint_lang_core_constant_test
   tint_lang_core_intrinsic_test
+  tint_lang_core_ir_binary_flat_test
   tint_lang_core_ir_transform_common_test
   tint_lang_core_ir_transform_test
   tint_lang_core_ir_test
@@ -75,6 +76,7 @@ tint_target_add_dependencies(tint_cmd_test_test_cmd test_cmd
   tint_utils_cli_test
   tint_utils_command_test
   tint_utils_containers_test
+  tint_utils_debug_test
   tint_utils_diagnostic_test
   tint_utils_file_test
   tint_utils_ice_test
@@ -65,6 +65,7 @@ tint_target_add_dependencies(tint_cmd_tint_cmd cmd
   tint_utils_cli
   tint_utils_command
   tint_utils_containers
+  tint_utils_debug
   tint_utils_diagnostic
   tint_utils_ice
   tint_utils_id
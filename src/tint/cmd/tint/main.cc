@@ -27,6 +27,7 @@
 
 #include <charconv>
 #include <cstdio>
+#include <iomanip>
 #include <iostream>
 #include <memory>
 #include <optional>
@@ -55,6 +56,7 @@
 #include "src/tint/utils/cli/cli.h"
 #include "src/tint/utils/command/command.h"
 #include "src/tint/utils/containers/transform.h"
+#include "src/tint/utils/debug/phase_timer.h"
 #include "src/tint/utils/diagnostic/formatter.h"
 #include "src/tint/utils/macros/defer.h"
 #include "src/tint/utils/system/env.h"
@@ -189,6 +191,9 @@ struct Options {
     bool validate = false;
     bool compatibility_mode = false;
     bool print_hash = false;
+    bool time_phases = false;
+    bool time_transforms = false;
+    uint32_t max_resolver_threads = 1;
     bool dump_inspector_bindings = false;
     bool enable_robustness = false;
     bool emit_single_entry_point = false;
@@ -230,6 +235,55 @@ struct Options {
 #endif  // TINT_BULD_MSL_WRITER
 };
 
+/// Prints the time spent in each compile phase to stderr
+/// @param timings the phase timings
+void PrintPhaseTimings(const tint::PhaseTimings& timings) {
+    if (!tint::PhaseTimings::kEnabled) {
+        std::cerr << "--time-phases: tint was built without TINT_ENABLE_PHASE_TIMING\n";
+        return;
+    }
+    auto print = [](std::string_view name, tint::PhaseTimings::Clock::duration duration) {
+        std::chrono::duration<double, std::milli> ms = duration;
+        std::cerr << "  " << std::left << std::setw(18) << name << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(10) << ms.count() << " ms\n";
+    };
+    std::cerr << "Phase timings:\n";
+    for (size_t i = 0; i < tint::kNumCompilePhases; i++) {
+        auto phase = static_cast<tint::CompilePhase>(i);
+        print(tint::ToString(phase), timings.Get(phase));
+    }
+    print("total", timings.Total());
+}
+
+/// Prints the time spent in each IR transform to stderr, most expensive first
+/// @param timings the pass timings
+void PrintPassTimings(const tint::PassTimings& timings) {
+    if (!tint::PassTimings::kEnabled) {
+        std::cerr << "--time-transforms: tint was built without TINT_ENABLE_PHASE_TIMING\n";
+        return;
+    }
+    auto total = timings.Total();
+    auto print = [&](std::string_view name, tint::PassTimings::Clock::duration duration,
+                     uint32_t count) {
+        std::chrono::duration<double, std::milli> ms = duration;
+        double percent = total.count() > 0 ? 100.0 * static_cast<double>(duration.count()) /
+                                                 static_cast<double>(total.count())
+                                           : 0.0;
+        std::cerr << "  " << std::left << std::setw(56) << name << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(10) << ms.count() << " ms"
+                  << std::setprecision(1) << std::setw(7) << percent << "%";
+        if (count > 1) {
+            std::cerr << "  (x" << count << ")";
+        }
+        std::cerr << "\n";
+    };
+    std::cerr << "Transform timings:\n";
+    for (auto& entry : timings.Ranked()) {
+        print(entry.name, entry.duration, entry.count);
+    }
+    print("total", total, 1);
+}
+
 /// @param filename the filename to inspect
 /// @returns the inferred format for the filename suffix
 Format InferFormat(const std::string& filename) {
@@ -416,6 +470,26 @@ violations that may be produced)",
                                                Default{false});
     TINT_DEFER(opts->print_hash = *print_hash.value);
 
+    auto& time_phases = options.Add<BoolOption>(
+        "time-phases",
+        "Prints the time spent in each phase of the WGSL front end to stderr.\n"
+        "Requires tint to be built with TINT_ENABLE_PHASE_TIMING",
+        Default{false});
+    TINT_DEFER(opts->time_phases = *time_phases.value);
+
+    auto& time_transforms = options.Add<BoolOption>(
+        "time-transforms",
+        "Prints the time spent in each IR transform of the backend to stderr, most expensive\n"
+        "first. Requires tint to be built with TINT_ENABLE_PHASE_TIMING",
+        Default{false});
+    TINT_DEFER(opts->time_transforms = *time_transforms.value);
+
+    auto& resolver_threads = options.Add<ValueOption<uint32_t>>(
+        "resolver-threads",
+        "The maximum number of threads used to analyze independent functions of a WGSL shader",
+        Default{1});
+    TINT_DEFER(opts->max_resolver_threads = *resolver_threads.value);
+
     auto& transforms =
         options.Add<StringOption>("transform", R"(Runs transforms, name list is comma separated
 Available transforms:
@@ -1295,13 +1369,22 @@ int main(int argc, const char** argv) {
     opts.filename = options.input_filename;
     opts.mode = options.compatibility_mode ? tint::wgsl::ValidationMode::kCompat
                                            : tint::wgsl::ValidationMode::kFull;
+    opts.max_resolver_threads = options.max_resolver_threads;
     opts.printer = options.printer.get();
 #if TINT_BUILD_SPV_READER
     opts.use_ir = options.use_ir_reader;
     opts.spirv_reader_options = options.spirv_reader_options;
 #endif
 
-    auto info = tint::cmd::LoadProgramInfo(opts);
+    tint::PhaseTimings phase_timings;
+    auto info = [&] {
+        tint::PhaseTimingScope phase_timing_scope(phase_timings);
+        return tint::cmd::LoadProgramInfo(opts);
+    }();
+
+    if (options.time_phases) {
+        PrintPhaseTimings(phase_timings);
+    }
 
     if (options.parse_only) {
         return 1;
@@ -1415,6 +1498,9 @@ int main(int argc, const char** argv) {
         return 1;
     }
 
+    tint::PassTimings pass_timings;
+    tint::PassTimingScope pass_timing_scope(pass_timings);
+
     bool success = false;
     switch (options.format) {
         case Format::kSpirv:
@@ -1442,6 +1528,11 @@ int main(int argc, const char** argv) {
             std::cerr << "Unknown output format specified\n";
             return 1;
     }
+
+    if (options.time_transforms) {
+        PrintPassTimings(pass_timings);
+    }
+
     if (!success) {
         return 1;
     }
@@ -42,6 +42,8 @@ tint_add_target(tint_lang_core_constant lib
   lang/core/constant/clone_context.h
   lang/core/constant/composite.cc
   lang/core/constant/composite.h
+  lang/core/constant/dense_composite.cc
+  lang/core/constant/dense_composite.h
   lang/core/constant/eval.cc
   lang/core/constant/eval.h
   lang/core/constant/invalid.cc
@@ -82,6 +84,7 @@ tint_target_add_dependencies(tint_lang_core_constant lib
 ################################################################################
 tint_add_target(tint_lang_core_constant_test test
   lang/core/constant/composite_test.cc
+  lang/core/constant/dense_composite_test.cc
   lang/core/constant/eval_binary_op_test.cc
   lang/core/constant/eval_bitcast_test.cc
   lang/core/constant/eval_builtin_test.cc
@@ -0,0 +1,182 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/constant/dense_composite.h"
+
+#include <string_view>
+#include <utility>
+
+#include "src/tint/lang/core/constant/composite.h"
+#include "src/tint/lang/core/constant/manager.h"
+#include "src/tint/lang/core/constant/scalar.h"
+#include "src/tint/lang/core/constant/splat.h"
+#include "src/tint/lang/core/type/abstract_float.h"
+#include "src/tint/lang/core/type/abstract_int.h"
+#include "src/tint/lang/core/type/array.h"
+#include "src/tint/lang/core/type/bool.h"
+#include "src/tint/lang/core/type/f16.h"
+#include "src/tint/lang/core/type/f32.h"
+#include "src/tint/lang/core/type/i32.h"
+#include "src/tint/lang/core/type/u32.h"
+#include "src/tint/utils/rtti/switch.h"
+
+TINT_INSTANTIATE_TYPEINFO(tint::core::constant::DenseComposite);
+
+namespace tint::core::constant {
+
+namespace {
+
+/// Calls @p f with a zero value of the core::Number (or bool) for the scalar type @p ty.
+template <typename F>
+auto ScalarTypeDispatch(const core::type::Type* ty, F&& f) {
+    return Switch(
+        ty,                                                                //
+        [&](const core::type::AbstractInt*) { return f(AInt(0)); },        //
+        [&](const core::type::AbstractFloat*) { return f(AFloat(0)); },    //
+        [&](const core::type::I32*) { return f(i32(0)); },                 //
+        [&](const core::type::U32*) { return f(u32(0)); },                 //
+        [&](const core::type::F32*) { return f(f32(0)); },                 //
+        [&](const core::type::F16*) { return f(f16(0)); },                 //
+        [&](const core::type::Bool*) { return f(static_cast<bool>(0)); },  //
+        TINT_ICE_ON_NO_MATCH);
+}
+
+}  // namespace
+
+DenseComposite::DenseComposite(const core::type::Type* t,
+                               const core::type::Type* scalar_ty,
+                               VectorRef<uint8_t> scalars)
+    : type(t),
+      scalar_type(scalar_ty),
+      data(std::move(scalars)),
+      count(t->Elements().count),
+      all_zero(ScalarTypeDispatch(scalar_ty,
+                                  [&](auto zero) {
+                                      using T = decltype(zero);
+                                      for (size_t i = 0, n = NumScalars(); i < n; i++) {
+                                          if (!(ScalarAt<T>(i) == zero)) {
+                                              return false;
+                                          }
+                                      }
+                                      return true;
+                                  })),
+      any_zero(ScalarTypeDispatch(scalar_ty,
+                                  [&](auto zero) {
+                                      using T = decltype(zero);
+                                      for (size_t i = 0, n = NumScalars(); i < n; i++) {
+                                          if (ScalarAt<T>(i) == zero) {
+                                              return true;
+                                          }
+                                      }
+                                      return false;
+                                  })),
+      hash(tint::Hash(type,
+                      std::string_view(reinterpret_cast<const char*>(&data[0]),
+                                       data.Length()))) {
+    TINT_ASSERT(data.Length() == NumScalarsOf(t) * ScalarSize(scalar_ty));
+}
+
+DenseComposite::~DenseComposite() = default;
+
+size_t DenseComposite::NumScalarsOf(const core::type::Type* ty) {
+    size_t n = 1;
+    for (auto els = ty->Elements(); els.type; els = els.type->Elements()) {
+        n *= els.count;
+    }
+    return n;
+}
+
+size_t DenseComposite::ScalarSize(const core::type::Type* scalar_ty) {
+    return ScalarTypeDispatch(scalar_ty, [](auto zero) { return sizeof(zero); });
+}
+
+const Value* DenseComposite::Index(size_t i) const {
+    if (i >= count) {
+        return nullptr;
+    }
+    std::call_once(elements_built_, [&] {
+        auto* el_ty = type->Elements().type;
+        const size_t stride = NumScalarsOf(el_ty);
+        elements_.Reserve(count);
+        for (size_t el = 0; el < count; el++) {
+            elements_.Push(BuildElement(el_ty, el * stride));
+        }
+    });
+    return elements_[i];
+}
+
+const Value* DenseComposite::BuildElement(const core::type::Type* ty, size_t first) const {
+    auto [el_ty, n] = ty->Elements();
+    if (!el_ty) {
+        return ScalarTypeDispatch(ty, [&](auto zero) -> const Value* {
+            using T = decltype(zero);
+            return views_.Create<Scalar<T>>(ty, ScalarAt<T>(first));
+        });
+    }
+
+    // Match Manager::Composite(), which builds a Splat if all the elements are equal.
+    const size_t stride = NumScalarsOf(el_ty);
+    const size_t stride_bytes = stride * ScalarSize(scalar_type);
+    const uint8_t* first_el = &data[first * ScalarSize(scalar_type)];
+    bool all_equal = true;
+    for (size_t i = 1; i < n && all_equal; i++) {
+        all_equal = memcmp(first_el, first_el + i * stride_bytes, stride_bytes) == 0;
+    }
+    if (all_equal) {
+        return views_.Create<Splat>(ty, BuildElement(el_ty, first));
+    }
+
+    // Match Manager::Composite(), which builds a DenseComposite for arrays of at least kMinScalars
+    // scalars. This keeps the hash of the element equal to that of the canonical value.
+    if (ty->Is<core::type::Array>() && NumScalarsOf(ty) >= kMinScalars) {
+        const size_t size = NumScalarsOf(ty) * ScalarSize(scalar_type);
+        Vector<uint8_t, 0> scalars;
+        scalars.Resize(size);
+        memcpy(&scalars[0], first_el, size);
+        return views_.Create<DenseComposite>(ty, scalar_type, std::move(scalars));
+    }
+
+    Vector<const Value*, 16> els;
+    els.Reserve(n);
+    bool els_all_zero = true;
+    bool els_any_zero = false;
+    for (size_t i = 0; i < n; i++) {
+        auto* el = BuildElement(el_ty, first + i * stride);
+        els_all_zero = els_all_zero && el->AllZero();
+        els_any_zero = els_any_zero || el->AnyZero();
+        els.Push(el);
+    }
+    return views_.Create<Composite>(ty, std::move(els), els_all_zero, els_any_zero);
+}
+
+const DenseComposite* DenseComposite::Clone(CloneContext& ctx) const {
+    auto* ty = type->Clone(ctx.type_ctx);
+    auto* scalar_ty = scalar_type->Clone(ctx.type_ctx);
+    return ctx.dst.Get<DenseComposite>(ty, scalar_ty, data);
+}
+
+}  // namespace tint::core::constant
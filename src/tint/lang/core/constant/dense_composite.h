@@ -0,0 +1,146 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_CONSTANT_DENSE_COMPOSITE_H_
+#define SRC_TINT_LANG_CORE_CONSTANT_DENSE_COMPOSITE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+#include "src/tint/lang/core/constant/value.h"
+#include "src/tint/lang/core/number.h"
+#include "src/tint/lang/core/type/type.h"
+#include "src/tint/utils/containers/vector.h"
+#include "src/tint/utils/math/hash.h"
+#include "src/tint/utils/memory/block_allocator.h"
+#include "src/tint/utils/rtti/castable.h"
+
+namespace tint::core::constant {
+
+/// DenseComposite holds the scalars of an array constant in a single contiguous buffer, instead of
+/// a tree of individually allocated element values.
+///
+/// The array element type may be a scalar, or a vector, matrix or array of a scalar type. The
+/// elements are all materialized on the first call to Index(), in the same Scalar, Splat, Composite
+/// and DenseComposite forms that the Manager would build for them. Manager::Composite() returns a
+/// DenseComposite for arrays holding at least kMinScalars scalars.
+class DenseComposite : public Castable<DenseComposite, Value> {
+  public:
+    /// The minimum number of scalars in an array for Manager::Composite() to build a
+    /// DenseComposite.
+    static constexpr size_t kMinScalars = 64;
+
+    /// Constructor
+    /// @param t the array type
+    /// @param scalar_ty the type of each scalar in the array
+    /// @param scalars the scalars of the array in element order, each stored as the core::Number
+    /// (or bool) for @p scalar_ty
+    DenseComposite(const core::type::Type* t,
+                   const core::type::Type* scalar_ty,
+                   VectorRef<uint8_t> scalars);
+    ~DenseComposite() override;
+
+    /// @copydoc Value::Type()
+    const core::type::Type* Type() const override { return type; }
+
+    /// @copydoc Value::Index()
+    const Value* Index(size_t i) const override;
+
+    /// @copydoc Value::NumElements()
+    size_t NumElements() const override { return count; }
+
+    /// @copydoc Value::AllZero()
+    bool AllZero() const override { return all_zero; }
+
+    /// @copydoc Value::AnyZero()
+    bool AnyZero() const override { return any_zero; }
+
+    /// @copydoc Value::Hash()
+    HashCode Hash() const override { return hash; }
+
+    /// Clones the constant into the provided context
+    /// @param ctx the clone context
+    /// @returns the cloned node
+    const DenseComposite* Clone(CloneContext& ctx) const override;
+
+    /// @returns the number of scalars held by the composite
+    size_t NumScalars() const { return data.Length() / ScalarSize(scalar_type); }
+
+    /// @param i the scalar index
+    /// @returns the @p i'th scalar of the composite. T must be the core::Number (or bool) for
+    /// scalar_type.
+    template <typename T>
+    T ScalarAt(size_t i) const {
+        TINT_ASSERT((i + 1) * sizeof(T) <= data.Length());
+        T value;
+        memcpy(&value, &data[i * sizeof(T)], sizeof(T));
+        return value;
+    }
+
+    /// @param ty a scalar, vector, matrix or array type
+    /// @returns the number of scalars held by a value of type @p ty
+    static size_t NumScalarsOf(const core::type::Type* ty);
+
+    /// @param scalar_ty a scalar type
+    /// @returns the number of bytes used to hold a scalar of type @p scalar_ty
+    static size_t ScalarSize(const core::type::Type* scalar_ty);
+
+    /// The composite type
+    core::type::Type const* const type;
+    /// The type of each scalar
+    core::type::Type const* const scalar_type;
+    /// The scalars of the composite
+    const Vector<uint8_t, 0> data;
+    /// The number of elements of the composite
+    const size_t count;
+    /// True if all scalars are zero
+    const bool all_zero;
+    /// True if any scalar is zero
+    const bool any_zero;
+    /// The hash of the composite
+    const HashCode hash;
+
+  protected:
+    /// @copydoc Value::InternalValue()
+    std::variant<std::monostate, AInt, AFloat> InternalValue() const override { return {}; }
+
+  private:
+    /// Builds the value of type @p ty, from the scalars starting at @p first.
+    const Value* BuildElement(const core::type::Type* ty, size_t first) const;
+
+    /// Ensures #elements_ is built once. After that, Index() reads #elements_ without locking.
+    mutable std::once_flag elements_built_;
+    /// The allocator of the materialized elements
+    mutable BlockAllocator<Value, 4096> views_;
+    /// The materialized elements. Empty until the first call to Index().
+    mutable Vector<const Value*, 0> elements_;
+};
+
+}  // namespace tint::core::constant
+
+#endif  // SRC_TINT_LANG_CORE_CONSTANT_DENSE_COMPOSITE_H_
@@ -0,0 +1,288 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/constant/dense_composite.h"
+
+#include <cmath>
+
+#include "src/tint/lang/core/constant/eval.h"
+#include "src/tint/lang/core/constant/helper_test.h"
+#include "src/tint/lang/core/constant/scalar.h"
+#include "src/tint/lang/core/constant/splat.h"
+#include "src/tint/lang/core/fluent_types.h"
+#include "src/tint/lang/core/type/abstract_float.h"
+#include "src/tint/lang/core/type/array.h"
+#include "src/tint/lang/core/type/array_count.h"
+
+using namespace tint::core::number_suffixes;  // NOLINT
+using namespace tint::core::fluent_types;     // NOLINT
+
+namespace tint::core::constant {
+namespace {
+
+class ConstantTest_DenseComposite : public TestHelper {
+  protected:
+    /// @returns an array<f32, N> constant, where element i holds `first + i`
+    const Value* F32Array(uint32_t n, float first = 0) {
+        auto* ty = constants.types.array(constants.types.f32(), n);
+        Vector<const Value*, 8> elements;
+        for (uint32_t i = 0; i < n; i++) {
+            elements.Push(constants.Get(f32(first + static_cast<float>(i))));
+        }
+        return constants.Composite(ty, std::move(elements));
+    }
+};
+
+TEST_F(ConstantTest_DenseComposite, ManagerBuildsDense) {
+    auto* small = F32Array(DenseComposite::kMinScalars - 1);
+    auto* large = F32Array(DenseComposite::kMinScalars);
+
+    EXPECT_TRUE(small->Is<Composite>());
+    auto* dense = large->As<DenseComposite>();
+    ASSERT_NE(dense, nullptr);
+    EXPECT_EQ(dense->NumElements(), DenseComposite::kMinScalars);
+    EXPECT_EQ(dense->NumScalars(), DenseComposite::kMinScalars);
+    EXPECT_TRUE(dense->scalar_type->Is<core::type::F32>());
+    EXPECT_EQ(dense->data.Length(), DenseComposite::kMinScalars * sizeof(f32));
+    EXPECT_EQ(dense->ScalarAt<f32>(10), 10_f);
+}
+
+TEST_F(ConstantTest_DenseComposite, ManagerBuildsDense_OfVectors) {
+    auto* vec4f = constants.types.vec4(constants.types.f32());
+    auto* ty = constants.types.array(vec4f, 16u);
+    Vector<const Value*, 16> elements;
+    for (uint32_t i = 0; i < 16; i++) {
+        Vector<const Value*, 4> scalars;
+        for (uint32_t j = 0; j < 4; j++) {
+            scalars.Push(constants.Get(f32(static_cast<float>(i + j))));
+        }
+        elements.Push(constants.Composite(vec4f, std::move(scalars)));
+    }
+    auto* dense = constants.Composite(ty, std::move(elements))->As<DenseComposite>();
+    ASSERT_NE(dense, nullptr);
+    EXPECT_EQ(dense->NumElements(), 16u);
+    EXPECT_EQ(dense->NumScalars(), 64u);
+    EXPECT_EQ(dense->ScalarAt<f32>(13), 4_f);
+}
+
+TEST_F(ConstantTest_DenseComposite, AllZero_AnyZero) {
+    auto* ty = constants.types.array(constants.types.i32(), 64u);
+    Vector<const Value*, 64> none_zero;
+    Vector<const Value*, 64> some_zero;
+    for (int32_t i = 0; i < 64; i++) {
+        none_zero.Push(constants.Get(i32(i + 1)));
+        some_zero.Push(constants.Get(i32(i % 2)));
+    }
+    auto* a = constants.Composite(ty, std::move(none_zero));
+    auto* b = constants.Composite(ty, std::move(some_zero));
+    ASSERT_TRUE(a->Is<DenseComposite>());
+    ASSERT_TRUE(b->Is<DenseComposite>());
+    EXPECT_FALSE(a->AllZero());
+    EXPECT_FALSE(a->AnyZero());
+    EXPECT_FALSE(b->AllZero());
+    EXPECT_TRUE(b->AnyZero());
+}
+
+TEST_F(ConstantTest_DenseComposite, Index) {
+    auto* dense = F32Array(100, 1);
+    ASSERT_TRUE(dense->Is<DenseComposite>());
+
+    ASSERT_NE(dense->Index(0), nullptr);
+    ASSERT_NE(dense->Index(99), nullptr);
+    EXPECT_EQ(dense->Index(100), nullptr);
+
+    EXPECT_EQ(dense->Index(0)->As<Scalar<f32>>()->ValueOf(), 1.f);
+    EXPECT_EQ(dense->Index(42)->As<Scalar<f32>>()->ValueOf(), 43.f);
+    EXPECT_EQ(dense->Index(99)->As<Scalar<f32>>()->ValueOf(), 100.f);
+    EXPECT_EQ(dense->Index(42), dense->Index(42));
+}
+
+TEST_F(ConstantTest_DenseComposite, Index_NestedViews) {
+    auto* vec2i = constants.types.vec2(constants.types.i32());
+    auto* ty = constants.types.array(vec2i, 32u);
+    Vector<const Value*, 32> elements;
+    for (int32_t i = 0; i < 32; i++) {
+        elements.Push(
+            constants.Composite(vec2i, Vector{constants.Get(i32(i)), constants.Get(i32(-i))}));
+    }
+    auto* dense = constants.Composite(ty, std::move(elements));
+    ASSERT_TRUE(dense->Is<DenseComposite>());
+
+    // Element 0 is vec2(0, -0), which is a splat. Element 5 is vec2(5, -5).
+    auto* el0 = dense->Index(0);
+    auto* el5 = dense->Index(5);
+    ASSERT_TRUE(el0->Is<Splat>());
+    ASSERT_TRUE(el5->Is<Composite>());
+    EXPECT_TRUE(el0->AllZero());
+    EXPECT_FALSE(el5->AnyZero());
+    EXPECT_EQ(el0->Type(), vec2i);
+    EXPECT_EQ(el5->Type(), vec2i);
+    EXPECT_EQ(el5->Index(0)->ValueAs<i32>(), 5_i);
+    EXPECT_EQ(el5->Index(1)->ValueAs<i32>(), -5_i);
+}
+
+TEST_F(ConstantTest_DenseComposite, Index_PreservesNegativeZero) {
+    constant::Manager mgr;
+    auto* ty = mgr.types.array(mgr.types.f32(), 64u);
+    Vector<const Value*, 64> elements;
+    for (uint32_t i = 0; i < 64; i++) {
+        elements.Push(mgr.Get(i == 7 ? -0_f : f32(static_cast<float>(i + 1))));
+    }
+    auto* dense = mgr.Composite(ty, std::move(elements));
+    ASSERT_TRUE(dense->Is<DenseComposite>());
+    EXPECT_TRUE(dense->AnyZero());
+    EXPECT_TRUE(std::signbit(dense->Index(7)->ValueAs<f32>().value));
+    EXPECT_FALSE(std::signbit(dense->Index(0)->ValueAs<f32>().value));
+}
+
+TEST_F(ConstantTest_DenseComposite, SplatOfEqualViews) {
+    // Elements 0 to 7 of `dense` are all vec4(1, 2, 3, 4), but each is a separate view.
+    auto* vec4f = constants.types.vec4(constants.types.f32());
+    Vector<const Value*, 16> elements;
+    for (uint32_t i = 0; i < 16; i++) {
+        float x = i < 8 ? 1.f : static_cast<float>(i);
+        elements.Push(constants.Composite(
+            vec4f, Vector{constants.Get(f32(x)), constants.Get(f32(x + 1)),
+                          constants.Get(f32(x + 2)), constants.Get(f32(x + 3))}));
+    }
+    auto* dense = constants.Composite(constants.types.array(vec4f, 16u), std::move(elements));
+    ASSERT_TRUE(dense->Is<DenseComposite>());
+    ASSERT_NE(dense->Index(0), dense->Index(1));
+
+    Vector<const Value*, 16> views;
+    for (uint32_t i = 0; i < 16; i++) {
+        views.Push(dense->Index(i % 8));
+    }
+    auto* splat = constants.Composite(constants.types.array(vec4f, 16u), std::move(views));
+    ASSERT_TRUE(splat->Is<Splat>());
+    EXPECT_EQ(splat->Index(0)->Index(3)->ValueAs<f32>(), 4_f);
+}
+
+TEST_F(ConstantTest_DenseComposite, Deduplicated) {
+    auto* a = F32Array(80);
+    auto* b = F32Array(80);
+    auto* c = F32Array(80, 1);
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_TRUE(a->Equal(b));
+    EXPECT_FALSE(a->Equal(c));
+}
+
+TEST_F(ConstantTest_DenseComposite, Equal_NestedDense) {
+    auto* inner_ty = constants.types.array(constants.types.f32(), 64u);
+    auto* outer_ty = constants.types.array(inner_ty, 2u);
+    auto* inner = F32Array(64);
+    auto* outer = constants.Composite(outer_ty, Vector{inner, F32Array(64, 1)});
+    auto* dense = outer->As<DenseComposite>();
+    ASSERT_NE(dense, nullptr);
+    EXPECT_EQ(dense->NumScalars(), 128u);
+    EXPECT_EQ(dense->Index(0)->Type(), inner->Type());
+    EXPECT_EQ(dense->Index(0)->NumElements(), 64u);
+    EXPECT_EQ(dense->Index(0)->Index(5)->ValueAs<f32>(), 5_f);
+    EXPECT_EQ(dense->Index(1)->Index(5)->ValueAs<f32>(), 6_f);
+
+    // The elements are views, but hash and compare equal to the canonical values.
+    ASSERT_NE(dense->Index(0), inner);
+    EXPECT_TRUE(dense->Index(0)->Is<DenseComposite>());
+    EXPECT_EQ(dense->Index(0)->Hash(), inner->Hash());
+    EXPECT_TRUE(dense->Index(0)->Equal(inner));
+    EXPECT_TRUE(inner->Equal(dense->Index(0)));
+    EXPECT_FALSE(dense->Index(1)->Equal(inner));
+
+    // An array of equal views is a splat.
+    auto* splat = constants.Composite(outer_ty, Vector{dense->Index(0), inner});
+    ASSERT_TRUE(splat->Is<Splat>());
+}
+
+TEST_F(ConstantTest_DenseComposite, Clone) {
+    auto* dense = F32Array(64)->As<DenseComposite>();
+    ASSERT_NE(dense, nullptr);
+
+    constant::Manager mgr;
+    constant::CloneContext ctx{core::type::CloneContext{{nullptr}, {nullptr, &mgr.types}}, mgr};
+
+    auto* r = dense->Clone(ctx);
+    EXPECT_NE(r, dense);
+    ASSERT_NE(r, nullptr);
+    EXPECT_TRUE(r->type->Is<core::type::Array>());
+    EXPECT_TRUE(r->scalar_type->Is<core::type::F32>());
+    EXPECT_EQ(r->count, 64u);
+    EXPECT_EQ(r->data, dense->data);
+    EXPECT_EQ(r->ScalarAt<f32>(63), 63_f);
+}
+
+TEST_F(ConstantTest_DenseComposite, Convert) {
+    auto* ty = constants.types.Get<core::type::Array>(
+        constants.types.AFloat(), constants.types.Get<core::type::ConstantArrayCount>(64u), 0u, 0u,
+        0u, 0u);
+    Vector<const Value*, 64> elements;
+    for (uint32_t i = 0; i < 64; i++) {
+        elements.Push(constants.Get(AFloat(i * 0.5)));
+    }
+    auto* dense = constants.Composite(ty, std::move(elements));
+    ASSERT_TRUE(dense->Is<DenseComposite>());
+
+    diag::List diags;
+    Eval eval(constants, diags);
+    auto* f32_ty = constants.types.array(constants.types.f32(), 64u);
+    auto result = eval.Convert(f32_ty, dense, {});
+    ASSERT_EQ(result, Success) << diags;
+
+    auto* converted = result.Get()->As<DenseComposite>();
+    ASSERT_NE(converted, nullptr);
+    EXPECT_EQ(converted->Type(), f32_ty);
+    EXPECT_TRUE(converted->scalar_type->Is<core::type::F32>());
+    EXPECT_EQ(converted->ScalarAt<f32>(3), 1.5_f);
+    EXPECT_EQ(converted->Index(63)->ValueAs<f32>(), 31.5_f);
+}
+
+TEST_F(ConstantTest_DenseComposite, Convert_ToSplat) {
+    // The elements are all distinct abstract-floats, which all convert to the f32 1.0.
+    auto* ty = constants.types.Get<core::type::Array>(
+        constants.types.AFloat(), constants.types.Get<core::type::ConstantArrayCount>(64u), 0u, 0u,
+        0u, 0u);
+    Vector<const Value*, 64> elements;
+    for (uint32_t i = 0; i < 64; i++) {
+        elements.Push(constants.Get(AFloat(1.0 + i * 1e-12)));
+    }
+    auto* dense = constants.Composite(ty, std::move(elements));
+    ASSERT_TRUE(dense->Is<DenseComposite>());
+
+    diag::List diags;
+    Eval eval(constants, diags);
+    auto* f32_ty = constants.types.array(constants.types.f32(), 64u);
+    auto result = eval.Convert(f32_ty, dense, {});
+    ASSERT_EQ(result, Success) << diags;
+
+    auto* splat = result.Get()->As<Splat>();
+    ASSERT_NE(splat, nullptr);
+    EXPECT_EQ(splat->Type(), f32_ty);
+    EXPECT_EQ(splat->Index(0), constants.Get(1_f));
+}
+
+}  // namespace
+}  // namespace tint::core::constant
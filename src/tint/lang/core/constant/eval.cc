@@ -28,6 +28,7 @@
 #include "src/tint/lang/core/constant/eval.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <limits>
 #include <optional>
@@ -36,6 +37,7 @@
 #include <utility>
 
 #include "src/tint/lang/core/constant/composite.h"
+#include "src/tint/lang/core/constant/dense_composite.h"
 #include "src/tint/lang/core/constant/scalar.h"
 #include "src/tint/lang/core/constant/splat.h"
 #include "src/tint/lang/core/constant/value.h"
@@ -51,6 +53,7 @@
 #include "src/tint/lang/core/type/struct.h"
 #include "src/tint/lang/core/type/u32.h"
 #include "src/tint/lang/core/type/vector.h"
+#include "src/tint/utils/containers/hashmap.h"
 #include "src/tint/utils/containers/map.h"
 #include "src/tint/utils/containers/transform.h"
 #include "src/tint/utils/diagnostic/diagnostic.h"
@@ -327,6 +330,72 @@ const ScalarBase* ScalarConvert(const Scalar<T>* scalar,
     TINT_END_DISABLE_WARNING(UNREACHABLE_CODE);
 }
 
+/// @returns the value of type @p ty, built by @p mgr from the scalars of type `T` at @p scalars
+template <typename T>
+const Value* BuildFromScalars(Manager& mgr, const core::type::Type* ty, const uint8_t* scalars) {
+    auto [el_ty, n] = ty->Elements();
+    if (!el_ty) {
+        T value;
+        memcpy(&value, scalars, sizeof(T));
+        return mgr.Get<Scalar<T>>(ty, value);
+    }
+    const size_t stride = DenseComposite::NumScalarsOf(el_ty) * sizeof(T);
+    Vector<const Value*, 16> els;
+    els.Reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        els.Push(BuildFromScalars<T>(mgr, el_ty, scalars + i * stride));
+    }
+    return mgr.Composite(ty, std::move(els));
+}
+
+/// Converts the DenseComposite @p dense to the array type @p target_ty, one scalar at a time,
+/// without materializing the elements of @p dense.
+/// @returns the converted value, or nullptr on error.
+const Value* ConvertDense(const DenseComposite* dense,
+                          const core::type::Type* target_ty,
+                          ConvertContext& ctx) {
+    auto* target_scalar_ty = target_ty;
+    while (auto* el_ty = target_scalar_ty->Elements().type) {
+        target_scalar_ty = el_ty;
+    }
+    const size_t num_scalars = dense->NumScalars();
+    Vector<uint8_t, 0> scalars;
+    bool ok = ZeroTypeDispatch(dense->scalar_type, [&](auto from_zero) {
+        using FROM = decltype(from_zero);
+        return ZeroTypeDispatch(target_scalar_ty, [&](auto to_zero) {
+            using TO = decltype(to_zero);
+            scalars.Resize(num_scalars * sizeof(TO));
+            for (size_t i = 0; i < num_scalars; i++) {
+                Scalar<FROM> scalar(dense->scalar_type, dense->template ScalarAt<FROM>(i));
+                auto* converted = ScalarConvert(&scalar, target_scalar_ty, ctx);
+                if (!converted) {
+                    return false;
+                }
+                TO value = static_cast<const Scalar<TO>*>(converted)->value;
+                memcpy(&scalars[i * sizeof(TO)], &value, sizeof(TO));
+            }
+            return true;
+        });
+    });
+    if (!ok) {
+        return nullptr;
+    }
+
+    // Distinct elements may convert to the same value, in which case the canonical form is a Splat.
+    const size_t count = target_ty->Elements().count;
+    const size_t el_bytes = scalars.Length() / count;
+    for (size_t i = 1; i < count; i++) {
+        if (memcmp(&scalars[0], &scalars[i * el_bytes], el_bytes) != 0) {
+            return ctx.mgr.Get<DenseComposite>(target_ty, target_scalar_ty, std::move(scalars));
+        }
+    }
+    auto* el_ty = target_ty->Elements().type;
+    auto* el = ZeroTypeDispatch(target_scalar_ty, [&](auto zero) {
+        return BuildFromScalars<decltype(zero)>(ctx.mgr, el_ty, &scalars[0]);
+    });
+    return ctx.mgr.Splat(target_ty, el);
+}
+
 /// Converts the constant value to the target type.
 /// @returns the converted value, or nullptr on error.
 const Value* ConvertInternal(const Value* root_value,
@@ -344,7 +413,13 @@ const Value* ConvertInternal(const Value* root_value,
         size_t count = 0;
         const core::type::Type* type = nullptr;
     };
-    using Action = std::variant<ActionConvert, ActionBuildSplat, ActionBuildComposite>;
+    struct ActionBuildDeduplicatedComposite {
+        size_t unique_count = 0;
+        const core::type::Type* type = nullptr;
+        Vector<uint32_t, 8> slots;  // Index of the converted value for each element
+    };
+    using Action = std::variant<ActionConvert, ActionBuildSplat, ActionBuildComposite,
+                                ActionBuildDeduplicatedComposite>;
 
     Vector<Action, 8> pending{
         ActionConvert{root_value, root_target_ty},
@@ -376,6 +451,22 @@ const Value* ConvertInternal(const Value* root_value,
             continue;
         }
 
+        if (auto* build = std::get_if<ActionBuildDeduplicatedComposite>(&next)) {
+            TINT_ASSERT(value_stack.Length() >= build->unique_count);
+            Vector<const Value*, 32> unique;
+            unique.Reserve(build->unique_count);
+            for (size_t i = 0; i < build->unique_count; i++) {
+                unique.Push(value_stack.Pop());
+            }
+            Vector<const Value*, 32> elements;
+            elements.Reserve(build->slots.Length());
+            for (auto slot : build->slots) {
+                elements.Push(unique[slot]);
+            }
+            value_stack.Push(ctx.mgr.Composite(build->type, std::move(elements)));
+            continue;
+        }
+
         auto* convert = std::get_if<ActionConvert>(&next);
 
         bool ok = Switch(
@@ -410,6 +501,14 @@ const Value* ConvertInternal(const Value* root_value,
                 value_stack.Push(converted);
                 return true;
             },
+            [&](const DenseComposite* dense) {
+                auto* converted = ConvertDense(dense, convert->target_ty, ctx);
+                if (!converted) {
+                    return false;
+                }
+                value_stack.Push(converted);
+                return true;
+            },
             [&](const Splat* splat) {
                 const core::type::Type* target_el_ty = nullptr;
                 if (auto* str = convert->target_ty->As<core::type::Struct>()) {
@@ -438,10 +537,36 @@ const Value* ConvertInternal(const Value* root_value,
             [&](const Composite* composite) {
                 const size_t el_count = composite->NumElements();
 
+                auto* str = convert->target_ty->As<core::type::Struct>();
+                auto* el_ty = str ? nullptr : convert->target_ty->Elements(convert->target_ty).type;
+                if (el_ty && !el_ty->Is<core::type::Scalar>()) {
+                    // Constants are uniqued, so tables of vectors or matrices often hold the same
+                    // element many times. Convert each distinct element once.
+                    Hashmap<const Value*, uint32_t, 32> slot_of;
+                    Vector<const Value*, 32> unique;
+                    Vector<uint32_t, 8> slots;
+                    slots.Reserve(el_count);
+                    for (size_t i = 0; i < el_count; i++) {
+                        auto* el = composite->Index(i);
+                        slots.Push(slot_of.GetOrAdd(el, [&] {
+                            unique.Push(el);
+                            return static_cast<uint32_t>(unique.Length() - 1);
+                        }));
+                    }
+                    if (unique.Length() < el_count) {
+                        pending.Push(ActionBuildDeduplicatedComposite{
+                            unique.Length(), convert->target_ty, std::move(slots)});
+                        for (auto* el : unique) {
+                            pending.Push(ActionConvert{el, el_ty});
+                        }
+                        return true;
+                    }
+                }
+
                 // Build the new composite from the converted element types.
                 pending.Push(ActionBuildComposite{el_count, convert->target_ty});
 
-                if (auto* str = convert->target_ty->As<core::type::Struct>()) {
+                if (str) {
                     if (TINT_UNLIKELY(str->Members().Length() != el_count)) {
                         TINT_ICE()
                             << "const-eval conversion of structure has mismatched element counts";
@@ -453,7 +578,6 @@ const Value* ConvertInternal(const Value* root_value,
                     }
                 } else {
                     // Non-struct composites have the same type for all elements.
-                    auto* el_ty = convert->target_ty->Elements(convert->target_ty).type;
                     for (size_t i = 0; i < el_count; i++) {
                         auto* el = composite->Index(i);
                         pending.Push(ActionConvert{el, el_ty});
@@ -471,6 +595,20 @@ const Value* ConvertInternal(const Value* root_value,
     return value_stack.Pop();
 }
 
+/// @returns the splat element of @p value if @p value is a Splat, otherwise nullptr.
+const Value* SplatElement(const Value* value) {
+    auto* splat = value->As<Splat>();
+    return splat ? splat->el : nullptr;
+}
+
+/// @returns a splat of type @p ty holding the transformed splat element @p el, or @p el's failure.
+Eval::Result SplatResult(Manager& mgr, const core::type::Type* ty, const Eval::Result& el) {
+    if (el != Success) {
+        return el.Failure();
+    }
+    return el.Get() ? mgr.Splat(ty, el.Get()) : nullptr;
+}
+
 /// TransformElements constructs a new constant of type `composite_ty` by applying the
 /// transformation function `f` on each of the most deeply nested elements of 'cs'. Assumes that all
 /// input constants `cs` are of the same arity (all scalars or all vectors of the same size).
@@ -520,6 +658,11 @@ Eval::Result TransformUnaryElements(Manager& mgr,
 
     auto* composite_el_ty = composite_ty->Elements(composite_ty).type;
 
+    if (auto* el0 = SplatElement(c0)) {
+        // Transform the splatted element once, instead of once per element.
+        return SplatResult(mgr, composite_ty, TransformUnaryElements(mgr, composite_el_ty, f, el0));
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(n);
     for (uint32_t i = 0; i < n; i++) {
@@ -552,6 +695,13 @@ Eval::Result TransformBinaryElements(Manager& mgr,
 
     auto* composite_el_ty = composite_ty->Elements(composite_ty).type;
 
+    auto* el0 = SplatElement(c0);
+    auto* el1 = SplatElement(c1);
+    if (el0 && el1) {
+        return SplatResult(mgr, composite_ty,
+                           TransformBinaryElements(mgr, composite_el_ty, f, el0, el1));
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(n);
     for (uint32_t i = 0; i < n; i++) {
@@ -584,6 +734,14 @@ Eval::Result TransformBinaryDifferingArityElements(Manager& mgr,
 
     const auto* element_ty = composite_ty->Elements(composite_ty).type;
 
+    // A scalar operand is used for every element, so behaves as a splat.
+    auto* el0 = (n0 == 1) ? c0 : SplatElement(c0);
+    auto* el1 = (n1 == 1) ? c1 : SplatElement(c1);
+    if (el0 && el1) {
+        return SplatResult(mgr, composite_ty,
+                           TransformBinaryDifferingArityElements(mgr, element_ty, f, el0, el1));
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(max_n);
     for (uint32_t i = 0; i < max_n; i++) {
@@ -620,6 +778,14 @@ Eval::Result TransformTernaryElements(Manager& mgr,
 
     auto* composite_el_ty = composite_ty->Elements(composite_ty).type;
 
+    auto* el0 = SplatElement(c0);
+    auto* el1 = SplatElement(c1);
+    auto* el2 = SplatElement(c2);
+    if (el0 && el1 && el2) {
+        return SplatResult(mgr, composite_ty,
+                           TransformTernaryElements(mgr, composite_el_ty, f, el0, el1, el2));
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(n);
     for (uint32_t i = 0; i < n; i++) {
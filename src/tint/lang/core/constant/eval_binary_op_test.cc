@@ -27,6 +27,7 @@
 
 #include "src/tint/lang/core/constant/eval_test.h"
 
+#include "src/tint/lang/core/constant/splat.h"
 #include "src/tint/lang/wgsl/builtin_fn.h"
 #include "src/tint/utils/result/result.h"
 
@@ -2531,6 +2532,21 @@ TEST_F(ConstEvalTest, ShortCircuit_Or_MixedConstantAndRuntime) {
     ValidateOr(Sem(), binary);
 }
 
+TEST_F(ConstEvalTest, Splat_Mul_Scalar) {
+    // const c = mat2x3<f32>(vec3<f32>(2), vec3<f32>(2)) * 3f;
+    auto* expr =
+        Mul(Call<mat2x3<f32>>(Call<vec3<f32>>(2_f), Call<vec3<f32>>(2_f)), Expr(3_f));
+    WrapInFunction(Decl(Const("c", expr)));
+    EXPECT_TRUE(r()->Resolve()) << r()->error();
+
+    auto* value = Sem().Get(expr)->ConstantValue();
+    ASSERT_NE(value, nullptr);
+    EXPECT_TRUE(value->Is<Splat>());
+    EXPECT_TRUE(value->Index(1)->Is<Splat>());
+    EXPECT_TRUE(value->Index(1)->Type()->Is<core::type::Vector>());
+    EXPECT_EQ(value->Index(1)->Index(2)->ValueAs<f32>(), 6_f);
+}
+
 ////////////////////////////////////////////////
 // Short-Circuit Nested
 ////////////////////////////////////////////////
@@ -506,5 +506,35 @@ TEST_F(ConstEvalTest, StructAbstractSplat_to_StructDifferentTypes) {
     EXPECT_EQ(v->ConstantValue()->Index(1)->ValueAs<f32>(), 0_f);
 }
 
+TEST_F(ConstEvalTest, AbstractArray_RepeatedElements_to_F32) {
+    // fn f() {
+    //   const c = array(vec2(1.0, 2.0), vec2(3.0, 4.0), vec2(1.0, 2.0), vec2(3.0, 4.0));
+    //   var v = c;
+    // }
+    auto* expr_c = Call("array", Call("vec2", 1.0_a, 2.0_a), Call("vec2", 3.0_a, 4.0_a),
+                        Call("vec2", 1.0_a, 2.0_a), Call("vec2", 3.0_a, 4.0_a));
+    auto* materialized = Expr("c");
+    WrapInFunction(Decl(Const("c", expr_c)), Decl(Var("v", materialized)));
+
+    EXPECT_TRUE(r()->Resolve()) << r()->error();
+
+    auto* v = Sem().GetVal(materialized);
+    ASSERT_NE(v, nullptr);
+    EXPECT_TRUE(v->Is<sem::Materialize>());
+    auto* value = v->ConstantValue();
+    EXPECT_TYPE(value->Type(), v->Type());
+    ASSERT_EQ(value->NumElements(), 4u);
+    for (size_t i = 0; i < 4; i++) {
+        auto* el = value->Index(i);
+        EXPECT_TRUE(el->Type()->Is<core::type::Vector>());
+        EXPECT_TRUE(el->Index(0)->Type()->Is<core::type::F32>());
+        EXPECT_EQ(el->Index(0)->ValueAs<f32>(), i % 2 ? 3_f : 1_f);
+        EXPECT_EQ(el->Index(1)->ValueAs<f32>(), i % 2 ? 4_f : 2_f);
+    }
+    // Repeated elements are converted once, and share the converted value.
+    EXPECT_EQ(value->Index(0), value->Index(2));
+    EXPECT_EQ(value->Index(1), value->Index(3));
+}
+
 }  // namespace
 }  // namespace tint::core::constant::test
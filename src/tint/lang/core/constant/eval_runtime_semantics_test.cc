@@ -28,6 +28,7 @@
 #include "src/tint/lang/core/constant/eval_test.h"
 
 #include "src/tint/lang/core/constant/scalar.h"
+#include "src/tint/lang/core/constant/splat.h"
 
 using namespace tint::core::number_suffixes;  // NOLINT
 
@@ -587,5 +588,17 @@ TEST_F(ConstEvalRuntimeSemanticsTest, Vec_Overflow_SingleComponent) {
     EXPECT_EQ(error(), R"(warning: sqrt must be called with a value >= 0)");
 }
 
+TEST_F(ConstEvalRuntimeSemanticsTest, Sqrt_F32_Splat) {
+    // Test that an element-wise operation on a splat only evaluates the splatted element once.
+    auto* vec4f = create<core::type::Vector>(create<core::type::F32>(), 4u);
+    auto* a = constants.Splat(vec4f, constants.Get(f32(-1)));
+    auto result = eval.sqrt(a->Type(), Vector{a}, {});
+    ASSERT_EQ(result, Success);
+    EXPECT_TRUE(result.Get()->Is<Splat>());
+    EXPECT_EQ(result.Get()->Index(0)->ValueAs<f32>(), 0);
+    EXPECT_EQ(result.Get()->Index(3)->ValueAs<f32>(), 0);
+    EXPECT_EQ(error(), R"(warning: sqrt must be called with a value >= 0)");
+}
+
 }  // namespace
 }  // namespace tint::core::constant::test
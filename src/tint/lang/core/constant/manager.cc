@@ -27,7 +27,10 @@
 
 #include "src/tint/lang/core/constant/manager.h"
 
+#include <cstring>
+
 #include "src/tint/lang/core/constant/composite.h"
+#include "src/tint/lang/core/constant/dense_composite.h"
 #include "src/tint/lang/core/constant/invalid.h"
 #include "src/tint/lang/core/constant/scalar.h"
 #include "src/tint/lang/core/constant/splat.h"
@@ -40,12 +43,53 @@
 #include "src/tint/lang/core/type/i32.h"
 #include "src/tint/lang/core/type/manager.h"
 #include "src/tint/lang/core/type/matrix.h"
+#include "src/tint/lang/core/type/scalar.h"
 #include "src/tint/lang/core/type/u32.h"
 #include "src/tint/lang/core/type/vector.h"
 #include "src/tint/utils/containers/predicates.h"
 #include "src/tint/utils/rtti/switch.h"
 
 namespace tint::core::constant {
+namespace {
+
+/// @returns the scalar type of the array type @p type, if the array holds at least
+/// DenseComposite::kMinScalars scalars, otherwise nullptr.
+const core::type::Type* DenseScalarType(const core::type::Type* type) {
+    if (!type->Is<core::type::Array>()) {
+        return nullptr;
+    }
+    auto* ty = type;
+    while (auto* el_ty = ty->Elements().type) {
+        ty = el_ty;
+    }
+    if (!ty->Is<core::type::Scalar>() ||
+        DenseComposite::NumScalarsOf(type) < DenseComposite::kMinScalars) {
+        return nullptr;
+    }
+    return ty;
+}
+
+/// Writes the scalars of @p value to @p out, and advances @p out past the written scalars.
+/// @p value must be composed of scalars of type `T`.
+template <typename T>
+void WriteScalars(const Value* value, uint8_t*& out) {
+    if (auto* dense = value->As<DenseComposite>()) {
+        memcpy(out, &dense->data[0], dense->data.Length());
+        out += dense->data.Length();
+        return;
+    }
+    if (auto* scalar = value->As<Scalar<T>>()) {
+        memcpy(out, &scalar->value, sizeof(T));
+        out += sizeof(T);
+        return;
+    }
+    TINT_ASSERT(!value->Is<ScalarBase>());
+    for (size_t i = 0, n = value->NumElements(); i < n; i++) {
+        WriteScalars<T>(value->Index(i), out);
+    }
+}
+
+}  // namespace
 
 Manager::Manager() = default;
 
@@ -75,7 +119,9 @@ const constant::Value* Manager::Composite(const core::type::Type* type,
         if (all_zero && !el->AllZero()) {
             all_zero = false;
         }
-        if (all_equal && el != first) {
+        // Elements of a DenseComposite are not interned, so equal elements may be different
+        // pointers. Compare those by value.
+        if (all_equal && el != first && !el->Equal(first)) {
             all_equal = false;
         }
     }
@@ -83,6 +129,29 @@ const constant::Value* Manager::Composite(const core::type::Type* type,
         return Splat(type, elements.Front());
     }
 
+    if (auto* scalar_ty = DenseScalarType(type)) {
+        Vector<uint8_t, 0> scalars;
+        auto write = [&](auto zero) {
+            using T = decltype(zero);
+            scalars.Resize(DenseComposite::NumScalarsOf(type) * sizeof(T));
+            uint8_t* out = &scalars[0];
+            for (auto* el : elements) {
+                WriteScalars<T>(el, out);
+            }
+        };
+        Switch(
+            scalar_ty,                                                      //
+            [&](const core::type::AbstractInt*) { write(AInt(0)); },        //
+            [&](const core::type::AbstractFloat*) { write(AFloat(0)); },    //
+            [&](const core::type::I32*) { write(i32(0)); },                 //
+            [&](const core::type::U32*) { write(u32(0)); },                 //
+            [&](const core::type::F32*) { write(f32(0)); },                 //
+            [&](const core::type::F16*) { write(f16(0)); },                 //
+            [&](const core::type::Bool*) { write(static_cast<bool>(0)); },  //
+            TINT_ICE_ON_NO_MATCH);
+        return Get<DenseComposite>(type, scalar_ty, std::move(scalars));
+    }
+
     return Get<constant::Composite>(type, std::move(elements), all_zero, any_zero);
 }
 
@@ -27,6 +27,7 @@
 
 #include "src/tint/lang/core/constant/value.h"
 
+#include "src/tint/lang/core/constant/dense_composite.h"
 #include "src/tint/lang/core/constant/splat.h"
 #include "src/tint/lang/core/type/array.h"
 #include "src/tint/lang/core/type/invalid.h"
@@ -60,6 +61,14 @@ bool Value::Equal(const constant::Value* b) const {
             return true;
         }
 
+        // Compare the scalars of dense composites directly, instead of materializing elements
+        if (auto* dense_a = As<DenseComposite>()) {
+            if (auto* dense_b = b->As<DenseComposite>()) {
+                return dense_a->scalar_type == dense_b->scalar_type &&
+                       dense_a->data == dense_b->data;
+            }
+        }
+
         // Avoid per-element comparisons if the constants are splats
         bool a_is_splat = Is<Splat>();
         bool b_is_splat = b->Is<Splat>();
@@ -108,3 +108,35 @@ tint_target_add_dependencies(tint_lang_core_intrinsic_test test
 tint_target_add_external_dependencies(tint_lang_core_intrinsic_test test
   "gtest"
 )
+
+################################################################################
+# Target:    tint_lang_core_intrinsic_bench
+# Kind:      bench
+################################################################################
+tint_add_target(tint_lang_core_intrinsic_bench bench
+  lang/core/intrinsic/table_bench.cc
+)
+
+tint_target_add_dependencies(tint_lang_core_intrinsic_bench bench
+  tint_lang_core
+  tint_lang_core_constant
+  tint_lang_core_intrinsic
+  tint_lang_core_type
+  tint_utils_containers
+  tint_utils_diagnostic
+  tint_utils_ice
+  tint_utils_id
+  tint_utils_macros
+  tint_utils_math
+  tint_utils_memory
+  tint_utils_reflection
+  tint_utils_result
+  tint_utils_rtti
+  tint_utils_symbol
+  tint_utils_text
+  tint_utils_traits
+)
+
+tint_target_add_external_dependencies(tint_lang_core_intrinsic_bench bench
+  "google-benchmark"
+)
\ No newline at end of file
@@ -106,6 +106,7 @@ static void PrintTypeList(StyledText& ss, VectorRef<const core::type::Type*> typ
 /// @param member_function `true` if the builtin should be a member function
 /// @param on_no_match an error callback when no intrinsic overloads matched the provided
 ///                    arguments.
+/// If the context has an OverloadCache, the result is taken from, or added to, the cache.
 /// @returns the matched intrinsic
 Result<Overload, StyledText> MatchIntrinsic(Context& context,
                                             const IntrinsicInfo& intrinsic,
@@ -116,6 +117,17 @@ Result<Overload, StyledText> MatchIntrinsic(Context& context,
                                             bool member_function,
                                             const OnNoMatch& on_no_match);
 
+/// MatchIntrinsic() without the OverloadCache.
+Result<Overload, StyledText> MatchIntrinsicUncached(
+    Context& context,
+    const IntrinsicInfo& intrinsic,
+    std::string_view intrinsic_name,
+    VectorRef<const core::type::Type*> template_args,
+    VectorRef<const core::type::Type*> args,
+    EvaluationStage earliest_eval_stage,
+    bool member_function,
+    const OnNoMatch& on_no_match);
+
 /// The scoring mode for ScoreOverload()
 enum class ScoreMode {
     /// If the overload doesn't match, then the returned Candidate will simply have a score of 1.
@@ -197,6 +209,31 @@ Result<Overload, StyledText> MatchIntrinsic(Context& context,
                                             EvaluationStage earliest_eval_stage,
                                             bool member_function,
                                             const OnNoMatch& on_no_match) {
+    if (!context.cache) {
+        return MatchIntrinsicUncached(context, intrinsic, intrinsic_name, template_args, args,
+                                      earliest_eval_stage, member_function, on_no_match);
+    }
+
+    OverloadCache::Key key{&intrinsic,  intrinsic_name,      template_args,
+                           args,        earliest_eval_stage, member_function};
+    if (auto* cached = context.cache->Get(key)) {
+        return *cached;
+    }
+    auto result = MatchIntrinsicUncached(context, intrinsic, intrinsic_name, template_args, args,
+                                         earliest_eval_stage, member_function, on_no_match);
+    context.cache->Add(std::move(key), result);
+    return result;
+}
+
+Result<Overload, StyledText> MatchIntrinsicUncached(
+    Context& context,
+    const IntrinsicInfo& intrinsic,
+    std::string_view intrinsic_name,
+    VectorRef<const core::type::Type*> template_args,
+    VectorRef<const core::type::Type*> args,
+    EvaluationStage earliest_eval_stage,
+    bool member_function,
+    const OnNoMatch& on_no_match) {
     const size_t num_overloads = static_cast<size_t>(intrinsic.num_overloads);
     size_t num_matched = 0;
     size_t match_idx = 0;
@@ -30,6 +30,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <utility>
 
 #include "src/tint/lang/core/binary_op.h"
@@ -39,6 +40,7 @@
 #include "src/tint/lang/core/intrinsic/table_data.h"
 #include "src/tint/lang/core/parameter_usage.h"
 #include "src/tint/lang/core/unary_op.h"
+#include "src/tint/utils/containers/hashmap.h"
 #include "src/tint/utils/containers/vector.h"
 #include "src/tint/utils/text/string.h"
 #include "src/tint/utils/text/string_stream.h"
@@ -101,6 +103,83 @@ struct Overload {
     bool operator!=(const Overload& other) const { return !(*this == other); }
 };
 
+/// OverloadCache memoizes the results of overload resolution, including failures to resolve, so
+/// that repeated lookups of the same signature do not evaluate the overload matchers again.
+/// As the cached overloads hold types, a cache must only be used with a single type manager.
+class OverloadCache {
+  public:
+    /// Key is the signature of an intrinsic lookup
+    struct Key {
+        /// The intrinsic being called
+        const IntrinsicInfo* intrinsic = nullptr;
+        /// The name of the intrinsic, which is used by the failure message. Keys held by the cache
+        /// refer to a copy of the name owned by the cache.
+        std::string_view name;
+        /// The template argument types
+        Vector<const core::type::Type*, 2> template_args;
+        /// The argument types
+        Vector<const core::type::Type*, Overload::kNumFixedParameters> args;
+        /// The earliest evaluation stage that the call can be made
+        EvaluationStage earliest_eval_stage = EvaluationStage::kRuntime;
+        /// `true` if the intrinsic is a member function
+        bool member_function = false;
+
+        /// @returns the hash code of the key
+        tint::HashCode HashCode() const {
+            return Hash(intrinsic, name, template_args, args, earliest_eval_stage,
+                        member_function);
+        }
+
+        /// Equality operator
+        /// @param other the key to compare against
+        /// @returns true if this key and @p other are the same
+        bool operator==(const Key& other) const {
+            return intrinsic == other.intrinsic && name == other.name &&
+                   template_args == other.template_args && args == other.args &&
+                   earliest_eval_stage == other.earliest_eval_stage &&
+                   member_function == other.member_function;
+        }
+    };
+
+    /// Constructor
+    OverloadCache() = default;
+
+    /// The keys refer to names owned by the cache, so the cache cannot be copied.
+    OverloadCache(const OverloadCache&) = delete;
+    OverloadCache& operator=(const OverloadCache&) = delete;
+
+    /// @param key the signature of the lookup
+    /// @returns the cached result of the lookup, or nullptr if the lookup has not been cached
+    const Result<Overload, StyledText>* Get(const Key& key) const {
+        if (auto result = results_.Get(key)) {
+            return &*result;
+        }
+        return nullptr;
+    }
+
+    /// Adds the result of a lookup to the cache.
+    /// @param key the signature of the lookup
+    /// @param result the result of the lookup
+    void Add(Key&& key, const Result<Overload, StyledText>& result) {
+        key.name = *names_.emplace(key.name).first;
+        results_.Add(std::move(key), result);
+    }
+
+    /// @returns the number of cached lookups
+    size_t Count() const { return results_.Count(); }
+
+    /// Removes all the cached lookups
+    void Clear() {
+        results_.Clear();
+        names_.clear();
+    }
+
+  private:
+    Hashmap<Key, Result<Overload, StyledText>, 32> results_;
+    /// The intrinsic names referenced by the keys of #results_
+    std::unordered_set<std::string> names_;
+};
+
 /// The context data used to lookup intrinsic information
 struct Context {
     /// The table table
@@ -109,6 +188,8 @@ struct Context {
     core::type::Manager& types;
     /// The symbol table
     SymbolTable& symbols;
+    /// The cache of overload resolution results, or nullptr if lookups are not cached.
+    OverloadCache* cache = nullptr;
 
     /// @returns a MatchState from the context and arguments.
     /// @param templates the template state used for matcher evaluation
@@ -261,7 +342,7 @@ struct Table {
     /// @param types The type manager
     /// @param symbols The symbol table
     Table(core::type::Manager& types, SymbolTable& symbols)
-        : context{DIALECT::kData, types, symbols} {}
+        : context{DIALECT::kData, types, symbols, &cache} {}
 
     /// Lookup looks for the builtin overload with the given signature, raising an error diagnostic
     /// if the builtin was not found.
@@ -375,6 +456,9 @@ struct Table {
                               earliest_eval_stage);
     }
 
+    /// The cache of the table's lookups
+    OverloadCache cache;
+
     /// The intrinsic context
     Context context;
 };
@@ -0,0 +1,77 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/intrinsic/table.h"
+
+#include "benchmark/benchmark.h"
+#include "src/tint/lang/core/intrinsic/dialect.h"
+#include "src/tint/lang/core/type/manager.h"
+#include "src/tint/utils/symbol/symbol_table.h"
+
+namespace tint::core::intrinsic {
+namespace {
+
+/// Looks up the builtin functions, operators and constructors of a math-heavy shader, where each
+/// signature is looked up many times. If state.range(0) is non-zero, the lookups are cached.
+void LookupMathSignatures(benchmark::State& state) {
+    core::type::Manager types;
+    SymbolTable symbols{GenerationID::New()};
+    Table<Dialect> table{types, symbols};
+    if (state.range(0) == 0) {
+        table.context.cache = nullptr;
+    }
+
+    auto* f32 = types.f32();
+    auto* vec3f = types.vec3(f32);
+    auto* mat3x3f = types.mat3x3(f32);
+    auto stage = EvaluationStage::kRuntime;
+    for (auto _ : state) {
+        for (int i = 0; i < 100; i++) {
+            benchmark::DoNotOptimize(
+                table.Lookup(BuiltinFn::kDot, Empty, Vector{vec3f, vec3f}, stage));
+            benchmark::DoNotOptimize(
+                table.Lookup(BuiltinFn::kNormalize, Empty, Vector{vec3f}, stage));
+            benchmark::DoNotOptimize(
+                table.Lookup(BuiltinFn::kMix, Empty, Vector{vec3f, vec3f, f32}, stage));
+            benchmark::DoNotOptimize(
+                table.Lookup(BuiltinFn::kClamp, Empty, Vector{f32, f32, f32}, stage));
+            benchmark::DoNotOptimize(
+                table.Lookup(core::BinaryOp::kMultiply, mat3x3f, vec3f, stage, false));
+            benchmark::DoNotOptimize(
+                table.Lookup(core::BinaryOp::kMultiply, vec3f, f32, stage, false));
+            benchmark::DoNotOptimize(table.Lookup(core::BinaryOp::kAdd, vec3f, vec3f, stage, true));
+            benchmark::DoNotOptimize(table.Lookup(core::UnaryOp::kNegation, vec3f, stage));
+            benchmark::DoNotOptimize(
+                table.Lookup(CtorConv::kVec3, Empty, Vector{f32, f32, f32}, stage));
+        }
+    }
+}
+
+BENCHMARK(LookupMathSignatures)->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace tint::core::intrinsic
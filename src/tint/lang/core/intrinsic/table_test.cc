@@ -964,5 +964,63 @@ TEST_F(CoreIntrinsicTableTest, MemberFunctionDoesNotMatchNonMemberFunction) {
 )");
 }
 
+TEST_F(CoreIntrinsicTableTest, CacheMatch) {
+    auto* f32 = create<type::F32>();
+    auto first = table.Lookup(BuiltinFn::kCos, Empty, Vector{f32}, EvaluationStage::kConstant);
+    ASSERT_EQ(first, Success);
+    EXPECT_EQ(table.cache.Count(), 1u);
+
+    auto second = table.Lookup(BuiltinFn::kCos, Empty, Vector{f32}, EvaluationStage::kConstant);
+    ASSERT_EQ(second, Success);
+    EXPECT_EQ(table.cache.Count(), 1u);
+    EXPECT_EQ(first.Get(), second.Get());
+    EXPECT_EQ(first->const_eval_fn, second->const_eval_fn);
+
+    // Lookups at a different evaluation stage are cached separately.
+    auto runtime = table.Lookup(BuiltinFn::kCos, Empty, Vector{f32}, EvaluationStage::kRuntime);
+    ASSERT_EQ(runtime, Success);
+    EXPECT_EQ(table.cache.Count(), 2u);
+}
+
+TEST_F(CoreIntrinsicTableTest, CacheMismatch) {
+    auto* i32 = create<type::I32>();
+    auto first = table.Lookup(BuiltinFn::kCos, Empty, Vector{i32}, EvaluationStage::kConstant);
+    ASSERT_NE(first, Success);
+    EXPECT_EQ(table.cache.Count(), 1u);
+
+    auto second = table.Lookup(BuiltinFn::kCos, Empty, Vector{i32}, EvaluationStage::kConstant);
+    ASSERT_NE(second, Success);
+    EXPECT_EQ(table.cache.Count(), 1u);
+    EXPECT_EQ(first.Failure().Plain(), second.Failure().Plain());
+}
+
+TEST_F(CoreIntrinsicTableTest, CacheCompoundBinaryOp) {
+    // Compound and non-compound operators share the overloads, but not the failure message.
+    auto* bool_ = create<type::Bool>();
+    auto op = table.Lookup(BinaryOp::kAdd, bool_, bool_, EvaluationStage::kConstant, false);
+    auto compound = table.Lookup(BinaryOp::kAdd, bool_, bool_, EvaluationStage::kConstant, true);
+    ASSERT_NE(op, Success);
+    ASSERT_NE(compound, Success);
+    EXPECT_EQ(table.cache.Count(), 2u);
+    EXPECT_THAT(op.Failure().Plain(), HasSubstr("operator + (bool, bool)"));
+    EXPECT_THAT(compound.Failure().Plain(), HasSubstr("operator += (bool, bool)"));
+}
+
+TEST_F(CoreIntrinsicTableTest, CacheMatchesUncached) {
+    auto* f32 = create<type::F32>();
+    auto* vec3f = create<type::Vector>(f32, 3u);
+    Context uncached{Dialect::kData, Types(), Symbols()};
+    for (int i = 0; i < 2; i++) {
+        auto cached = table.Lookup(BuiltinFn::kMix, Empty, Vector{vec3f, vec3f, f32},
+                                   EvaluationStage::kRuntime);
+        auto expected = LookupFn(uncached, "mix", static_cast<size_t>(BuiltinFn::kMix), Empty,
+                                 Vector{vec3f, vec3f, f32}, EvaluationStage::kRuntime);
+        ASSERT_EQ(cached, Success);
+        ASSERT_EQ(expected, Success);
+        EXPECT_EQ(cached.Get(), expected.Get());
+    }
+    EXPECT_EQ(table.cache.Count(), 1u);
+}
+
 }  // namespace
 }  // namespace tint::core::intrinsic
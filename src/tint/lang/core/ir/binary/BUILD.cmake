@@ -34,6 +34,8 @@
 #                       Do not modify this file directly
 ################################################################################
 
+include(lang/core/ir/binary/flat/BUILD.cmake)
+
 if(TINT_BUILD_IR_BINARY)
 ################################################################################
 # Target:    tint_lang_core_ir_binary
@@ -92,6 +94,7 @@ tint_target_add_dependencies(tint_lang_core_ir_binary_test test
   tint_lang_core_constant
   tint_lang_core_intrinsic
   tint_lang_core_ir
+  tint_lang_core_ir_binary_flat
   tint_lang_core_ir_test
   tint_lang_core_type
   tint_utils_containers
@@ -33,6 +33,7 @@
 #include "src/tint/lang/core/builtin_fn.h"
 #include "src/tint/lang/core/builtin_value.h"
 #include "src/tint/lang/core/constant/composite.h"
+#include "src/tint/lang/core/constant/dense_composite.h"
 #include "src/tint/lang/core/constant/scalar.h"
 #include "src/tint/lang/core/constant/splat.h"
 #include "src/tint/lang/core/ir/access.h"
@@ -598,6 +599,9 @@ struct Encoder {
                 [&](const core::constant::Splat* splat) {
                     ConstantValueSplat(*constant_out.mutable_splat(), splat);
                 },
+                [&](const core::constant::DenseComposite* composite) {
+                    ConstantValueDenseComposite(*constant_out.mutable_composite(), composite);
+                },
                 TINT_ICE_ON_NO_MATCH);
 
             mod_out_.mutable_constant_values()->Add(std::move(constant_out));
@@ -613,6 +617,16 @@ struct Encoder {
         }
     }
 
+    void ConstantValueDenseComposite(pb::ConstantValueComposite& composite_out,
+                                     const core::constant::DenseComposite* composite_in) {
+        // Dense composites are encoded as regular composites. The decoder rebuilds them with
+        // constant::Manager::Composite(), which returns a DenseComposite again.
+        composite_out.set_type(Type(composite_in->type));
+        for (size_t i = 0; i < composite_in->NumElements(); i++) {
+            composite_out.add_elements(ConstantValue(composite_in->Index(i)));
+        }
+    }
+
     void ConstantValueSplat(pb::ConstantValueSplat& splat_out,
                             const core::constant::Splat* splat_in) {
         splat_out.set_type(Type(splat_in->type));
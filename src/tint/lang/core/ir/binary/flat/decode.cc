@@ -0,0 +1,997 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/binary/flat/decode.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "src/tint/lang/core/ir/binary/flat/format.h"
+#include "src/tint/lang/core/ir/builder.h"
+#include "src/tint/lang/core/ir/control_instruction.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/type/depth_multisampled_texture.h"
+#include "src/tint/lang/core/type/depth_texture.h"
+#include "src/tint/lang/core/type/external_texture.h"
+#include "src/tint/lang/core/type/input_attachment.h"
+#include "src/tint/lang/core/type/invalid.h"
+#include "src/tint/lang/core/type/multisampled_texture.h"
+#include "src/tint/lang/core/type/sampled_texture.h"
+#include "src/tint/lang/core/type/storage_texture.h"
+#include "src/tint/lang/core/type/vector.h"
+#include "src/tint/utils/containers/hashset.h"
+#include "src/tint/utils/diagnostic/diagnostic.h"
+#include "src/tint/utils/macros/compiler.h"
+#include "src/tint/utils/result/result.h"
+#include "src/tint/utils/text/string.h"
+#include "src/tint/utils/text/text_style.h"
+
+using namespace tint::core::fluent_types;  // NOLINT
+
+namespace tint::core::ir::binary::flat {
+namespace {
+
+struct Decoder {
+    ByteReader in_;
+
+    Module mod_out_{};
+    Vector<std::string_view, 32> strings_{};
+    Vector<ir::Block*, 32> blocks_{};
+    Vector<const type::Type*, 32> types_{};
+    Vector<const core::constant::Value*, 32> constant_values_{};
+    Vector<ir::Value*, 32> values_{};
+    Builder b{mod_out_};
+
+    Vector<ir::ExitIf*, 32> exit_ifs_{};
+    Vector<ir::ExitSwitch*, 32> exit_switches_{};
+    Vector<ir::ExitLoop*, 32> exit_loops_{};
+    Vector<ir::NextIteration*, 32> next_iterations_{};
+    Vector<ir::BreakIf*, 32> break_ifs_{};
+    Vector<ir::Continue*, 32> continues_{};
+
+    diag::List diags_{};
+    Hashset<std::string_view, 4> struct_names_{};
+
+    Result<Module> Decode() {
+        auto magic = in_.Bytes(sizeof(kMagic));
+        if (in_.failed || memcmp(magic.data(), kMagic, sizeof(kMagic)) != 0) {
+            return Failure{"not a flat encoded IR module"};
+        }
+        if (auto version = in_.U32LE(); version != kVersion) {
+            return Failure{"unsupported flat IR version " + std::to_string(version)};
+        }
+        if (in_.U32LE() != EnumFingerprint()) {
+            return Failure{"flat IR module was encoded with a different set of core enums"};
+        }
+
+        {
+            const size_t n = Count();
+            strings_.Reserve(n);
+            for (size_t i = 0; i < n && !in_.failed; i++) {
+                strings_.Push(in_.Bytes(in_.VarUint()));
+            }
+        }
+        {
+            const size_t n = Count();
+            types_.Reserve(n);
+            for (size_t i = 0; i < n && !in_.failed; i++) {
+                types_.Push(CreateType());
+            }
+        }
+        {
+            const size_t n = Count();
+            constant_values_.Reserve(n);
+            for (size_t i = 0; i < n && !in_.failed; i++) {
+                constant_values_.Push(CreateConstantValue());
+            }
+        }
+        {
+            const size_t n = Count();
+            mod_out_.functions.Reserve(n);
+            for (size_t i = 0; i < n; i++) {
+                mod_out_.functions.Push(mod_out_.allocators.values.Create<ir::Function>());
+            }
+        }
+        {
+            const size_t n = Count();
+            Vector<uint8_t, 32> flags;
+            flags.Reserve(n);
+            for (size_t i = 0; i < n; i++) {
+                flags.Push(in_.U8());
+            }
+            const uint32_t root_block = in_.VarUint();
+            if (TINT_UNLIKELY(!in_.failed && root_block >= n)) {
+                Error() << "root block id " << root_block << " out of range";
+                return Failure{std::move(diags_)};
+            }
+            blocks_.Reserve(n);
+            for (size_t i = 0; i < n; i++) {
+                if (i == root_block) {
+                    blocks_.Push(mod_out_.root_block);
+                } else {
+                    blocks_.Push((flags[i] & kBlockMultiIn) ? b.MultiInBlock() : b.Block());
+                }
+            }
+        }
+        {
+            const size_t n = Count();
+            values_.Reserve(n);
+            for (size_t i = 0; i < n && !in_.failed; i++) {
+                values_.Push(CreateValue());
+            }
+        }
+        for (size_t i = 0, n = mod_out_.functions.Length(); i < n && !in_.failed; i++) {
+            PopulateFunction(mod_out_.functions[i]);
+        }
+        for (size_t i = 0, n = blocks_.Length(); i < n && !in_.failed; i++) {
+            PopulateBlock(blocks_[i]);
+        }
+
+        if (in_.failed) {
+            Error() << "flat IR module is truncated or malformed";
+        } else if (in_.Remaining() != 0) {
+            Error() << "flat IR module has " << in_.Remaining() << " unexpected trailing bytes";
+        }
+
+        if (diags_.ContainsErrors()) {
+            // Note: Its not safe to call InferControlInstruction() with a broken IR.
+            return Failure{std::move(diags_)};
+        }
+
+        if (CheckBlocks()) {
+            for (auto* exit : exit_ifs_) {
+                InferControlInstruction(exit, &ExitIf::SetIf);
+            }
+            for (auto* exit : exit_switches_) {
+                InferControlInstruction(exit, &ExitSwitch::SetSwitch);
+            }
+            for (auto* exit : exit_loops_) {
+                InferControlInstruction(exit, &ExitLoop::SetLoop);
+            }
+            for (auto* break_ifs : break_ifs_) {
+                InferControlInstruction(break_ifs, &BreakIf::SetLoop);
+            }
+            for (auto* next_iters : next_iterations_) {
+                InferControlInstruction(next_iters, &NextIteration::SetLoop);
+            }
+            for (auto* cont : continues_) {
+                InferControlInstruction(cont, &Continue::SetLoop);
+            }
+        }
+
+        if (diags_.ContainsErrors()) {
+            return Failure{std::move(diags_)};
+        }
+        return std::move(mod_out_);
+    }
+
+    /// Adds a new error to the diagnostics and returns a reference to it
+    diag::Diagnostic& Error() { return diags_.AddError(Source{}); }
+
+    /// Reads an element count. Every encoded element takes at least one byte, so a count larger
+    /// than the number of remaining bytes is treated as malformed, before any memory is reserved.
+    /// @returns the element count
+    size_t Count() {
+        uint32_t count = in_.VarUint();
+        if (TINT_UNLIKELY(count > in_.Remaining())) {
+            in_.failed = true;
+            return 0;
+        }
+        return count;
+    }
+
+    /// Errors if @p number is not finite.
+    /// @returns @p number if finite, otherwise 0.
+    template <typename T>
+    Number<T> CheckFinite(Number<T> number) {
+        if (TINT_UNLIKELY(!std::isfinite(number.value))) {
+            Error() << "value must be finite";
+            return Number<T>{};
+        }
+        return number;
+    }
+
+    /// @returns true if all blocks are reachable, acyclic nesting depth is less than or equal to
+    /// kMaxBlockDepth.
+    bool CheckBlocks() {
+        const size_t kMaxBlockDepth = 128;
+        Vector<std::pair<const ir::Block*, size_t>, 32> pending;
+        pending.Push(std::make_pair(mod_out_.root_block, 0));
+        for (auto& fn : mod_out_.functions) {
+            pending.Push(std::make_pair(fn->Block(), 0));
+        }
+        Hashset<const ir::Block*, 32> seen;
+        while (!pending.IsEmpty()) {
+            const auto block_depth = pending.Pop();
+            const auto* block = block_depth.first;
+            const size_t depth = block_depth.second;
+            if (!seen.Add(block)) {
+                Error() << "cyclic nesting of blocks";
+                return false;
+            }
+            if (depth > kMaxBlockDepth) {
+                Error() << "block nesting exceeds " << kMaxBlockDepth;
+                return false;
+            }
+            for (auto* inst = block->Instructions(); inst; inst = inst->next) {
+                if (auto* ctrl = inst->As<ir::ControlInstruction>()) {
+                    ctrl->ForeachBlock([&](const ir::Block* child) {
+                        pending.Push(std::make_pair(child, depth + 1));
+                    });
+                }
+            }
+        }
+
+        for (auto* block : blocks_) {
+            if (!seen.Contains(block)) {
+                Error() << "unreachable block";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename EXIT, typename CTRL_INST>
+    void InferControlInstruction(EXIT* exit, void (EXIT::*set)(CTRL_INST*)) {
+        for (auto* block = exit->Block(); block;) {
+            auto* parent = block->Parent();
+            if (!parent) {
+                break;
+            }
+            if (auto* ctrl_inst = parent->template As<CTRL_INST>()) {
+                (exit->*set)(ctrl_inst);
+                break;
+            }
+            block = parent->Block();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Strings
+    ////////////////////////////////////////////////////////////////////////////
+    std::string_view String() {
+        auto id = in_.VarUint();
+        if (TINT_UNLIKELY(id > strings_.Length())) {
+            Error() << "string id " << id << " out of range";
+            return {};
+        }
+        return id > 0 ? strings_[id - 1] : std::string_view{};
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    void PopulateFunction(ir::Function* fn_out) {
+        if (auto name = String(); !name.empty()) {
+            mod_out_.SetName(fn_out, name);
+        }
+        fn_out->SetReturnType(Type(in_.VarUint()));
+        fn_out->SetStage(Enum(Function::PipelineStage::kUndefined, Function::PipelineStage::kVertex));
+        auto flags = in_.U8();
+        if (flags & kFunctionWorkgroupSize) {
+            auto x = in_.VarUint();
+            auto y = in_.VarUint();
+            auto z = in_.VarUint();
+            fn_out->SetWorkgroupSize(x, y, z);
+        }
+
+        Vector<FunctionParam*, 8> params_out;
+        for (size_t i = 0, n = Count(); i < n; i++) {
+            auto* param_out = ValueAs<FunctionParam>(in_.VarUint());
+            if (TINT_LIKELY(param_out)) {
+                params_out.Push(param_out);
+            }
+        }
+        if (flags & kFunctionReturnLocation) {
+            fn_out->SetReturnLocation(Location());
+        }
+        if (flags & kFunctionReturnBuiltin) {
+            fn_out->SetReturnBuiltin(BuiltinValue());
+        }
+        if (flags & kFunctionReturnInvariant) {
+            fn_out->SetReturnInvariant(true);
+        }
+        fn_out->SetParams(std::move(params_out));
+        fn_out->SetBlock(Block(in_.VarUint()));
+    }
+
+    ir::Function* Function(uint32_t id) {
+        if (TINT_UNLIKELY(id >= mod_out_.functions.Length())) {
+            Error() << "function id " << id << " out of range";
+            return nullptr;
+        }
+        return mod_out_.functions[id];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Blocks
+    ////////////////////////////////////////////////////////////////////////////
+    void PopulateBlock(ir::Block* block_out) {
+        if (auto* mib = block_out->As<ir::MultiInBlock>()) {
+            Vector<ir::BlockParam*, 8> params;
+            for (size_t i = 0, n = Count(); i < n; i++) {
+                auto* param_out = ValueAs<BlockParam>(in_.VarUint());
+                if (TINT_LIKELY(param_out)) {
+                    params.Push(param_out);
+                }
+            }
+            mib->SetParams(std::move(params));
+        }
+        for (size_t i = 0, n = Count(); i < n && !in_.failed; i++) {
+            block_out->Append(Instruction());
+        }
+    }
+
+    ir::Block* Block(uint32_t id) {
+        if (TINT_UNLIKELY(id >= blocks_.Length())) {
+            Error() << "block id " << id << " out of range";
+            return b.Block();
+        }
+        return blocks_[id];
+    }
+
+    template <typename T>
+    T* BlockAs(uint32_t id) {
+        auto* block = Block(id);
+        if (auto cast = As<T>(block); TINT_LIKELY(cast)) {
+            return cast;
+        }
+        Error() << "block " << id << " is " << (block ? block->TypeInfo().name : "<null>")
+                << " expected " << TypeInfo::Of<T>().name;
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Instructions
+    ////////////////////////////////////////////////////////////////////////////
+    ir::Instruction* Instruction() {
+        ir::Instruction* inst_out = nullptr;
+        uint32_t num_next_iter_values = 0;
+        auto kind = in_.U8();
+        switch (static_cast<InstructionKind>(kind)) {
+            case InstructionKind::kAccess:
+                inst_out = Create<ir::Access>();
+                break;
+            case InstructionKind::kBinary: {
+                auto* binary_out = Create<ir::CoreBinary>();
+                binary_out->SetOp(Enum(core::BinaryOp::kAnd, core::BinaryOp::kModulo));
+                inst_out = binary_out;
+                break;
+            }
+            case InstructionKind::kBitcast:
+                inst_out = Create<ir::Bitcast>();
+                break;
+            case InstructionKind::kBreakIf:
+                num_next_iter_values = in_.VarUint();
+                inst_out = Create<ir::BreakIf>(break_ifs_);
+                break;
+            case InstructionKind::kBuiltinCall: {
+                auto* call_out = Create<ir::CoreBuiltinCall>();
+                auto last = static_cast<core::BuiltinFn>(uint8_t(core::BuiltinFn::kNone) - 1);
+                call_out->SetFunc(Enum(core::BuiltinFn::kAbs, last));
+                inst_out = call_out;
+                break;
+            }
+            case InstructionKind::kConstruct:
+                inst_out = Create<ir::Construct>();
+                break;
+            case InstructionKind::kContinue:
+                inst_out = Create<ir::Continue>(continues_);
+                break;
+            case InstructionKind::kConvert:
+                inst_out = Create<ir::Convert>();
+                break;
+            case InstructionKind::kDiscard:
+                inst_out = Create<ir::Discard>();
+                break;
+            case InstructionKind::kExitIf:
+                inst_out = Create<ir::ExitIf>(exit_ifs_);
+                break;
+            case InstructionKind::kExitLoop:
+                inst_out = Create<ir::ExitLoop>(exit_loops_);
+                break;
+            case InstructionKind::kExitSwitch:
+                inst_out = Create<ir::ExitSwitch>(exit_switches_);
+                break;
+            case InstructionKind::kIf:
+                inst_out = CreateInstructionIf();
+                break;
+            case InstructionKind::kLet:
+                inst_out = Create<ir::Let>();
+                break;
+            case InstructionKind::kLoad:
+                inst_out = Create<ir::Load>();
+                break;
+            case InstructionKind::kLoadVectorElement:
+                inst_out = Create<ir::LoadVectorElement>();
+                break;
+            case InstructionKind::kLoop:
+                inst_out = CreateInstructionLoop();
+                break;
+            case InstructionKind::kNextIteration:
+                inst_out = Create<ir::NextIteration>(next_iterations_);
+                break;
+            case InstructionKind::kReturn:
+                inst_out = Create<ir::Return>();
+                break;
+            case InstructionKind::kStore:
+                inst_out = Create<ir::Store>();
+                break;
+            case InstructionKind::kStoreVectorElement:
+                inst_out = Create<ir::StoreVectorElement>();
+                break;
+            case InstructionKind::kSwitch:
+                inst_out = CreateInstructionSwitch();
+                break;
+            case InstructionKind::kSwizzle: {
+                auto* swizzle_out = Create<ir::Swizzle>();
+                Vector<uint32_t, 4> indices;
+                for (size_t i = 0, n = Count(); i < n; i++) {
+                    indices.Push(in_.VarUint());
+                }
+                swizzle_out->SetIndices(indices);
+                inst_out = swizzle_out;
+                break;
+            }
+            case InstructionKind::kUnary: {
+                auto* unary_out = Create<ir::CoreUnary>();
+                unary_out->SetOp(Enum(core::UnaryOp::kAddressOf, core::UnaryOp::kNot));
+                inst_out = unary_out;
+                break;
+            }
+            case InstructionKind::kUserCall:
+                inst_out = Create<ir::UserCall>();
+                break;
+            case InstructionKind::kVar:
+                inst_out = CreateInstructionVar();
+                break;
+            case InstructionKind::kUnreachable:
+                inst_out = b.Unreachable();
+                break;
+        }
+        if (!inst_out) {
+            Error() << "invalid instruction kind: " << std::to_string(kind);
+            in_.failed = true;
+            return b.Let(mod_out_.Types().invalid());
+        }
+
+        Vector<ir::Value*, 4> operands;
+        for (size_t i = 0, n = Count(); i < n; i++) {
+            operands.Push(Value(in_.VarUint()));
+        }
+        inst_out->SetOperands(std::move(operands));
+
+        Vector<ir::InstructionResult*, 4> results;
+        for (size_t i = 0, n = Count(); i < n; i++) {
+            results.Push(ValueAs<ir::InstructionResult>(in_.VarUint()));
+        }
+        inst_out->SetResults(std::move(results));
+
+        if (auto* break_if = inst_out->As<BreakIf>()) {
+            bool is_valid =
+                break_if->Operands().Length() >= num_next_iter_values + BreakIf::kArgsOperandOffset;
+            if (TINT_LIKELY(is_valid)) {
+                break_if->SetNumNextIterValues(num_next_iter_values);
+            } else {
+                Error() << "invalid value for num_next_iter_values()";
+            }
+        }
+
+        return inst_out;
+    }
+
+    /// @returns a new instruction of type T
+    template <typename T>
+    T* Create() {
+        return mod_out_.allocators.instructions.Create<T>();
+    }
+
+    /// @returns a new instruction of type T, which is also appended to @p list
+    template <typename T, size_t N>
+    T* Create(Vector<T*, N>& list) {
+        auto* inst_out = Create<T>();
+        list.Push(inst_out);
+        return inst_out;
+    }
+
+    ir::If* CreateInstructionIf() {
+        auto true_block = in_.VarUint();
+        auto false_block = in_.VarUint();
+        auto* if_out = Create<ir::If>();
+        if_out->SetTrue(true_block > 0 ? Block(true_block - 1) : b.Block());
+        if_out->SetFalse(false_block > 0 ? Block(false_block - 1) : b.Block());
+        return if_out;
+    }
+
+    ir::Loop* CreateInstructionLoop() {
+        auto initializer = in_.VarUint();
+        auto body = in_.VarUint();
+        auto continuing = in_.VarUint();
+        auto* loop_out = Create<ir::Loop>();
+        loop_out->SetInitializer(initializer > 0 ? Block(initializer - 1) : b.Block());
+        loop_out->SetBody(BlockAs<ir::MultiInBlock>(body));
+        loop_out->SetContinuing(continuing > 0 ? BlockAs<ir::MultiInBlock>(continuing - 1)
+                                               : b.MultiInBlock());
+        return loop_out;
+    }
+
+    ir::Switch* CreateInstructionSwitch() {
+        auto* switch_out = Create<ir::Switch>();
+        for (size_t i = 0, n = Count(); i < n && !in_.failed; i++) {
+            ir::Switch::Case case_out{};
+            case_out.block = Block(in_.VarUint());
+            case_out.block->SetParent(switch_out);
+            bool is_default = in_.U8() != 0;
+            for (size_t j = 0, num_selectors = Count(); j < num_selectors; j++) {
+                ir::Switch::CaseSelector selector_out{};
+                selector_out.val = b.Constant(ConstantValue(in_.VarUint()));
+                case_out.selectors.Push(std::move(selector_out));
+            }
+            if (is_default) {
+                ir::Switch::CaseSelector selector_out{};
+                case_out.selectors.Push(std::move(selector_out));
+            }
+            switch_out->Cases().Push(std::move(case_out));
+        }
+        return switch_out;
+    }
+
+    ir::Var* CreateInstructionVar() {
+        auto* var_out = Create<ir::Var>();
+        auto flags = in_.U8();
+        if (flags & kVarBindingPoint) {
+            auto group = in_.VarUint();
+            auto binding = in_.VarUint();
+            var_out->SetBindingPoint(group, binding);
+        }
+        if (flags & kVarInputAttachmentIndex) {
+            var_out->SetInputAttachmentIndex(in_.VarUint());
+        }
+        return var_out;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    const type::Type* CreateType() {
+        auto kind = in_.U8();
+        auto& ty = mod_out_.Types();
+        switch (static_cast<TypeKind>(kind)) {
+            case TypeKind::kVoid:
+                return ty.Get<void>();
+            case TypeKind::kBool:
+                return ty.Get<bool>();
+            case TypeKind::kI32:
+                return ty.Get<i32>();
+            case TypeKind::kU32:
+                return ty.Get<u32>();
+            case TypeKind::kF32:
+                return ty.Get<f32>();
+            case TypeKind::kF16:
+                return ty.Get<f16>();
+            case TypeKind::kVector: {
+                const auto width = in_.VarUint();
+                auto* el_ty = Type(in_.VarUint());
+                if (TINT_UNLIKELY(width < 2 || width > 4)) {
+                    Error() << "invalid vector width";
+                    return ty.invalid();
+                }
+                return ty.vec(el_ty, width);
+            }
+            case TypeKind::kMatrix: {
+                const auto cols = in_.VarUint();
+                const auto rows = in_.VarUint();
+                auto* el_ty = Type(in_.VarUint());
+                if (TINT_UNLIKELY(rows < 2 || rows > 4 || cols < 2 || cols > 4)) {
+                    Error() << "invalid matrix dimensions";
+                    return ty.invalid();
+                }
+                return ty.mat(ty.vec(el_ty, rows), cols);
+            }
+            case TypeKind::kPointer: {
+                auto address_space = AddressSpace();
+                auto* store_ty = Type(in_.VarUint());
+                auto access = Access();
+                return ty.ptr(address_space, store_ty, access);
+            }
+            case TypeKind::kStruct:
+                return CreateTypeStruct();
+            case TypeKind::kAtomic:
+                return ty.atomic(Type(in_.VarUint()));
+            case TypeKind::kArray:
+                return CreateTypeArray();
+            case TypeKind::kDepthTexture: {
+                auto dimension = TextureDimension();
+                if (!type::DepthTexture::IsValidDimension(dimension)) {
+                    Error() << "invalid DepthTexture dimension";
+                    return ty.invalid();
+                }
+                return ty.Get<type::DepthTexture>(dimension);
+            }
+            case TypeKind::kSampledTexture: {
+                auto dimension = TextureDimension();
+                auto* sub_type = Type(in_.VarUint());
+                return ty.Get<type::SampledTexture>(dimension, sub_type);
+            }
+            case TypeKind::kMultisampledTexture: {
+                auto dimension = TextureDimension();
+                auto* sub_type = Type(in_.VarUint());
+                return ty.Get<type::MultisampledTexture>(dimension, sub_type);
+            }
+            case TypeKind::kDepthMultisampledTexture: {
+                auto dimension = TextureDimension();
+                if (!type::DepthMultisampledTexture::IsValidDimension(dimension)) {
+                    Error() << "invalid DepthMultisampledTexture dimension";
+                    return ty.invalid();
+                }
+                return ty.Get<type::DepthMultisampledTexture>(dimension);
+            }
+            case TypeKind::kStorageTexture: {
+                auto dimension = TextureDimension();
+                auto texel_format =
+                    Enum(core::TexelFormat::kBgra8Unorm, core::TexelFormat::kRgba8Unorm);
+                auto access = Access();
+                return ty.Get<type::StorageTexture>(
+                    dimension, texel_format, access,
+                    type::StorageTexture::SubtypeFor(texel_format, ty));
+            }
+            case TypeKind::kExternalTexture:
+                return ty.Get<type::ExternalTexture>();
+            case TypeKind::kSampler:
+                return ty.Get<type::Sampler>(Enum(core::type::SamplerKind::kSampler,
+                                                  core::type::SamplerKind::kComparisonSampler));
+            case TypeKind::kInputAttachment:
+                return ty.Get<type::InputAttachment>(Type(in_.VarUint()));
+        }
+
+        Error() << "invalid type kind: " << std::to_string(kind);
+        in_.failed = true;
+        return ty.invalid();
+    }
+
+    const type::Type* CreateTypeStruct() {
+        auto struct_name = String();
+        if (TINT_UNLIKELY(struct_name.empty())) {
+            Error() << "struct must have a name";
+            in_.failed = true;
+            return mod_out_.Types().invalid();
+        }
+        if (!struct_names_.Add(struct_name)) {
+            Error() << "duplicate struct name: " << style::Type(struct_name);
+            in_.failed = true;
+            return mod_out_.Types().invalid();
+        }
+
+        Vector<const core::type::StructMember*, 8> members_out;
+        uint32_t offset = 0;
+        for (size_t i = 0, n = Count(); i < n && !in_.failed; i++) {
+            auto member_name = String();
+            if (TINT_UNLIKELY(member_name.empty())) {
+                Error() << "struct member must have a name";
+                in_.failed = true;
+                return mod_out_.Types().invalid();
+            }
+            auto symbol = mod_out_.symbols.Register(member_name);
+            auto* type = Type(in_.VarUint());
+            auto index = static_cast<uint32_t>(members_out.Length());
+            auto size = in_.VarUint();
+            auto align = in_.VarUint();
+            if (TINT_UNLIKELY(align == 0)) {
+                Error() << "struct member must have non-zero alignment";
+                align = 1;
+            }
+            if (TINT_UNLIKELY(size == 0)) {
+                Error() << "struct member must have non-zero size";
+                size = 1;
+            }
+            core::type::StructMemberAttributes attributes_out{};
+            auto flags = in_.U8();
+            if (flags & kMemberLocation) {
+                attributes_out.location = in_.VarUint();
+            }
+            if (flags & kMemberBlendSrc) {
+                attributes_out.blend_src = in_.VarUint();
+            }
+            if (flags & kMemberColor) {
+                attributes_out.color = in_.VarUint();
+            }
+            if (flags & kMemberBuiltin) {
+                attributes_out.builtin = BuiltinValue();
+            }
+            if (flags & kMemberInterpolation) {
+                attributes_out.interpolation = Interpolation();
+            }
+            attributes_out.invariant = (flags & kMemberInvariant) != 0;
+            offset = RoundUp(align, offset);
+            auto* member_out = mod_out_.Types().Get<core::type::StructMember>(
+                symbol, type, index, offset, align, size, std::move(attributes_out));
+            offset += size;
+            members_out.Push(member_out);
+        }
+        if (TINT_UNLIKELY(members_out.IsEmpty())) {
+            Error() << "struct requires at least one member";
+            return mod_out_.Types().invalid();
+        }
+        auto name = mod_out_.symbols.Register(struct_name);
+        return mod_out_.Types().Struct(name, std::move(members_out));
+    }
+
+    const type::Type* CreateTypeArray() {
+        auto* element = Type(in_.VarUint());
+        uint32_t stride = in_.VarUint();
+        uint32_t count = in_.VarUint();
+        if (element->Align() == 0 || element->Size() == 0) {
+            Error() << "cannot create an array of an unsized type";
+            return mod_out_.Types().invalid();
+        }
+        uint32_t implicit_stride = tint::RoundUp(element->Align(), element->Size());
+        if (stride < implicit_stride) {
+            Error() << "array element stride is smaller than the implicit stride";
+            return mod_out_.Types().invalid();
+        }
+        return count > 0 ? mod_out_.Types().array(element, count, stride)
+                         : mod_out_.Types().runtime_array(element, stride);
+    }
+
+    const type::Type* Type(uint32_t id) {
+        if (TINT_UNLIKELY(id >= types_.Length())) {
+            Error() << "type id " << id << " out of range";
+            return mod_out_.Types().invalid();
+        }
+        return types_[id];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Values
+    ////////////////////////////////////////////////////////////////////////////
+    ir::Value* CreateValue() {
+        auto kind = in_.U8();
+        switch (static_cast<ValueKind>(kind)) {
+            case ValueKind::kInstructionResult: {
+                auto* res_out = b.InstructionResult(Type(in_.VarUint()));
+                if (auto name = String(); !name.empty()) {
+                    mod_out_.SetName(res_out, name);
+                }
+                return res_out;
+            }
+            case ValueKind::kFunctionParameter:
+                return FunctionParameter();
+            case ValueKind::kBlockParameter: {
+                auto* param_out = b.BlockParam(Type(in_.VarUint()));
+                if (auto name = String(); !name.empty()) {
+                    mod_out_.SetName(param_out, name);
+                }
+                return param_out;
+            }
+            case ValueKind::kFunction:
+                if (auto* fn = Function(in_.VarUint())) {
+                    return fn;
+                }
+                return b.InvalidConstant();
+            case ValueKind::kConstant:
+                return b.Constant(ConstantValue(in_.VarUint()));
+        }
+
+        Error() << "invalid value kind: " << std::to_string(kind);
+        in_.failed = true;
+        return b.InvalidConstant();
+    }
+
+    ir::FunctionParam* FunctionParameter() {
+        auto* param_out = b.FunctionParam(Type(in_.VarUint()));
+        if (auto name = String(); !name.empty()) {
+            mod_out_.SetName(param_out, name);
+        }
+        auto flags = in_.U8();
+        if (flags & kParamBindingPoint) {
+            auto group = in_.VarUint();
+            auto binding = in_.VarUint();
+            param_out->SetBindingPoint(group, binding);
+        }
+        if (flags & kParamLocation) {
+            param_out->SetLocation(Location());
+        }
+        if (flags & kParamBuiltin) {
+            param_out->SetBuiltin(BuiltinValue());
+        }
+        if (flags & kParamInvariant) {
+            param_out->SetInvariant(true);
+        }
+        return param_out;
+    }
+
+    ir::Value* Value(uint32_t id) {
+        if (TINT_UNLIKELY(id > values_.Length())) {
+            Error() << "value id " << id << " out of range";
+            return nullptr;
+        }
+        return id > 0 ? values_[id - 1] : nullptr;
+    }
+
+    template <typename T>
+    T* ValueAs(uint32_t id) {
+        auto* value = Value(id);
+        if (auto cast = As<T>(value); TINT_LIKELY(cast)) {
+            return cast;
+        }
+        Error() << "value " << id << " is " << (value ? value->TypeInfo().name : "<null>")
+                << " expected " << TypeInfo::Of<T>().name;
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // ConstantValues
+    ////////////////////////////////////////////////////////////////////////////
+    const core::constant::Value* CreateConstantValue() {
+        auto kind = in_.U8();
+        switch (static_cast<ConstantKind>(kind)) {
+            case ConstantKind::kBool:
+                return b.ConstantValue(in_.U8() != 0);
+            case ConstantKind::kI32:
+                return b.ConstantValue(i32(in_.VarInt()));
+            case ConstantKind::kU32:
+                return b.ConstantValue(u32(in_.VarUint()));
+            case ConstantKind::kF32:
+                return b.ConstantValue(CheckFinite(f32(in_.F32())));
+            case ConstantKind::kF16:
+                return b.ConstantValue(CheckFinite(f16(in_.F32())));
+            case ConstantKind::kComposite:
+                return CreateConstantComposite();
+            case ConstantKind::kSplat:
+                return CreateConstantSplat();
+        }
+        Error() << "invalid constant kind: " << std::to_string(kind);
+        in_.failed = true;
+        return b.InvalidConstant()->Value();
+    }
+
+    const core::constant::Value* CreateConstantComposite() {
+        auto* type = Type(in_.VarUint());
+        auto type_elements = type->Elements();
+        size_t num_values = Count();
+        Vector<const core::constant::Value*, 8> elements_out;
+        elements_out.Reserve(num_values);
+        for (size_t i = 0; i < num_values; i++) {
+            elements_out.Push(ConstantValue(in_.VarUint()));
+        }
+        if (TINT_UNLIKELY(type_elements.count == 0)) {
+            Error() << "cannot create a composite of type " << type->FriendlyName();
+            return b.InvalidConstant()->Value();
+        }
+        if (TINT_UNLIKELY(type_elements.count != num_values)) {
+            Error() << "constant composite type " << type->FriendlyName() << " expects "
+                    << type_elements.count << " elements, but " << num_values << " values encoded";
+            return b.InvalidConstant()->Value();
+        }
+        for (size_t i = 0; i < num_values; i++) {
+            auto* value = elements_out[i];
+            if (auto* el_type = type->Element(static_cast<uint32_t>(i));
+                TINT_UNLIKELY(value->Type() != el_type)) {
+                Error() << "constant composite element value type " << value->Type()->FriendlyName()
+                        << " does not match element type " << el_type->FriendlyName();
+                return b.InvalidConstant()->Value();
+            }
+        }
+        return mod_out_.constant_values.Composite(type, std::move(elements_out));
+    }
+
+    const core::constant::Value* CreateConstantSplat() {
+        auto* type = Type(in_.VarUint());
+        auto* value = ConstantValue(in_.VarUint());
+        uint32_t num_elements = type->Elements().count;
+        if (TINT_UNLIKELY(num_elements == 0)) {
+            Error() << "cannot create a splat of type " << type->FriendlyName();
+            return b.InvalidConstant()->Value();
+        }
+        for (uint32_t i = 0; i < num_elements; i++) {
+            auto* el_type = type->Element(i);
+            if (TINT_UNLIKELY(el_type != value->Type())) {
+                Error() << "constant splat element value type " << value->Type()->FriendlyName()
+                        << " does not match element " << i << " type " << el_type->FriendlyName();
+                return b.InvalidConstant()->Value();
+            }
+        }
+        return mod_out_.constant_values.Splat(type, value);
+    }
+
+    const core::constant::Value* ConstantValue(uint32_t id) {
+        if (TINT_UNLIKELY(id >= constant_values_.Length())) {
+            Error() << "constant value id " << id << " out of range";
+            return b.InvalidConstant()->Value();
+        }
+        return constant_values_[id];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Attributes
+    ////////////////////////////////////////////////////////////////////////////
+    ir::Location Location() {
+        core::ir::Location location_out{};
+        location_out.value = in_.VarUint();
+        if (in_.U8() != 0) {
+            location_out.interpolation = Interpolation();
+        }
+        return location_out;
+    }
+
+    core::Interpolation Interpolation() {
+        core::Interpolation interpolation_out{};
+        interpolation_out.type =
+            Enum(core::InterpolationType::kFlat, core::InterpolationType::kPerspective);
+        interpolation_out.sampling =
+            Enum(core::InterpolationSampling::kUndefined, core::InterpolationSampling::kSample);
+        return interpolation_out;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Enums
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// Reads an enum value, which must be in the inclusive range [@p first, @p last].
+    /// @returns the enum value, or @p first if the value is out of range.
+    template <typename ENUM>
+    ENUM Enum(ENUM first, ENUM last) {
+        auto value = in_.VarUint();
+        if (TINT_UNLIKELY(value < static_cast<uint32_t>(first) ||
+                          value > static_cast<uint32_t>(last))) {
+            Error() << "enum value " << value << " out of range";
+            return first;
+        }
+        return static_cast<ENUM>(value);
+    }
+
+    core::AddressSpace AddressSpace() {
+        return Enum(core::AddressSpace::kIn, core::AddressSpace::kWorkgroup);
+    }
+
+    core::Access Access() { return Enum(core::Access::kRead, core::Access::kWrite); }
+
+    core::BuiltinValue BuiltinValue() {
+        return Enum(core::BuiltinValue::kPointSize, core::BuiltinValue::kWorkgroupId);
+    }
+
+    core::type::TextureDimension TextureDimension() {
+        return Enum(core::type::TextureDimension::k1d, core::type::TextureDimension::kCubeArray);
+    }
+};
+
+}  // namespace
+
+bool IsFlat(Slice<const std::byte> encoded) {
+    return encoded.len >= sizeof(kMagic) && memcmp(encoded.data, kMagic, sizeof(kMagic)) == 0;
+}
+
+Result<Module> Decode(Slice<const std::byte> encoded) {
+    return Decoder{ByteReader{encoded.data, encoded.len}}.Decode();
+}
+
+}  // namespace tint::core::ir::binary::flat
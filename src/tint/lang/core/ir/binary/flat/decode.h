@@ -0,0 +1,58 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_IR_BINARY_FLAT_DECODE_H_
+#define SRC_TINT_LANG_CORE_IR_BINARY_FLAT_DECODE_H_
+
+#include <cstddef>
+
+#include "src/tint/utils/containers/slice.h"
+#include "src/tint/utils/result/result.h"
+
+// Forward declarations
+namespace tint::core::ir {
+class Module;
+}  // namespace tint::core::ir
+
+namespace tint::core::ir::binary::flat {
+
+/// @param encoded the encoded bytes
+/// @returns true if @p encoded starts with the header of the flat binary format, for any version.
+bool IsFlat(Slice<const std::byte> encoded);
+
+/// Decodes a module encoded with flat::Encode().
+/// The names of values are read directly from @p encoded, and @p encoded is not referenced by the
+/// returned module, so @p encoded can be a view of a memory-mapped file that is unmapped after
+/// decoding.
+/// @param encoded the encoded module
+/// @returns the decoded module, or a failure if @p encoded is malformed, or was encoded with a
+/// different version of the format
+Result<Module> Decode(Slice<const std::byte> encoded);
+
+}  // namespace tint::core::ir::binary::flat
+
+#endif  // SRC_TINT_LANG_CORE_IR_BINARY_FLAT_DECODE_H_
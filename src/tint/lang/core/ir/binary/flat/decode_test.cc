@@ -0,0 +1,205 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/binary/flat/decode.h"
+
+#include <string>
+
+#include "gmock/gmock.h"
+#include "src/tint/lang/core/ir/binary/flat/encode.h"
+#include "src/tint/lang/core/ir/binary/flat/format.h"
+#include "src/tint/lang/core/ir/disassembler.h"
+#include "src/tint/lang/core/ir/ir_helper_test.h"
+
+namespace tint::core::ir::binary::flat {
+namespace {
+
+using namespace tint::core::number_suffixes;  // NOLINT
+using namespace tint::core::fluent_types;     // NOLINT
+
+using ::testing::HasSubstr;
+
+class IRBinaryFlatTest : public IRTestHelper {
+  public:
+    /// Builds a module that uses most of the sections of the format.
+    void BuildModule() {
+        b.Append(b.ir.root_block, [&] { b.Var<private_, vec3<f32>>("v"); });
+
+        auto* x = b.FunctionParam<i32>("x");
+        auto* fn = b.Function("Function", ty.i32());
+        fn->SetParams({x});
+        b.Append(fn->Block(), [&] {
+            auto* loop = b.Loop();
+            b.Append(loop->Body(), [&] {
+                auto* sum = b.Add<i32>(x, 1_i);
+                b.Let("sum", sum);
+                b.ExitLoop(loop);
+            });
+            auto* switch_ = b.Switch(x);
+            b.Append(b.Case(switch_, {b.Constant(1_i)}), [&] { b.Return(fn, 1_i); });
+            b.Append(b.Case(switch_, {nullptr}), [&] { b.ExitSwitch(switch_); });
+            b.Let("c", b.Splat<vec4<f32>>(2_f));
+            b.Return(fn, 3_i);
+        });
+    }
+
+    /// @returns the module, encoded with flat::Encode()
+    Vector<std::byte, 0> EncodeModule() {
+        auto encoded = Encode(mod);
+        if (encoded != Success) {
+            ADD_FAILURE() << encoded.Failure();
+            return {};
+        }
+        return encoded.Get();
+    }
+};
+
+TEST_F(IRBinaryFlatTest, Roundtrip) {
+    BuildModule();
+    auto encoded = EncodeModule();
+    auto decoded = Decode(encoded.Slice());
+    ASSERT_EQ(decoded, Success) << decoded.Failure();
+    EXPECT_EQ(Disassembler(mod).Plain(), Disassembler(decoded.Get()).Plain());
+}
+
+TEST_F(IRBinaryFlatTest, DecodedModuleDoesNotReferenceEncodedBytes) {
+    BuildModule();
+    auto encoded = EncodeModule();
+    auto decoded = Decode(encoded.Slice());
+    ASSERT_EQ(decoded, Success) << decoded.Failure();
+    for (auto& byte : encoded) {
+        byte = std::byte{0};
+    }
+    EXPECT_EQ(Disassembler(mod).Plain(), Disassembler(decoded.Get()).Plain());
+}
+
+TEST_F(IRBinaryFlatTest, IsFlat) {
+    BuildModule();
+    auto encoded = EncodeModule();
+    EXPECT_TRUE(IsFlat(encoded.Slice()));
+
+    const std::byte short_header[] = {std::byte{'T'}, std::byte{'I'}, std::byte{'R'}};
+    EXPECT_FALSE(IsFlat(Slice<const std::byte>{short_header}));
+
+    encoded[0] = std::byte{'X'};
+    EXPECT_FALSE(IsFlat(encoded.Slice()));
+}
+
+TEST_F(IRBinaryFlatTest, Error_BadMagic) {
+    BuildModule();
+    auto encoded = EncodeModule();
+    encoded[1] = std::byte{'X'};
+    auto decoded = Decode(encoded.Slice());
+    ASSERT_NE(decoded, Success);
+    EXPECT_THAT(decoded.Failure().reason.Str(), HasSubstr("not a flat encoded IR module"));
+}
+
+TEST_F(IRBinaryFlatTest, Error_UnsupportedVersion) {
+    BuildModule();
+    auto encoded = EncodeModule();
+    encoded[4] = static_cast<std::byte>(kVersion + 1);
+    auto decoded = Decode(encoded.Slice());
+    ASSERT_NE(decoded, Success);
+    EXPECT_THAT(decoded.Failure().reason.Str(),
+                HasSubstr("unsupported flat IR version " + std::to_string(kVersion + 1)));
+}
+
+TEST_F(IRBinaryFlatTest, Error_EnumFingerprintMismatch) {
+    BuildModule();
+    auto encoded = EncodeModule();
+    encoded[8] ^= std::byte{0xff};
+    auto decoded = Decode(encoded.Slice());
+    ASSERT_NE(decoded, Success);
+    EXPECT_THAT(decoded.Failure().reason.Str(), HasSubstr("different set of core enums"));
+}
+
+TEST_F(IRBinaryFlatTest, Error_Truncated) {
+    BuildModule();
+    auto encoded = EncodeModule();
+    for (size_t len = 0; len < encoded.Length(); len++) {
+        auto decoded = Decode(Slice<const std::byte>{&encoded[0], len});
+        EXPECT_NE(decoded, Success) << "length: " << len;
+    }
+}
+
+TEST_F(IRBinaryFlatTest, Error_TrailingBytes) {
+    BuildModule();
+    auto encoded = EncodeModule();
+    encoded.Push(std::byte{0});
+    auto decoded = Decode(encoded.Slice());
+    ASSERT_NE(decoded, Success);
+    EXPECT_THAT(decoded.Failure().reason.Str(), HasSubstr("1 unexpected trailing bytes"));
+}
+
+TEST_F(IRBinaryFlatTest, Error_RootBlockOutOfRange) {
+    ByteWriter writer;
+    writer.Bytes(kMagic, sizeof(kMagic));
+    writer.U32LE(kVersion);
+    writer.U32LE(EnumFingerprint());
+    writer.VarUint(0);  // strings
+    writer.VarUint(0);  // types
+    writer.VarUint(0);  // constant values
+    writer.VarUint(0);  // functions
+    writer.VarUint(1);  // blocks
+    writer.U8(0);       // block flags
+    writer.VarUint(1);  // root block
+    writer.VarUint(0);  // values
+    writer.VarUint(0);  // block 0 instructions
+
+    auto decoded = Decode(writer.buffer.Slice());
+    ASSERT_NE(decoded, Success);
+    EXPECT_THAT(decoded.Failure().reason.Str(), HasSubstr("root block id 1 out of range"));
+}
+
+TEST_F(IRBinaryFlatTest, ByteReader_VarUintOverflow) {
+    const std::byte bytes[] = {std::byte{0xff}, std::byte{0xff}, std::byte{0xff},
+                               std::byte{0xff}, std::byte{0x1f}};
+    ByteReader reader{bytes, sizeof(bytes)};
+    reader.VarUint();
+    EXPECT_TRUE(reader.failed);
+}
+
+TEST_F(IRBinaryFlatTest, ByteWriterReader_Roundtrip) {
+    ByteWriter writer;
+    writer.U8(42);
+    writer.U32LE(0x12345678u);
+    writer.VarUint(0xffffffffu);
+    writer.VarInt(-5);
+    writer.F32(1.5f);
+
+    ByteReader reader{&writer.buffer[0], writer.buffer.Length()};
+    EXPECT_EQ(reader.U8(), 42u);
+    EXPECT_EQ(reader.U32LE(), 0x12345678u);
+    EXPECT_EQ(reader.VarUint(), 0xffffffffu);
+    EXPECT_EQ(reader.VarInt(), -5);
+    EXPECT_EQ(reader.F32(), 1.5f);
+    EXPECT_EQ(reader.Remaining(), 0u);
+    EXPECT_FALSE(reader.failed);
+}
+
+}  // namespace
+}  // namespace tint::core::ir::binary::flat
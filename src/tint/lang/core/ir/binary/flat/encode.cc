@@ -0,0 +1,742 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/binary/flat/encode.h"
+
+#include <string_view>
+#include <utility>
+
+#include "src/tint/lang/core/builtin_fn.h"
+#include "src/tint/lang/core/builtin_value.h"
+#include "src/tint/lang/core/constant/composite.h"
+#include "src/tint/lang/core/constant/dense_composite.h"
+#include "src/tint/lang/core/constant/scalar.h"
+#include "src/tint/lang/core/constant/splat.h"
+#include "src/tint/lang/core/ir/access.h"
+#include "src/tint/lang/core/ir/binary/flat/format.h"
+#include "src/tint/lang/core/ir/bitcast.h"
+#include "src/tint/lang/core/ir/break_if.h"
+#include "src/tint/lang/core/ir/construct.h"
+#include "src/tint/lang/core/ir/continue.h"
+#include "src/tint/lang/core/ir/convert.h"
+#include "src/tint/lang/core/ir/core_binary.h"
+#include "src/tint/lang/core/ir/core_builtin_call.h"
+#include "src/tint/lang/core/ir/core_unary.h"
+#include "src/tint/lang/core/ir/discard.h"
+#include "src/tint/lang/core/ir/exit_if.h"
+#include "src/tint/lang/core/ir/exit_loop.h"
+#include "src/tint/lang/core/ir/exit_switch.h"
+#include "src/tint/lang/core/ir/function_param.h"
+#include "src/tint/lang/core/ir/if.h"
+#include "src/tint/lang/core/ir/let.h"
+#include "src/tint/lang/core/ir/load.h"
+#include "src/tint/lang/core/ir/load_vector_element.h"
+#include "src/tint/lang/core/ir/loop.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/multi_in_block.h"
+#include "src/tint/lang/core/ir/next_iteration.h"
+#include "src/tint/lang/core/ir/return.h"
+#include "src/tint/lang/core/ir/store.h"
+#include "src/tint/lang/core/ir/store_vector_element.h"
+#include "src/tint/lang/core/ir/switch.h"
+#include "src/tint/lang/core/ir/swizzle.h"
+#include "src/tint/lang/core/ir/unreachable.h"
+#include "src/tint/lang/core/ir/user_call.h"
+#include "src/tint/lang/core/ir/var.h"
+#include "src/tint/lang/core/texel_format.h"
+#include "src/tint/lang/core/type/array.h"
+#include "src/tint/lang/core/type/bool.h"
+#include "src/tint/lang/core/type/depth_multisampled_texture.h"
+#include "src/tint/lang/core/type/depth_texture.h"
+#include "src/tint/lang/core/type/external_texture.h"
+#include "src/tint/lang/core/type/f16.h"
+#include "src/tint/lang/core/type/f32.h"
+#include "src/tint/lang/core/type/i32.h"
+#include "src/tint/lang/core/type/input_attachment.h"
+#include "src/tint/lang/core/type/matrix.h"
+#include "src/tint/lang/core/type/multisampled_texture.h"
+#include "src/tint/lang/core/type/pointer.h"
+#include "src/tint/lang/core/type/sampled_texture.h"
+#include "src/tint/lang/core/type/sampler.h"
+#include "src/tint/lang/core/type/storage_texture.h"
+#include "src/tint/lang/core/type/u32.h"
+#include "src/tint/lang/core/type/void.h"
+#include "src/tint/utils/macros/compiler.h"
+#include "src/tint/utils/rtti/switch.h"
+
+namespace tint::core::ir::binary::flat {
+namespace {
+
+struct Encoder {
+    const Module& mod_in_;
+
+    ByteWriter strings_{};
+    ByteWriter types_out_{};
+    ByteWriter constants_out_{};
+    ByteWriter block_flags_{};
+    ByteWriter values_out_{};
+    ByteWriter bodies_{};
+
+    Hashmap<std::string_view, uint32_t, 32> strings_ids_{};
+    Hashmap<const core::ir::Function*, uint32_t, 32> functions_{};
+    Hashmap<const core::ir::Block*, uint32_t, 32> blocks_{};
+    Hashmap<const core::type::Type*, uint32_t, 32> types_{};
+    Hashmap<const core::ir::Value*, uint32_t, 32> values_{};
+    Hashmap<const core::constant::Value*, uint32_t, 32> constant_values_{};
+
+    /// Blocks in id order. Block bodies are encoded after all the functions.
+    Vector<const ir::Block*, 32> block_list_{};
+
+    Vector<std::byte, 0> Encode() {
+        // Encode all user-declared structures first. This is to ensure that the IR disassembly
+        // (which prints structure types first) does not reorder after encoding and decoding.
+        for (auto* ty : mod_in_.Types()) {
+            if (auto* str = ty->As<core::type::Struct>()) {
+                Type(str);
+            }
+        }
+        for (auto& fn_in : mod_in_.functions) {
+            functions_.Add(fn_in, static_cast<uint32_t>(functions_.Count()));
+        }
+        for (auto& fn_in : mod_in_.functions) {
+            Function(bodies_, fn_in);
+        }
+        auto root_block = Block(mod_in_.root_block);
+
+        // Encode the block bodies. Encoding a block can add new blocks to the end of block_list_.
+        for (size_t i = 0; i < block_list_.Length(); i++) {
+            BlockBody(bodies_, block_list_[i]);
+        }
+
+        ByteWriter out;
+        out.Bytes(kMagic, sizeof(kMagic));
+        out.U32LE(kVersion);
+        out.U32LE(EnumFingerprint());
+        out.VarUint(strings_ids_.Count());
+        out.Append(strings_);
+        out.VarUint(types_.Count());
+        out.Append(types_out_);
+        out.VarUint(constant_values_.Count());
+        out.Append(constants_out_);
+        out.VarUint(functions_.Count());
+        out.VarUint(block_list_.Length());
+        out.Append(block_flags_);
+        out.VarUint(root_block);
+        out.VarUint(values_.Count());
+        out.Append(values_out_);
+        out.Append(bodies_);
+        return std::move(out.buffer);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Strings
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t String(std::string_view str) {
+        if (str.empty()) {
+            return 0;
+        }
+        if (auto id = strings_ids_.Get(str)) {
+            return *id;
+        }
+        strings_.VarUint(str.length());
+        strings_.Bytes(str.data(), str.length());
+        auto id = static_cast<uint32_t>(strings_ids_.Count() + 1);
+        strings_ids_.Add(str, id);
+        return id;
+    }
+
+    uint32_t Name(Symbol name) { return name.IsValid() ? String(name.NameView()) : 0; }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    void Function(ByteWriter& out, const ir::Function* fn_in) {
+        // Encode all the referenced ids before writing to `out`.
+        auto name = Name(mod_in_.NameOf(fn_in));
+        auto return_type = Type(fn_in->ReturnType());
+        Vector<uint32_t, 8> params;
+        for (auto* param_in : fn_in->Params()) {
+            params.Push(Value(param_in));
+        }
+        auto block = Block(fn_in->Block());
+
+        auto wg_size = fn_in->WorkgroupSize();
+        auto ret_loc = fn_in->ReturnLocation();
+        auto ret_builtin = fn_in->ReturnBuiltin();
+        uint8_t flags = 0;
+        if (wg_size) {
+            flags |= kFunctionWorkgroupSize;
+        }
+        if (ret_loc) {
+            flags |= kFunctionReturnLocation;
+        }
+        if (ret_builtin) {
+            flags |= kFunctionReturnBuiltin;
+        }
+        if (fn_in->ReturnInvariant()) {
+            flags |= kFunctionReturnInvariant;
+        }
+
+        out.VarUint(name);
+        out.VarUint(return_type);
+        out.VarUint(static_cast<uint32_t>(fn_in->Stage()));
+        out.U8(flags);
+        if (wg_size) {
+            out.VarUint((*wg_size)[0]);
+            out.VarUint((*wg_size)[1]);
+            out.VarUint((*wg_size)[2]);
+        }
+        out.VarUint(params.Length());
+        for (auto id : params) {
+            out.VarUint(id);
+        }
+        if (ret_loc) {
+            Location(out, *ret_loc);
+        }
+        if (ret_builtin) {
+            out.VarUint(static_cast<uint32_t>(*ret_builtin));
+        }
+        out.VarUint(block);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Blocks
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t Block(const ir::Block* block_in) {
+        TINT_ASSERT(block_in != nullptr);
+
+        return blocks_.GetOrAdd(block_in, [&]() -> uint32_t {
+            auto id = static_cast<uint32_t>(block_list_.Length());
+            block_list_.Push(block_in);
+            block_flags_.U8(block_in->Is<ir::MultiInBlock>() ? kBlockMultiIn : 0);
+            return id;
+        });
+    }
+
+    void BlockBody(ByteWriter& out, const ir::Block* block_in) {
+        if (auto* mib = block_in->As<ir::MultiInBlock>()) {
+            Vector<uint32_t, 4> params;
+            for (auto* param : mib->Params()) {
+                params.Push(Value(param));
+            }
+            out.VarUint(params.Length());
+            for (auto id : params) {
+                out.VarUint(id);
+            }
+        }
+        out.VarUint(block_in->Length());
+        for (auto* inst : *block_in) {
+            Instruction(out, inst);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Instructions
+    ////////////////////////////////////////////////////////////////////////////
+    void Instruction(ByteWriter& out, const ir::Instruction* inst_in) {
+        // Values are written to values_out_, and blocks are only assigned an id, so these calls
+        // do not write to `out`.
+        Vector<uint32_t, 8> operands;
+        for (auto* operand : inst_in->Operands()) {
+            operands.Push(Value(operand));
+        }
+        Vector<uint32_t, 4> results;
+        for (auto* result : inst_in->Results()) {
+            results.Push(Value(result));
+        }
+
+        tint::Switch(
+            inst_in,  //
+            [&](const ir::Access*) { out.U8(uint8_t(InstructionKind::kAccess)); },
+            [&](const ir::Bitcast*) { out.U8(uint8_t(InstructionKind::kBitcast)); },
+            [&](const ir::BreakIf* i) {
+                out.U8(uint8_t(InstructionKind::kBreakIf));
+                out.VarUint(i->NextIterValues().Length());
+            },
+            [&](const ir::CoreBinary* i) {
+                out.U8(uint8_t(InstructionKind::kBinary));
+                out.VarUint(static_cast<uint32_t>(i->Op()));
+            },
+            [&](const ir::CoreBuiltinCall* i) {
+                out.U8(uint8_t(InstructionKind::kBuiltinCall));
+                out.VarUint(static_cast<uint32_t>(i->Func()));
+            },
+            [&](const ir::CoreUnary* i) {
+                out.U8(uint8_t(InstructionKind::kUnary));
+                out.VarUint(static_cast<uint32_t>(i->Op()));
+            },
+            [&](const ir::Construct*) { out.U8(uint8_t(InstructionKind::kConstruct)); },
+            [&](const ir::Continue*) { out.U8(uint8_t(InstructionKind::kContinue)); },
+            [&](const ir::Convert*) { out.U8(uint8_t(InstructionKind::kConvert)); },
+            [&](const ir::Discard*) { out.U8(uint8_t(InstructionKind::kDiscard)); },
+            [&](const ir::ExitIf*) { out.U8(uint8_t(InstructionKind::kExitIf)); },
+            [&](const ir::ExitLoop*) { out.U8(uint8_t(InstructionKind::kExitLoop)); },
+            [&](const ir::ExitSwitch*) { out.U8(uint8_t(InstructionKind::kExitSwitch)); },
+            [&](const ir::If* i) { InstructionIf(out, i); },
+            [&](const ir::Let*) { out.U8(uint8_t(InstructionKind::kLet)); },
+            [&](const ir::Load*) { out.U8(uint8_t(InstructionKind::kLoad)); },
+            [&](const ir::LoadVectorElement*) {
+                out.U8(uint8_t(InstructionKind::kLoadVectorElement));
+            },
+            [&](const ir::Loop* i) { InstructionLoop(out, i); },
+            [&](const ir::NextIteration*) { out.U8(uint8_t(InstructionKind::kNextIteration)); },
+            [&](const ir::Return*) { out.U8(uint8_t(InstructionKind::kReturn)); },
+            [&](const ir::Store*) { out.U8(uint8_t(InstructionKind::kStore)); },
+            [&](const ir::StoreVectorElement*) {
+                out.U8(uint8_t(InstructionKind::kStoreVectorElement));
+            },
+            [&](const ir::Switch* i) { InstructionSwitch(out, i); },
+            [&](const ir::Swizzle* i) {
+                out.U8(uint8_t(InstructionKind::kSwizzle));
+                out.VarUint(i->Indices().Length());
+                for (auto idx : i->Indices()) {
+                    out.VarUint(idx);
+                }
+            },
+            [&](const ir::UserCall*) { out.U8(uint8_t(InstructionKind::kUserCall)); },
+            [&](const ir::Var* i) { InstructionVar(out, i); },
+            [&](const ir::Unreachable*) { out.U8(uint8_t(InstructionKind::kUnreachable)); },
+            TINT_ICE_ON_NO_MATCH);
+
+        out.VarUint(operands.Length());
+        for (auto id : operands) {
+            out.VarUint(id);
+        }
+        out.VarUint(results.Length());
+        for (auto id : results) {
+            out.VarUint(id);
+        }
+    }
+
+    void InstructionIf(ByteWriter& out, const ir::If* if_in) {
+        auto true_block = if_in->True() ? Block(if_in->True()) + 1 : 0;
+        auto false_block = if_in->False() ? Block(if_in->False()) + 1 : 0;
+        out.U8(uint8_t(InstructionKind::kIf));
+        out.VarUint(true_block);
+        out.VarUint(false_block);
+    }
+
+    void InstructionLoop(ByteWriter& out, const ir::Loop* loop_in) {
+        auto initializer = loop_in->HasInitializer() ? Block(loop_in->Initializer()) + 1 : 0;
+        auto body = Block(loop_in->Body());
+        auto continuing = loop_in->HasContinuing() ? Block(loop_in->Continuing()) + 1 : 0;
+        out.U8(uint8_t(InstructionKind::kLoop));
+        out.VarUint(initializer);
+        out.VarUint(body);
+        out.VarUint(continuing);
+    }
+
+    void InstructionSwitch(ByteWriter& out, const ir::Switch* switch_in) {
+        struct Case {
+            uint32_t block;
+            bool is_default;
+            Vector<uint32_t, 4> selectors;
+        };
+        Vector<Case, 4> cases;
+        for (auto& case_in : switch_in->Cases()) {
+            Case case_out{Block(case_in.block), false, {}};
+            for (auto& selector_in : case_in.selectors) {
+                if (selector_in.IsDefault()) {
+                    case_out.is_default = true;
+                } else {
+                    case_out.selectors.Push(ConstantValue(selector_in.val->Value()));
+                }
+            }
+            cases.Push(std::move(case_out));
+        }
+        out.U8(uint8_t(InstructionKind::kSwitch));
+        out.VarUint(cases.Length());
+        for (auto& c : cases) {
+            out.VarUint(c.block);
+            out.U8(c.is_default ? 1 : 0);
+            out.VarUint(c.selectors.Length());
+            for (auto id : c.selectors) {
+                out.VarUint(id);
+            }
+        }
+    }
+
+    void InstructionVar(ByteWriter& out, const ir::Var* var_in) {
+        auto bp = var_in->BindingPoint();
+        auto iidx = var_in->InputAttachmentIndex();
+        uint8_t flags = 0;
+        if (bp) {
+            flags |= kVarBindingPoint;
+        }
+        if (iidx) {
+            flags |= kVarInputAttachmentIndex;
+        }
+        out.U8(uint8_t(InstructionKind::kVar));
+        out.U8(flags);
+        if (bp) {
+            out.VarUint(bp->group);
+            out.VarUint(bp->binding);
+        }
+        if (iidx) {
+            out.VarUint(*iidx);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t Type(const core::type::Type* type_in) {
+        TINT_ASSERT(type_in != nullptr);
+        if (auto id = types_.Get(type_in)) {
+            return *id;
+        }
+
+        // Types only reference types that precede them, so encode the referenced types before
+        // writing this type to types_out_.
+        auto& out = types_out_;
+        auto basic = [&](TypeKind kind) { out.U8(uint8_t(kind)); };
+        tint::Switch(
+            type_in,  //
+            [&](const core::type::Void*) { basic(TypeKind::kVoid); },
+            [&](const core::type::Bool*) { basic(TypeKind::kBool); },
+            [&](const core::type::I32*) { basic(TypeKind::kI32); },
+            [&](const core::type::U32*) { basic(TypeKind::kU32); },
+            [&](const core::type::F32*) { basic(TypeKind::kF32); },
+            [&](const core::type::F16*) { basic(TypeKind::kF16); },
+            [&](const core::type::Vector* v) {
+                auto el = Type(v->type());
+                out.U8(uint8_t(TypeKind::kVector));
+                out.VarUint(v->Width());
+                out.VarUint(el);
+            },
+            [&](const core::type::Matrix* m) {
+                auto el = Type(m->type());
+                out.U8(uint8_t(TypeKind::kMatrix));
+                out.VarUint(m->columns());
+                out.VarUint(m->rows());
+                out.VarUint(el);
+            },
+            [&](const core::type::Pointer* p) {
+                auto store = Type(p->StoreType());
+                out.U8(uint8_t(TypeKind::kPointer));
+                out.VarUint(static_cast<uint32_t>(p->AddressSpace()));
+                out.VarUint(store);
+                out.VarUint(static_cast<uint32_t>(p->Access()));
+            },
+            [&](const core::type::Struct* s) { TypeStruct(s); },
+            [&](const core::type::Atomic* a) {
+                auto el = Type(a->Type());
+                out.U8(uint8_t(TypeKind::kAtomic));
+                out.VarUint(el);
+            },
+            [&](const core::type::Array* a) {
+                auto el = Type(a->ElemType());
+                uint32_t count = 0;
+                tint::Switch(
+                    a->Count(),  //
+                    [&](const core::type::ConstantArrayCount* c) { count = c->value; },
+                    [&](const core::type::RuntimeArrayCount*) { count = 0; },
+                    TINT_ICE_ON_NO_MATCH);
+                out.U8(uint8_t(TypeKind::kArray));
+                out.VarUint(el);
+                out.VarUint(a->Stride());
+                out.VarUint(count);
+            },
+            [&](const core::type::DepthTexture* t) {
+                out.U8(uint8_t(TypeKind::kDepthTexture));
+                out.VarUint(static_cast<uint32_t>(t->dim()));
+            },
+            [&](const core::type::SampledTexture* t) {
+                auto sub = Type(t->type());
+                out.U8(uint8_t(TypeKind::kSampledTexture));
+                out.VarUint(static_cast<uint32_t>(t->dim()));
+                out.VarUint(sub);
+            },
+            [&](const core::type::MultisampledTexture* t) {
+                auto sub = Type(t->type());
+                out.U8(uint8_t(TypeKind::kMultisampledTexture));
+                out.VarUint(static_cast<uint32_t>(t->dim()));
+                out.VarUint(sub);
+            },
+            [&](const core::type::DepthMultisampledTexture* t) {
+                out.U8(uint8_t(TypeKind::kDepthMultisampledTexture));
+                out.VarUint(static_cast<uint32_t>(t->dim()));
+            },
+            [&](const core::type::StorageTexture* t) {
+                out.U8(uint8_t(TypeKind::kStorageTexture));
+                out.VarUint(static_cast<uint32_t>(t->dim()));
+                out.VarUint(static_cast<uint32_t>(t->texel_format()));
+                out.VarUint(static_cast<uint32_t>(t->access()));
+            },
+            [&](const core::type::ExternalTexture*) { basic(TypeKind::kExternalTexture); },
+            [&](const core::type::Sampler* s) {
+                out.U8(uint8_t(TypeKind::kSampler));
+                out.VarUint(static_cast<uint32_t>(s->kind()));
+            },
+            [&](const core::type::InputAttachment* i) {
+                auto sub = Type(i->type());
+                out.U8(uint8_t(TypeKind::kInputAttachment));
+                out.VarUint(sub);
+            },
+            TINT_ICE_ON_NO_MATCH);
+
+        auto id = static_cast<uint32_t>(types_.Count());
+        types_.Add(type_in, id);
+        return id;
+    }
+
+    void TypeStruct(const core::type::Struct* struct_in) {
+        auto name = String(struct_in->Name().NameView());
+        Vector<uint32_t, 8> member_types;
+        Vector<uint32_t, 8> member_names;
+        for (auto* member_in : struct_in->Members()) {
+            member_types.Push(Type(member_in->Type()));
+            member_names.Push(String(member_in->Name().NameView()));
+        }
+
+        auto& out = types_out_;
+        out.U8(uint8_t(TypeKind::kStruct));
+        out.VarUint(name);
+        out.VarUint(member_types.Length());
+        for (size_t i = 0; i < member_types.Length(); i++) {
+            auto* member_in = struct_in->Members()[i];
+            out.VarUint(member_names[i]);
+            out.VarUint(member_types[i]);
+            out.VarUint(member_in->Size());
+            out.VarUint(member_in->Align());
+
+            auto& attrs_in = member_in->Attributes();
+            uint8_t flags = 0;
+            if (attrs_in.location) {
+                flags |= kMemberLocation;
+            }
+            if (attrs_in.blend_src) {
+                flags |= kMemberBlendSrc;
+            }
+            if (attrs_in.color) {
+                flags |= kMemberColor;
+            }
+            if (attrs_in.builtin) {
+                flags |= kMemberBuiltin;
+            }
+            if (attrs_in.interpolation) {
+                flags |= kMemberInterpolation;
+            }
+            if (attrs_in.invariant) {
+                flags |= kMemberInvariant;
+            }
+            out.U8(flags);
+            if (attrs_in.location) {
+                out.VarUint(*attrs_in.location);
+            }
+            if (attrs_in.blend_src) {
+                out.VarUint(*attrs_in.blend_src);
+            }
+            if (attrs_in.color) {
+                out.VarUint(*attrs_in.color);
+            }
+            if (attrs_in.builtin) {
+                out.VarUint(static_cast<uint32_t>(*attrs_in.builtin));
+            }
+            if (attrs_in.interpolation) {
+                Interpolation(out, *attrs_in.interpolation);
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Values
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t Value(const ir::Value* value_in) {
+        if (!value_in) {
+            return 0;
+        }
+        if (auto id = values_.Get(value_in)) {
+            return *id;
+        }
+
+        // Encode the referenced types, names and constants before writing to values_out_.
+        auto& out = values_out_;
+        tint::Switch(
+            value_in,
+            [&](const ir::InstructionResult* v) {
+                auto type = Type(v->Type());
+                auto name = Name(mod_in_.NameOf(v));
+                out.U8(uint8_t(ValueKind::kInstructionResult));
+                out.VarUint(type);
+                out.VarUint(name);
+            },
+            [&](const ir::FunctionParam* v) { FunctionParameter(v); },
+            [&](const ir::BlockParam* v) {
+                auto type = Type(v->Type());
+                auto name = Name(mod_in_.NameOf(v));
+                out.U8(uint8_t(ValueKind::kBlockParameter));
+                out.VarUint(type);
+                out.VarUint(name);
+            },
+            [&](const ir::Function* v) {
+                out.U8(uint8_t(ValueKind::kFunction));
+                out.VarUint(*functions_.Get(v));
+            },
+            [&](const ir::Constant* v) {
+                auto constant = ConstantValue(v->Value());
+                out.U8(uint8_t(ValueKind::kConstant));
+                out.VarUint(constant);
+            },
+            TINT_ICE_ON_NO_MATCH);
+
+        auto id = static_cast<uint32_t>(values_.Count() + 1);
+        values_.Add(value_in, id);
+        return id;
+    }
+
+    void FunctionParameter(const ir::FunctionParam* param_in) {
+        auto type = Type(param_in->Type());
+        auto name = Name(mod_in_.NameOf(param_in));
+        auto bp = param_in->BindingPoint();
+        auto location = param_in->Location();
+        auto builtin = param_in->Builtin();
+        uint8_t flags = 0;
+        if (bp) {
+            flags |= kParamBindingPoint;
+        }
+        if (location) {
+            flags |= kParamLocation;
+        }
+        if (builtin) {
+            flags |= kParamBuiltin;
+        }
+        if (param_in->Invariant()) {
+            flags |= kParamInvariant;
+        }
+
+        auto& out = values_out_;
+        out.U8(uint8_t(ValueKind::kFunctionParameter));
+        out.VarUint(type);
+        out.VarUint(name);
+        out.U8(flags);
+        if (bp) {
+            out.VarUint(bp->group);
+            out.VarUint(bp->binding);
+        }
+        if (location) {
+            Location(out, *location);
+        }
+        if (builtin) {
+            out.VarUint(static_cast<uint32_t>(*builtin));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // ConstantValues
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t ConstantValue(const core::constant::Value* constant_in) {
+        TINT_ASSERT(constant_in != nullptr);
+        if (auto id = constant_values_.Get(constant_in)) {
+            return *id;
+        }
+
+        // Constants only reference types and constants that precede them, so encode these before
+        // writing this constant to constants_out_.
+        auto& out = constants_out_;
+        auto composite = [&](const core::type::Type* type, size_t n, auto&& element) {
+            auto type_id = Type(type);
+            Vector<uint32_t, 8> elements;
+            elements.Reserve(n);
+            for (size_t i = 0; i < n; i++) {
+                elements.Push(ConstantValue(element(i)));
+            }
+            out.U8(uint8_t(ConstantKind::kComposite));
+            out.VarUint(type_id);
+            out.VarUint(elements.Length());
+            for (auto id : elements) {
+                out.VarUint(id);
+            }
+        };
+        tint::Switch(
+            constant_in,  //
+            [&](const core::constant::Scalar<bool>* b) {
+                out.U8(uint8_t(ConstantKind::kBool));
+                out.U8(b->value ? 1 : 0);
+            },
+            [&](const core::constant::Scalar<core::i32>* i32) {
+                out.U8(uint8_t(ConstantKind::kI32));
+                out.VarInt(i32->value);
+            },
+            [&](const core::constant::Scalar<core::u32>* u32) {
+                out.U8(uint8_t(ConstantKind::kU32));
+                out.VarUint(u32->value);
+            },
+            [&](const core::constant::Scalar<core::f32>* f32) {
+                out.U8(uint8_t(ConstantKind::kF32));
+                out.F32(f32->value);
+            },
+            [&](const core::constant::Scalar<core::f16>* f16) {
+                out.U8(uint8_t(ConstantKind::kF16));
+                out.F32(f16->value);
+            },
+            [&](const core::constant::Composite* c) {
+                composite(c->type, c->elements.Length(), [&](size_t i) { return c->elements[i]; });
+            },
+            [&](const core::constant::Splat* s) {
+                auto type = Type(s->type);
+                auto el = ConstantValue(s->el);
+                out.U8(uint8_t(ConstantKind::kSplat));
+                out.VarUint(type);
+                out.VarUint(el);
+            },
+            [&](const core::constant::DenseComposite* c) {
+                // Dense composites are encoded as regular composites. The decoder rebuilds them
+                // with constant::Manager::Composite(), which returns a DenseComposite again.
+                composite(c->type, c->NumElements(), [&](size_t i) { return c->Index(i); });
+            },
+            TINT_ICE_ON_NO_MATCH);
+
+        auto id = static_cast<uint32_t>(constant_values_.Count());
+        constant_values_.Add(constant_in, id);
+        return id;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Attributes
+    ////////////////////////////////////////////////////////////////////////////
+    void Location(ByteWriter& out, const ir::Location& location_in) {
+        out.VarUint(location_in.value);
+        out.U8(location_in.interpolation ? 1 : 0);
+        if (location_in.interpolation) {
+            Interpolation(out, *location_in.interpolation);
+        }
+    }
+
+    void Interpolation(ByteWriter& out, const core::Interpolation& interpolation_in) {
+        out.VarUint(static_cast<uint32_t>(interpolation_in.type));
+        out.VarUint(static_cast<uint32_t>(interpolation_in.sampling));
+    }
+};
+
+}  // namespace
+
+Result<Vector<std::byte, 0>> Encode(const Module& mod_in) {
+    return Encoder{mod_in}.Encode();
+}
+
+}  // namespace tint::core::ir::binary::flat
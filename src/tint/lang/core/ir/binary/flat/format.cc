@@ -0,0 +1,84 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/binary/flat/format.h"
+
+#include <string>
+
+#include "src/tint/lang/core/access.h"
+#include "src/tint/lang/core/address_space.h"
+#include "src/tint/lang/core/binary_op.h"
+#include "src/tint/lang/core/builtin_fn.h"
+#include "src/tint/lang/core/builtin_value.h"
+#include "src/tint/lang/core/interpolation_sampling.h"
+#include "src/tint/lang/core/interpolation_type.h"
+#include "src/tint/lang/core/ir/function.h"
+#include "src/tint/lang/core/texel_format.h"
+#include "src/tint/lang/core/type/sampler_kind.h"
+#include "src/tint/lang/core/type/texture_dimension.h"
+#include "src/tint/lang/core/unary_op.h"
+#include "src/tint/utils/math/crc32.h"
+
+namespace tint::core::ir::binary::flat {
+namespace {
+
+/// Appends the names of the enumerators of ENUM, from 0 to @p last inclusive, to @p out.
+template <typename ENUM, typename TO_STRING>
+void AppendEnum(std::string& out, ENUM last, TO_STRING&& to_string) {
+    for (uint32_t i = 0; i <= static_cast<uint32_t>(last); i++) {
+        out += to_string(static_cast<ENUM>(i));
+        out += ',';
+    }
+    out += ';';
+}
+
+uint32_t ComputeEnumFingerprint() {
+    std::string names;
+    AppendEnum(names, core::Access::kWrite, [](auto v) { return ToString(v); });
+    AppendEnum(names, core::AddressSpace::kWorkgroup, [](auto v) { return ToString(v); });
+    AppendEnum(names, core::BinaryOp::kModulo, [](auto v) { return ToString(v); });
+    AppendEnum(names, core::BuiltinFn::kNone, [](auto v) { return std::string(str(v)); });
+    AppendEnum(names, core::BuiltinValue::kWorkgroupId, [](auto v) { return ToString(v); });
+    AppendEnum(names, core::InterpolationSampling::kSample, [](auto v) { return ToString(v); });
+    AppendEnum(names, core::InterpolationType::kPerspective, [](auto v) { return ToString(v); });
+    AppendEnum(names, Function::PipelineStage::kVertex, [](auto v) { return ToString(v); });
+    AppendEnum(names, core::TexelFormat::kRgba8Unorm, [](auto v) { return ToString(v); });
+    AppendEnum(names, core::type::SamplerKind::kComparisonSampler,
+               [](auto v) { return ToString(v); });
+    AppendEnum(names, core::type::TextureDimension::kNone, [](auto v) { return ToString(v); });
+    AppendEnum(names, core::UnaryOp::kNot, [](auto v) { return ToString(v); });
+    return CRC32(names.data(), names.size());
+}
+
+}  // namespace
+
+uint32_t EnumFingerprint() {
+    static const uint32_t fingerprint = ComputeEnumFingerprint();
+    return fingerprint;
+}
+
+}  // namespace tint::core::ir::binary::flat
@@ -0,0 +1,337 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_IR_BINARY_FLAT_FORMAT_H_
+#define SRC_TINT_LANG_CORE_IR_BINARY_FLAT_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "src/tint/utils/containers/vector.h"
+#include "src/tint/utils/macros/compiler.h"
+
+/// The flat IR binary format.
+///
+/// A flat encoded module is a sequence of sections. Integers are unsigned LEB128 varints unless
+/// noted otherwise, signed integers are zig-zag encoded, and floats are little-endian IEEE-754
+/// single precision. Every section starts with its element count.
+///
+///   header:          magic "TIRF", u32le version, u32le enum fingerprint
+///   strings:         count, then each string as (length, bytes)
+///   types:           count, then each type as (TypeKind, payload)
+///   constant values: count, then each constant as (ConstantKind, payload)
+///   functions:       count
+///   blocks:          count, then the BlockFlags of each block, then the root block id
+///   values:          count, then each value as (ValueKind, payload)
+///   function bodies: one per function
+///   block bodies:    one per block, each holding the block's params and instructions
+///
+/// Types and constant values only reference entries that precede them in their section, so they
+/// can be decoded in a single pass. String ids and value ids are 1-based, with 0 meaning 'none'.
+/// All other ids are 0-based indices into their section.
+///
+/// Core enums (builtin functions, operators, address spaces, etc.) are encoded by their numeric
+/// value. The header holds a fingerprint of the enumerator names of all these enums, so that a
+/// module encoded by a build with different enums fails to decode instead of being misread.
+namespace tint::core::ir::binary::flat {
+
+/// The first four bytes of a flat encoded module.
+static constexpr char kMagic[4] = {'T', 'I', 'R', 'F'};
+
+/// The version of the flat format. Must be incremented on any change to the format.
+static constexpr uint32_t kVersion = 1;
+
+/// @returns the hash of the names and order of the enumerators of the core enums that the format
+/// encodes by value.
+uint32_t EnumFingerprint();
+
+/// The kind of an encoded type
+enum class TypeKind : uint8_t {
+    kVoid,
+    kBool,
+    kI32,
+    kU32,
+    kF32,
+    kF16,
+    kVector,
+    kMatrix,
+    kPointer,
+    kStruct,
+    kAtomic,
+    kArray,
+    kDepthTexture,
+    kSampledTexture,
+    kMultisampledTexture,
+    kDepthMultisampledTexture,
+    kStorageTexture,
+    kExternalTexture,
+    kSampler,
+    kInputAttachment,
+};
+
+/// The kind of an encoded constant value
+enum class ConstantKind : uint8_t {
+    kBool,
+    kI32,
+    kU32,
+    kF32,
+    kF16,
+    kComposite,
+    kSplat,
+};
+
+/// The kind of an encoded value
+enum class ValueKind : uint8_t {
+    kInstructionResult,
+    kFunctionParameter,
+    kBlockParameter,
+    kFunction,
+    kConstant,
+};
+
+/// The kind of an encoded instruction
+enum class InstructionKind : uint8_t {
+    kAccess,
+    kBinary,
+    kBitcast,
+    kBreakIf,
+    kBuiltinCall,
+    kConstruct,
+    kContinue,
+    kConvert,
+    kDiscard,
+    kExitIf,
+    kExitLoop,
+    kExitSwitch,
+    kIf,
+    kLet,
+    kLoad,
+    kLoadVectorElement,
+    kLoop,
+    kNextIteration,
+    kReturn,
+    kStore,
+    kStoreVectorElement,
+    kSwitch,
+    kSwizzle,
+    kUnary,
+    kUserCall,
+    kVar,
+    kUnreachable,
+};
+
+/// Flags of an encoded block
+enum BlockFlags : uint8_t {
+    kBlockMultiIn = 1 << 0,
+};
+
+/// Flags of the optional fields of an encoded function
+enum FunctionFlags : uint8_t {
+    kFunctionWorkgroupSize = 1 << 0,
+    kFunctionReturnLocation = 1 << 1,
+    kFunctionReturnBuiltin = 1 << 2,
+    kFunctionReturnInvariant = 1 << 3,
+};
+
+/// Flags of the optional attributes of an encoded function parameter
+enum ParamFlags : uint8_t {
+    kParamBindingPoint = 1 << 0,
+    kParamLocation = 1 << 1,
+    kParamBuiltin = 1 << 2,
+    kParamInvariant = 1 << 3,
+};
+
+/// Flags of the optional attributes of an encoded structure member
+enum MemberFlags : uint8_t {
+    kMemberLocation = 1 << 0,
+    kMemberBlendSrc = 1 << 1,
+    kMemberColor = 1 << 2,
+    kMemberBuiltin = 1 << 3,
+    kMemberInterpolation = 1 << 4,
+    kMemberInvariant = 1 << 5,
+};
+
+/// Flags of the optional attributes of an encoded var instruction
+enum VarFlags : uint8_t {
+    kVarBindingPoint = 1 << 0,
+    kVarInputAttachmentIndex = 1 << 1,
+};
+
+/// ByteWriter appends encoded integers, floats and bytes to a byte buffer.
+class ByteWriter {
+  public:
+    /// Writes a single byte
+    /// @param v the byte
+    void U8(uint8_t v) { buffer.Push(static_cast<std::byte>(v)); }
+
+    /// Writes a 32-bit unsigned integer as 4 little-endian bytes
+    /// @param v the integer
+    void U32LE(uint32_t v) {
+        for (int i = 0; i < 4; i++) {
+            U8(static_cast<uint8_t>(v >> (i * 8)));
+        }
+    }
+
+    /// Writes an unsigned varint
+    /// @param v the integer
+    void VarUint(uint64_t v) {
+        while (v >= 0x80) {
+            U8(static_cast<uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        U8(static_cast<uint8_t>(v));
+    }
+
+    /// Writes a zig-zag encoded signed varint
+    /// @param v the integer
+    void VarInt(int32_t v) {
+        VarUint((static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 31));
+    }
+
+    /// Writes a float as 4 little-endian bytes
+    /// @param v the float
+    void F32(float v) {
+        uint32_t bits = 0;
+        memcpy(&bits, &v, sizeof(bits));
+        U32LE(bits);
+    }
+
+    /// Writes raw bytes
+    /// @param data the bytes
+    /// @param size the number of bytes
+    void Bytes(const void* data, size_t size) {
+        if (size > 0) {
+            size_t at = buffer.Length();
+            buffer.Resize(at + size);
+            memcpy(&buffer[at], data, size);
+        }
+    }
+
+    /// Writes the content of another writer
+    /// @param other the writer to append
+    void Append(const ByteWriter& other) {
+        if (!other.buffer.IsEmpty()) {
+            Bytes(&other.buffer[0], other.buffer.Length());
+        }
+    }
+
+    /// The encoded bytes
+    Vector<std::byte, 0> buffer;
+};
+
+/// ByteReader reads encoded integers, floats and bytes from a byte buffer, without copying.
+/// Reading past the end of the buffer returns zeros and sets #failed.
+class ByteReader {
+  public:
+    /// Constructor
+    /// @param data the start of the buffer
+    /// @param size the size of the buffer in bytes
+    ByteReader(const std::byte* data, size_t size)
+        : ptr_(reinterpret_cast<const uint8_t*>(data)), end_(ptr_ + size) {}
+
+    /// @returns the number of bytes that have not been read
+    size_t Remaining() const { return static_cast<size_t>(end_ - ptr_); }
+
+    /// @returns the next byte
+    uint8_t U8() {
+        if (TINT_UNLIKELY(ptr_ == end_)) {
+            failed = true;
+            return 0;
+        }
+        return *ptr_++;
+    }
+
+    /// @returns the next 4 bytes as a little-endian 32-bit unsigned integer
+    uint32_t U32LE() {
+        if (TINT_UNLIKELY(Remaining() < 4)) {
+            failed = true;
+            ptr_ = end_;
+            return 0;
+        }
+        uint32_t v = static_cast<uint32_t>(ptr_[0]) | (static_cast<uint32_t>(ptr_[1]) << 8) |
+                     (static_cast<uint32_t>(ptr_[2]) << 16) | (static_cast<uint32_t>(ptr_[3]) << 24);
+        ptr_ += 4;
+        return v;
+    }
+
+    /// @returns the next unsigned varint. Sets #failed if the varint does not fit in 32 bits.
+    uint32_t VarUint() {
+        uint32_t v = 0;
+        for (uint32_t shift = 0; shift < 35; shift += 7) {
+            uint8_t byte = U8();
+            v |= static_cast<uint32_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                if (TINT_UNLIKELY(shift == 28 && byte > 0x0f)) {
+                    failed = true;
+                }
+                return v;
+            }
+        }
+        failed = true;
+        return 0;
+    }
+
+    /// @returns the next zig-zag encoded signed varint
+    int32_t VarInt() {
+        uint32_t v = VarUint();
+        return static_cast<int32_t>((v >> 1) ^ (~(v & 1) + 1));
+    }
+
+    /// @returns the next 4 bytes as a little-endian float
+    float F32() {
+        uint32_t bits = U32LE();
+        float v = 0;
+        memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+
+    /// @param size the number of bytes
+    /// @returns a view of the next @p size bytes of the buffer
+    std::string_view Bytes(size_t size) {
+        if (TINT_UNLIKELY(Remaining() < size)) {
+            failed = true;
+            ptr_ = end_;
+            return {};
+        }
+        std::string_view out(reinterpret_cast<const char*>(ptr_), size);
+        ptr_ += size;
+        return out;
+    }
+
+    /// True if a read went past the end of the buffer, or a varint was malformed
+    bool failed = false;
+
+  private:
+    const uint8_t* ptr_ = nullptr;
+    const uint8_t* end_ = nullptr;
+};
+
+}  // namespace tint::core::ir::binary::flat
+
+#endif  // SRC_TINT_LANG_CORE_IR_BINARY_FLAT_FORMAT_H_
@@ -0,0 +1,140 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// GEN_BUILD:CONDITION(tint_build_wgsl_reader)
+
+#include <string>
+#include <utility>
+
+#include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/core/ir/binary/flat/decode.h"
+#include "src/tint/lang/core/ir/binary/flat/encode.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/wgsl/reader/reader.h"
+
+#if TINT_BUILD_IR_BINARY
+#include "src/tint/lang/core/ir/binary/decode.h"
+#include "src/tint/lang/core/ir/binary/encode.h"
+#endif  // TINT_BUILD_IR_BINARY
+
+namespace tint::core::ir::binary::flat {
+namespace {
+
+/// Benchmarks encoding the lowered IR of the program @p input_name with @p encode.
+/// The size of the encoded module is reported as the 'encoded_bytes' counter.
+template <typename ENCODE>
+void RunEncode(benchmark::State& state, const std::string& input_name, ENCODE&& encode) {
+    auto res = bench::LoadProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    auto ir = wgsl::reader::ProgramToLoweredIR(res->program);
+    if (ir != Success) {
+        state.SkipWithError(ir.Failure().reason.Str());
+        return;
+    }
+    size_t encoded_bytes = 0;
+    for (auto _ : state) {
+        auto encoded = encode(ir.Get());
+        if (encoded != Success) {
+            state.SkipWithError(encoded.Failure().reason.Str());
+            return;
+        }
+        encoded_bytes = encoded->Length();
+    }
+    state.counters["encoded_bytes"] = static_cast<double>(encoded_bytes);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * encoded_bytes));
+}
+
+/// Benchmarks decoding the lowered IR of the program @p input_name, encoded with @p encode, with
+/// @p decode.
+template <typename ENCODE, typename DECODE>
+void RunDecode(benchmark::State& state,
+               const std::string& input_name,
+               ENCODE&& encode,
+               DECODE&& decode) {
+    auto res = bench::LoadProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    auto ir = wgsl::reader::ProgramToLoweredIR(res->program);
+    if (ir != Success) {
+        state.SkipWithError(ir.Failure().reason.Str());
+        return;
+    }
+    auto encoded = encode(ir.Get());
+    if (encoded != Success) {
+        state.SkipWithError(encoded.Failure().reason.Str());
+        return;
+    }
+    for (auto _ : state) {
+        auto decoded = decode(encoded->Slice());
+        if (decoded != Success) {
+            state.SkipWithError(decoded.Failure().reason.Str());
+            return;
+        }
+    }
+    state.counters["encoded_bytes"] = static_cast<double>(encoded->Length());
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * encoded->Length()));
+}
+
+void EncodeFlat(benchmark::State& state, std::string input_name) {
+    RunEncode(state, input_name, [](const Module& mod) { return Encode(mod); });
+}
+
+void DecodeFlat(benchmark::State& state, std::string input_name) {
+    RunDecode(
+        state, input_name, [](const Module& mod) { return Encode(mod); },
+        [](Slice<const std::byte> encoded) { return Decode(encoded); });
+}
+
+TINT_BENCHMARK_PROGRAMS(EncodeFlat);
+TINT_BENCHMARK_PROGRAMS(DecodeFlat);
+
+#if TINT_BUILD_IR_BINARY
+
+// The protobuf encoding, as a baseline for the flat format.
+
+void EncodeProto(benchmark::State& state, std::string input_name) {
+    RunEncode(state, input_name, [](const Module& mod) { return EncodeToBinary(mod); });
+}
+
+void DecodeProto(benchmark::State& state, std::string input_name) {
+    RunDecode(
+        state, input_name, [](const Module& mod) { return EncodeToBinary(mod); },
+        [](Slice<const std::byte> encoded) { return binary::Decode(encoded); });
+}
+
+TINT_BENCHMARK_PROGRAMS(EncodeProto);
+TINT_BENCHMARK_PROGRAMS(DecodeProto);
+
+#endif  // TINT_BUILD_IR_BINARY
+
+}  // namespace
+}  // namespace tint::core::ir::binary::flat
@@ -29,6 +29,8 @@
 
 #include "src/tint/lang/core/ir/binary/decode.h"
 #include "src/tint/lang/core/ir/binary/encode.h"
+#include "src/tint/lang/core/ir/binary/flat/decode.h"
+#include "src/tint/lang/core/ir/binary/flat/encode.h"
 #include "src/tint/lang/core/ir/disassembler.h"
 #include "src/tint/lang/core/type/depth_multisampled_texture.h"
 #include "src/tint/lang/core/type/depth_texture.h"
@@ -60,13 +62,29 @@ class IRBinaryRoundtripTestBase : public IRTestParamHelper<T> {
         auto post = Disassembler(decoded.Get()).Plain();
         return {pre, post};
     }
+
+    std::pair<std::string, std::string> RoundtripFlat() {
+        auto pre = Disassembler(this->mod).Plain();
+        auto encoded = flat::Encode(this->mod);
+        if (encoded != Success) {
+            return {pre, encoded.Failure().reason.Str()};
+        }
+        auto decoded = flat::Decode(encoded->Slice());
+        if (decoded != Success) {
+            return {pre, decoded.Failure().reason.Str()};
+        }
+        auto post = Disassembler(decoded.Get()).Plain();
+        return {pre, post};
+    }
 };
 
-#define RUN_TEST()                      \
-    {                                   \
-        auto [pre, post] = Roundtrip(); \
-        EXPECT_EQ(pre, post);           \
-    }                                   \
+#define RUN_TEST()                                    \
+    {                                                 \
+        auto [pre, post] = Roundtrip();               \
+        EXPECT_EQ(pre, post);                         \
+        auto [flat_pre, flat_post] = RoundtripFlat(); \
+        EXPECT_EQ(flat_pre, flat_post);               \
+    }                                                 \
     TINT_REQUIRE_SEMICOLON
 
 using IRBinaryRoundtripTest = IRBinaryRoundtripTestBase<>;
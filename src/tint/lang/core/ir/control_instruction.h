@@ -31,6 +31,7 @@
 #include <utility>
 
 #include "src/tint/lang/core/ir/operand_instruction.h"
+#include "src/tint/utils/containers/hashset.h"
 
 // Forward declarations
 namespace tint::core::ir {
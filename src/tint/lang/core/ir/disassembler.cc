@@ -35,6 +35,7 @@
 #include "src//tint/lang/core/ir/unary.h"
 #include "src/tint/lang/core/binary_op.h"
 #include "src/tint/lang/core/constant/composite.h"
+#include "src/tint/lang/core/constant/dense_composite.h"
 #include "src/tint/lang/core/constant/scalar.h"
 #include "src/tint/lang/core/constant/splat.h"
 #include "src/tint/lang/core/ir/binary.h"
@@ -419,6 +420,16 @@ void Disassembler::EmitValue(const Value* val) {
                             }
                             out_ << ")";
                         },
+                        [&](const core::constant::DenseComposite* composite) {
+                            out_ << StyleType(composite->Type()->FriendlyName()) << "(";
+                            for (size_t i = 0; i < composite->NumElements(); i++) {
+                                if (i > 0) {
+                                    out_ << ", ";
+                                }
+                                emit(composite->Index(i));
+                            }
+                            out_ << ")";
+                        },
                         TINT_ICE_ON_NO_MATCH);
                 };
             emit(constant->Value());
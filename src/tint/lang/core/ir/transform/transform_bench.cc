@@ -0,0 +1,169 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// GEN_BUILD:CONDITION(tint_build_wgsl_reader)
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/transform/add_empty_entry_point.h"
+#include "src/tint/lang/core/ir/transform/array_length_from_uniform.h"
+#include "src/tint/lang/core/ir/transform/bgra8unorm_polyfill.h"
+#include "src/tint/lang/core/ir/transform/binary_polyfill.h"
+#include "src/tint/lang/core/ir/transform/binding_remapper.h"
+#include "src/tint/lang/core/ir/transform/block_decorated_structs.h"
+#include "src/tint/lang/core/ir/transform/builtin_polyfill.h"
+#include "src/tint/lang/core/ir/transform/combine_access_instructions.h"
+#include "src/tint/lang/core/ir/transform/conversion_polyfill.h"
+#include "src/tint/lang/core/ir/transform/demote_to_helper.h"
+#include "src/tint/lang/core/ir/transform/direct_variable_access.h"
+#include "src/tint/lang/core/ir/transform/multiplanar_external_texture.h"
+#include "src/tint/lang/core/ir/transform/preserve_padding.h"
+#include "src/tint/lang/core/ir/transform/remove_terminator_args.h"
+#include "src/tint/lang/core/ir/transform/rename_conflicts.h"
+#include "src/tint/lang/core/ir/transform/robustness.h"
+#include "src/tint/lang/core/ir/transform/std140.h"
+#include "src/tint/lang/core/ir/transform/value_to_let.h"
+#include "src/tint/lang/core/ir/transform/vectorize_scalar_matrix_constructors.h"
+#include "src/tint/lang/core/ir/transform/zero_init_workgroup_memory.h"
+#include "src/tint/lang/wgsl/reader/reader.h"
+
+namespace tint::core::ir::transform {
+namespace {
+
+/// Benchmarks the transform @p transform in isolation, on the IR of the program @p input_name.
+/// The program is loaded once, but as transforms modify the module in place, each iteration
+/// converts a fresh module from the program with the timer paused.
+template <typename TRANSFORM>
+void RunTransform(benchmark::State& state, const std::string& input_name, TRANSFORM&& transform) {
+    auto res = bench::LoadProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto ir = wgsl::reader::ProgramToLoweredIR(res->program);
+        if (ir != Success) {
+            state.SkipWithError(ir.Failure().reason.Str());
+            return;
+        }
+        state.ResumeTiming();
+
+        auto result = transform(ir.Get());
+        if (result != Success) {
+            state.SkipWithError(result.Failure().reason.Str());
+            return;
+        }
+    }
+}
+
+/// Declares the benchmark `NAME##Transform` for the transform `NAME`, run on each of the
+/// benchmark programs. The variadic arguments are passed to the transform after the module.
+#define TINT_BENCHMARK_TRANSFORM(NAME, ...)                                         \
+    void NAME##Transform(benchmark::State& state, std::string input_name) {         \
+        RunTransform(state, input_name,                                             \
+                     [&](Module& module) { return NAME(module, ##__VA_ARGS__); }); \
+    }                                                                               \
+    TINT_BENCHMARK_PROGRAMS(NAME##Transform)
+
+/// @returns a BinaryPolyfillConfig with all the polyfills enabled
+BinaryPolyfillConfig AllBinaryPolyfills() {
+    BinaryPolyfillConfig config;
+    config.bitshift_modulo = true;
+    config.int_div_mod = true;
+    return config;
+}
+
+/// @returns a BuiltinPolyfillConfig with all the polyfills enabled
+BuiltinPolyfillConfig AllBuiltinPolyfills() {
+    BuiltinPolyfillConfig config;
+    config.clamp_int = true;
+    config.count_leading_zeros = true;
+    config.count_trailing_zeros = true;
+    config.extract_bits = BuiltinPolyfillLevel::kClampOrRangeCheck;
+    config.first_leading_bit = true;
+    config.first_trailing_bit = true;
+    config.insert_bits = BuiltinPolyfillLevel::kClampOrRangeCheck;
+    config.saturate = true;
+    config.texture_sample_base_clamp_to_edge_2d_f32 = true;
+    config.dot_4x8_packed = true;
+    config.pack_unpack_4x8 = true;
+    config.pack_4xu8_clamp = true;
+    return config;
+}
+
+/// @returns a ConversionPolyfillConfig with all the polyfills enabled
+ConversionPolyfillConfig AllConversionPolyfills() {
+    ConversionPolyfillConfig config;
+    config.ftoi = true;
+    return config;
+}
+
+/// @returns the DirectVariableAccessOptions used by the SPIR-V backend
+DirectVariableAccessOptions AllDirectVariableAccess() {
+    DirectVariableAccessOptions options;
+    options.transform_function = true;
+    options.transform_private = true;
+    return options;
+}
+
+/// @returns the result of ArrayLengthFromUniform, with no storage buffers remapped
+Result<SuccessType> ArrayLengthFromUniformNoBindings(Module& module) {
+    auto result = ArrayLengthFromUniform(module, BindingPoint{0, 30}, {});
+    if (result != Success) {
+        return result.Failure();
+    }
+    return Success;
+}
+
+TINT_BENCHMARK_TRANSFORM(AddEmptyEntryPoint);
+TINT_BENCHMARK_TRANSFORM(ArrayLengthFromUniformNoBindings);
+TINT_BENCHMARK_TRANSFORM(Bgra8UnormPolyfill);
+TINT_BENCHMARK_TRANSFORM(BinaryPolyfill, AllBinaryPolyfills());
+TINT_BENCHMARK_TRANSFORM(BindingRemapper, std::unordered_map<BindingPoint, BindingPoint>{});
+TINT_BENCHMARK_TRANSFORM(BlockDecoratedStructs);
+TINT_BENCHMARK_TRANSFORM(BuiltinPolyfill, AllBuiltinPolyfills());
+TINT_BENCHMARK_TRANSFORM(CombineAccessInstructions);
+TINT_BENCHMARK_TRANSFORM(ConversionPolyfill, AllConversionPolyfills());
+TINT_BENCHMARK_TRANSFORM(DemoteToHelper);
+TINT_BENCHMARK_TRANSFORM(DirectVariableAccess, AllDirectVariableAccess());
+TINT_BENCHMARK_TRANSFORM(MultiplanarExternalTexture, tint::transform::multiplanar::BindingsMap{});
+TINT_BENCHMARK_TRANSFORM(PreservePadding);
+TINT_BENCHMARK_TRANSFORM(RemoveTerminatorArgs);
+TINT_BENCHMARK_TRANSFORM(RenameConflicts);
+TINT_BENCHMARK_TRANSFORM(Robustness, RobustnessConfig{});
+TINT_BENCHMARK_TRANSFORM(Std140);
+TINT_BENCHMARK_TRANSFORM(ValueToLet);
+TINT_BENCHMARK_TRANSFORM(VectorizeScalarMatrixConstructors);
+TINT_BENCHMARK_TRANSFORM(ZeroInitWorkgroupMemory);
+
+}  // namespace
+}  // namespace tint::core::ir::transform
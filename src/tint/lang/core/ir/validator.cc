@@ -506,6 +506,7 @@ class Validator {
     Vector<std::function<void()>, 16> tasks_;
     SymbolTable symbols_ = SymbolTable::Wrap(mod_.symbols);
     type::Manager type_mgr_ = type::Manager::Wrap(mod_.Types());
+    intrinsic::OverloadCache intrinsic_cache_;
 };
 
 Validator::Validator(const Module& mod, Capabilities capabilities)
@@ -1011,6 +1012,7 @@ void Validator::CheckBuiltinCall(const BuiltinCall* call) {
         call->TableData(),
         type_mgr_,
         symbols_,
+        &intrinsic_cache_,
     };
 
     auto result = core::intrinsic::LookupFn(context, call->FriendlyName().c_str(), call->FuncId(),
@@ -1034,6 +1036,7 @@ void Validator::CheckMemberBuiltinCall(const MemberBuiltinCall* call) {
         call->TableData(),
         type_mgr_,
         symbols_,
+        &intrinsic_cache_,
     };
 
     auto result =
@@ -1208,7 +1211,7 @@ void Validator::CheckAccess(const Access* a) {
 void Validator::CheckBinary(const Binary* b) {
     CheckOperandsNotNull(b, Binary::kLhsOperandOffset, Binary::kRhsOperandOffset);
     if (b->LHS() && b->RHS()) {
-        intrinsic::Context context{b->TableData(), type_mgr_, symbols_};
+        intrinsic::Context context{b->TableData(), type_mgr_, symbols_, &intrinsic_cache_};
 
         auto overload =
             core::intrinsic::LookupBinary(context, b->Op(), b->LHS()->Type(), b->RHS()->Type(),
@@ -1232,7 +1235,7 @@ void Validator::CheckBinary(const Binary* b) {
 void Validator::CheckUnary(const Unary* u) {
     CheckOperandNotNull(u, u->Val(), Unary::kValueOperandOffset);
     if (u->Val()) {
-        intrinsic::Context context{u->TableData(), type_mgr_, symbols_};
+        intrinsic::Context context{u->TableData(), type_mgr_, symbols_, &intrinsic_cache_};
 
         auto overload = core::intrinsic::LookupUnary(context, u->Op(), u->Val()->Type(),
                                                      core::EvaluationStage::kRuntime);
@@ -27,6 +27,8 @@
 
 #include "src/tint/lang/core/ir/value.h"
 
+#include <algorithm>
+
 #include "src/tint/lang/core/ir/constant.h"
 #include "src/tint/lang/core/ir/instruction.h"
 #include "src/tint/utils/ice/ice.h"
@@ -44,6 +46,59 @@ void Value::Destroy() {
     flags_.Add(Flag::kDead);
 }
 
+void Value::AddUsage(Usage u) {
+    TINT_ASSERT(!HasUsage(u.instruction, u.operand_index));
+    uses_.Push(u);
+    if (use_indices_) {
+        use_indices_->Add(u, static_cast<uint32_t>(uses_.Length() - 1));
+    } else if (uses_.Length() > kMaxUnindexedUsages) {
+        use_indices_ = std::make_unique<Hashmap<Usage, uint32_t, 0>>();
+        for (size_t i = 0; i < uses_.Length(); i++) {
+            use_indices_->Add(uses_[i], static_cast<uint32_t>(i));
+        }
+    }
+}
+
+void Value::RemoveUsage(Usage u) {
+    // The order of the usages is not preserved. The last usage is moved into the removed slot.
+    auto remove_at = [&](size_t idx) {
+        if (idx != uses_.Length() - 1) {
+            uses_[idx] = uses_.Back();
+            if (use_indices_) {
+                use_indices_->Replace(uses_[idx], static_cast<uint32_t>(idx));
+            }
+        }
+        uses_.Pop();
+    };
+
+    if (use_indices_) {
+        if (auto idx = use_indices_->Get(u)) {
+            uint32_t i = *idx;
+            use_indices_->Remove(u);
+            remove_at(i);
+        }
+        return;
+    }
+
+    // Search from the back, as ReplaceAllUsesWith() removes the most recently added usages first.
+    auto uses = uses_.Slice();
+    for (size_t i = uses.len; i > 0; i--) {
+        if (uses.data[i - 1] == u) {
+            remove_at(i - 1);
+            return;
+        }
+    }
+}
+
+bool Value::HasUsage(const Instruction* instruction, size_t operand_index) const {
+    Usage usage{const_cast<Instruction*>(instruction), operand_index};
+    if (use_indices_) {
+        return use_indices_->Contains(usage);
+    }
+    auto uses = uses_.Slice();
+    return std::find(uses.data, uses.data + uses.len, usage) != uses.data + uses.len;
+}
+
 void Value::ForEachUse(std::function<void(Usage use)> func) const {
     auto uses = uses_;
     for (auto& use : uses) {
@@ -53,16 +108,16 @@ void Value::ForEachUse(std::function<void(Usage use)> func) const {
 
 void Value::ReplaceAllUsesWith(std::function<Value*(Usage use)> replacer) {
     while (!uses_.IsEmpty()) {
-        auto& use = *uses_.begin();
+        auto use = uses_.Back();
         auto* replacement = replacer(use);
-        use->instruction->SetOperand(use->operand_index, replacement);
+        use.instruction->SetOperand(use.operand_index, replacement);
     }
 }
 
 void Value::ReplaceAllUsesWith(Value* replacement) {
     while (!uses_.IsEmpty()) {
-        auto& use = *uses_.begin();
-        use->instruction->SetOperand(use->operand_index, replacement);
+        auto use = uses_.Back();
+        use.instruction->SetOperand(use.operand_index, replacement);
     }
 }
 
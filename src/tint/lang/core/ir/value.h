@@ -28,9 +28,13 @@
 #ifndef SRC_TINT_LANG_CORE_IR_VALUE_H_
 #define SRC_TINT_LANG_CORE_IR_VALUE_H_
 
+#include <memory>
+
 #include "src/tint/lang/core/type/type.h"
-#include "src/tint/utils/containers/hashset.h"
+#include "src/tint/utils/containers/hashmap.h"
+#include "src/tint/utils/containers/vector.h"
 #include "src/tint/utils/rtti/castable.h"
+#include "src/tint/utils/traits/traits.h"
 
 // Forward declarations
 namespace tint::core::ir {
@@ -58,6 +62,21 @@ struct Usage {
     }
 };
 
+/// @param out the stream to write to
+/// @param usage the Usage
+/// @returns @p out so calls can be chained
+template <typename STREAM, typename = traits::EnableIfIsOStream<STREAM>>
+auto& operator<<(STREAM& out, const Usage& usage) {
+    return out << "Usage{" << static_cast<const void*>(usage.instruction) << ", "
+               << usage.operand_index << "}";
+}
+
+/// The list of usages of a Value.
+/// Most values are used by very few instructions, so the usages are held in a small inline vector
+/// instead of a hash set, which keeps the values compact in memory. Each usage appears at most
+/// once.
+using UsageList = Vector<Usage, 2>;
+
 /// Value in the IR.
 class Value : public Castable<Value> {
   public:
@@ -79,29 +98,29 @@ class Value : public Castable<Value> {
     bool Alive() const { return !flags_.Contains(Flag::kDead); }
 
     /// Adds a usage of this value.
+    /// Unlike a set, the usage list does not ignore duplicates, so @p u must not already be a
+    /// usage of this value.
     /// @param u the usage
-    void AddUsage(Usage u) { uses_.Add(u); }
+    void AddUsage(Usage u);
 
     /// Remove a usage of this value.
     /// @param u the usage
-    void RemoveUsage(Usage u) { uses_.Remove(u); }
+    void RemoveUsage(Usage u);
 
-    /// @returns the set of usages of this value. An instruction may appear multiple times if it
-    /// uses the value for multiple different operands.
-    const Hashset<Usage, 4>& Usages() { return uses_; }
+    /// @returns the list of usages of this value, in no particular order. An instruction may
+    /// appear multiple times if it uses the value for multiple different operands.
+    const UsageList& Usages() { return uses_; }
 
     /// @returns true if this Value has any usages
     bool IsUsed() const { return !uses_.IsEmpty(); }
 
     /// @returns the number of usages of this Value
-    size_t NumUsages() const { return uses_.Count(); }
+    size_t NumUsages() const { return uses_.Length(); }
 
     /// @returns true if the usages contains the instruction and operand index pair.
     /// @param instruction the instruction
     /// @param operand_index the in
-    bool HasUsage(const Instruction* instruction, size_t operand_index) const {
-        return uses_.Contains(Usage{const_cast<Instruction*>(instruction), operand_index});
-    }
+    bool HasUsage(const Instruction* instruction, size_t operand_index) const;
 
     /// Apply a function to all uses of the value that exist prior to calling this method.
     /// @param func the function will be applied to each use
@@ -126,7 +145,15 @@ class Value : public Castable<Value> {
         kDead,
     };
 
-    Hashset<Usage, 4> uses_;
+    /// The number of usages above which #use_indices_ is built.
+    static constexpr size_t kMaxUnindexedUsages = 16;
+
+    UsageList uses_;
+
+    /// Map of usage to its index in #uses_, so that RemoveUsage() does not need to search the
+    /// usages of heavily used values. Only built once the value has more than
+    /// kMaxUnindexedUsages usages.
+    std::unique_ptr<Hashmap<Usage, uint32_t, 0>> use_indices_;
 
     /// Bitset of value flags
     tint::EnumSet<Flag> flags_;
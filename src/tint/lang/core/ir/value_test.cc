@@ -59,6 +59,45 @@ TEST_F(IR_ValueTest, ReplaceAllUsesWith_Fn) {
     EXPECT_EQ(inst->LHS(), val_new);
 }
 
+TEST_F(IR_ValueTest, ReplaceAllUsesWith_ManyUses) {
+    auto* val_old = b.InstructionResult(ty.i32());
+    auto* val_new = b.InstructionResult(ty.i32());
+    Vector<CoreBinary*, 64> insts;
+    for (size_t i = 0; i < 64; i++) {
+        insts.Push(b.Add(mod.Types().i32(), val_old, val_old));
+    }
+    EXPECT_EQ(val_old->NumUsages(), 128u);
+    val_old->ReplaceAllUsesWith(val_new);
+    EXPECT_FALSE(val_old->IsUsed());
+    EXPECT_EQ(val_new->NumUsages(), 128u);
+    for (auto* inst : insts) {
+        EXPECT_EQ(inst->LHS(), val_new);
+        EXPECT_EQ(inst->RHS(), val_new);
+        EXPECT_TRUE(val_new->HasUsage(inst, 0u));
+        EXPECT_TRUE(val_new->HasUsage(inst, 1u));
+        EXPECT_FALSE(val_old->HasUsage(inst, 0u));
+    }
+}
+
+TEST_F(IR_ValueTest, RemoveUsage_ManyUses) {
+    auto* val = b.InstructionResult(ty.i32());
+    Vector<CoreBinary*, 64> insts;
+    for (size_t i = 0; i < 64; i++) {
+        insts.Push(b.Add(mod.Types().i32(), val, 1_i));
+    }
+    // Remove every other usage, in the order they were added.
+    for (size_t i = 0; i < insts.Length(); i += 2) {
+        insts[i]->Destroy();
+    }
+    EXPECT_EQ(val->NumUsages(), 32u);
+    for (size_t i = 0; i < insts.Length(); i++) {
+        EXPECT_EQ(val->HasUsage(insts[i], 0u), i % 2 == 1);
+    }
+    for (auto& use : val->Usages()) {
+        EXPECT_TRUE(val->HasUsage(use.instruction, use.operand_index));
+    }
+}
+
 TEST_F(IR_ValueTest, Destroy) {
     auto* val = b.InstructionResult(ty.i32());
     EXPECT_TRUE(val->Alive());
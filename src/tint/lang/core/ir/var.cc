@@ -77,8 +77,7 @@ void Var::DestroyIfOnlyAssigned() {
     auto* result = Result(0);
     if (result->Usages().All([](const Usage& u) { return u.instruction->Is<ir::Store>(); })) {
         while (!result->Usages().IsEmpty()) {
-            auto& usage = *result->Usages().begin();
-            usage->instruction->Destroy();
+            result->Usages().Back().instruction->Destroy();
         }
         Destroy();
     }
@@ -147,10 +147,12 @@ SanitizedResult Sanitize(const Program& in,
     ast::transform::Manager manager;
     ast::transform::DataMap data;
 
-    manager.Add<ast::transform::FoldConstants>();
-
+    // Disable the uniformity analysis first, so that it is not run again each time a transform
+    // resolves its output. The transforms are not required to preserve uniformity.
     manager.Add<ast::transform::DisableUniformityAnalysis>();
 
+    manager.Add<ast::transform::FoldConstants>();
+
     // ExpandCompoundAssignment must come before BuiltinPolyfill
     manager.Add<ast::transform::ExpandCompoundAssignment>();
 
@@ -67,6 +67,7 @@ tint_target_add_dependencies(tint_lang_hlsl_writer_raise lib
   tint_lang_hlsl_ir
   tint_lang_hlsl_writer_common
   tint_utils_containers
+  tint_utils_debug
   tint_utils_diagnostic
   tint_utils_ice
   tint_utils_id
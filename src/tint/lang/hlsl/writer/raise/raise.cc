@@ -50,6 +50,7 @@
 #include "src/tint/lang/hlsl/writer/raise/fxc_polyfill.h"
 #include "src/tint/lang/hlsl/writer/raise/promote_initializers.h"
 #include "src/tint/lang/hlsl/writer/raise/shader_io.h"
+#include "src/tint/utils/debug/phase_timer.h"
 #include "src/tint/utils/result/result.h"
 
 namespace tint::hlsl::writer {
@@ -57,6 +58,7 @@ namespace tint::hlsl::writer {
 Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
 #define RUN_TRANSFORM(name, ...)                   \
     do {                                           \
+        TINT_SCOPED_PASS_TIMER(#name);             \
         auto result = name(module, ##__VA_ARGS__); \
         if (result != Success) {                   \
             return result;                         \
@@ -70,6 +72,7 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
                                   array_length_from_uniform_options);
 
     {
+        TINT_SCOPED_PASS_TIMER("core::ir::transform::ArrayLengthFromUniform");
         auto result = core::ir::transform::ArrayLengthFromUniform(
             module,
             BindingPoint{array_length_from_uniform_options.ubo_binding.group,
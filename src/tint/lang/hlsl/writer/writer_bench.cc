@@ -28,8 +28,13 @@
 #include <string>
 
 #include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/hlsl/writer/raise/raise.h"
 #include "src/tint/lang/hlsl/writer/writer.h"
 
+#if TINT_BUILD_WGSL_READER
+#include "src/tint/lang/wgsl/reader/reader.h"
+#endif  // TINT_BUILD_WGSL_READER
+
 namespace tint::hlsl::writer {
 namespace {
 
@@ -49,5 +54,39 @@ void GenerateHLSL(benchmark::State& state, std::string input_name) {
 
 TINT_BENCHMARK_PROGRAMS(GenerateHLSL);
 
+#if TINT_BUILD_WGSL_READER
+/// Raises the IR of the program to the HLSL dialect. The program is converted to a fresh IR
+/// module for each iteration, with the timer paused. If tint was built with
+/// TINT_ENABLE_PHASE_TIMING, the average time spent in each pass of the raise pipeline per
+/// iteration is reported as a counter.
+void RaiseHLSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    PassTimings timings;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto ir = tint::wgsl::reader::ProgramToLoweredIR(res->program);
+        if (ir != Success) {
+            state.SkipWithError(ir.Failure().reason.Str());
+            return;
+        }
+        state.ResumeTiming();
+
+        PassTimingScope scope(timings);
+        auto raise_res = Raise(ir.Get(), {});
+        if (raise_res != Success) {
+            state.SkipWithError(raise_res.Failure().reason.Str());
+            return;
+        }
+    }
+    bench::ReportPassTimings(state, timings);
+}
+
+TINT_BENCHMARK_PROGRAMS(RaiseHLSL);
+#endif  // TINT_BUILD_WGSL_READER
+
 }  // namespace
 }  // namespace tint::hlsl::writer
@@ -161,6 +161,7 @@ tint_target_add_dependencies(tint_lang_msl_writer_bench bench
   tint_cmd_bench_bench
   tint_lang_core
   tint_lang_core_constant
+  tint_lang_core_ir
   tint_lang_core_type
   tint_lang_wgsl
   tint_lang_wgsl_ast
@@ -168,6 +169,7 @@ tint_target_add_dependencies(tint_lang_msl_writer_bench bench
   tint_lang_wgsl_program
   tint_lang_wgsl_sem
   tint_utils_containers
+  tint_utils_debug
   tint_utils_diagnostic
   tint_utils_ice
   tint_utils_id
@@ -191,9 +193,16 @@ if(TINT_BUILD_MSL_WRITER)
     tint_lang_msl_writer
     tint_lang_msl_writer_common
     tint_lang_msl_writer_helpers
+    tint_lang_msl_writer_raise
   )
 endif(TINT_BUILD_MSL_WRITER)
 
+if(TINT_BUILD_WGSL_READER)
+  tint_target_add_dependencies(tint_lang_msl_writer_bench bench
+    tint_lang_wgsl_reader
+  )
+endif(TINT_BUILD_WGSL_READER)
+
 endif(TINT_BUILD_MSL_WRITER)
 if(TINT_BUILD_MSL_WRITER)
 ################################################################################
@@ -66,6 +66,7 @@ tint_target_add_dependencies(tint_lang_msl_writer_raise lib
   tint_lang_msl_ir
   tint_lang_msl_type
   tint_utils_containers
+  tint_utils_debug
   tint_utils_diagnostic
   tint_utils_ice
   tint_utils_id
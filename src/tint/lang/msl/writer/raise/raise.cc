@@ -48,12 +48,14 @@
 #include "src/tint/lang/msl/writer/raise/builtin_polyfill.h"
 #include "src/tint/lang/msl/writer/raise/module_scope_vars.h"
 #include "src/tint/lang/msl/writer/raise/shader_io.h"
+#include "src/tint/utils/debug/phase_timer.h"
 
 namespace tint::msl::writer {
 
 Result<RaiseResult> Raise(core::ir::Module& module, const Options& options) {
 #define RUN_TRANSFORM(name, ...)                   \
     do {                                           \
+        TINT_SCOPED_PASS_TIMER(#name);             \
         auto result = name(module, ##__VA_ARGS__); \
         if (result != Success) {                   \
             return result.Failure();               \
@@ -103,14 +105,17 @@ Result<RaiseResult> Raise(core::ir::Module& module, const Options& options) {
 
     RUN_TRANSFORM(core::ir::transform::MultiplanarExternalTexture, multiplanar_map);
 
-    auto array_length_from_uniform_result = core::ir::transform::ArrayLengthFromUniform(
-        module, BindingPoint{0u, array_length_from_uniform_options.ubo_binding},
-        array_length_from_uniform_options.bindpoint_to_size_index);
-    if (array_length_from_uniform_result != Success) {
-        return array_length_from_uniform_result.Failure();
+    {
+        TINT_SCOPED_PASS_TIMER("core::ir::transform::ArrayLengthFromUniform");
+        auto array_length_from_uniform_result = core::ir::transform::ArrayLengthFromUniform(
+            module, BindingPoint{0u, array_length_from_uniform_options.ubo_binding},
+            array_length_from_uniform_options.bindpoint_to_size_index);
+        if (array_length_from_uniform_result != Success) {
+            return array_length_from_uniform_result.Failure();
+        }
+        raise_result.needs_storage_buffer_sizes =
+            array_length_from_uniform_result->needs_storage_buffer_sizes;
     }
-    raise_result.needs_storage_buffer_sizes =
-        array_length_from_uniform_result->needs_storage_buffer_sizes;
 
     if (!options.disable_workgroup_init) {
         RUN_TRANSFORM(core::ir::transform::ZeroInitWorkgroupMemory);
@@ -29,10 +29,15 @@
 
 #include "src/tint/cmd/bench/bench.h"
 #include "src/tint/lang/msl/writer/helpers/generate_bindings.h"
+#include "src/tint/lang/msl/writer/raise/raise.h"
 #include "src/tint/lang/msl/writer/writer.h"
 #include "src/tint/lang/wgsl/ast/module.h"
 #include "src/tint/lang/wgsl/sem/variable.h"
 
+#if TINT_BUILD_WGSL_READER
+#include "src/tint/lang/wgsl/reader/reader.h"
+#endif  // TINT_BUILD_WGSL_READER
+
 namespace tint::msl::writer {
 namespace {
 
@@ -74,5 +79,39 @@ void GenerateMSL(benchmark::State& state, std::string input_name) {
 
 TINT_BENCHMARK_PROGRAMS(GenerateMSL);
 
+#if TINT_BUILD_WGSL_READER
+/// Raises the IR of the program to the MSL dialect. The program is converted to a fresh IR
+/// module for each iteration, with the timer paused. If tint was built with
+/// TINT_ENABLE_PHASE_TIMING, the average time spent in each pass of the raise pipeline per
+/// iteration is reported as a counter.
+void RaiseMSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    PassTimings timings;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto ir = tint::wgsl::reader::ProgramToLoweredIR(res->program);
+        if (ir != Success) {
+            state.SkipWithError(ir.Failure().reason.Str());
+            return;
+        }
+        state.ResumeTiming();
+
+        PassTimingScope scope(timings);
+        auto raise_res = Raise(ir.Get(), {});
+        if (raise_res != Success) {
+            state.SkipWithError(raise_res.Failure().reason.Str());
+            return;
+        }
+    }
+    bench::ReportPassTimings(state, timings);
+}
+
+TINT_BENCHMARK_PROGRAMS(RaiseMSL);
+#endif  // TINT_BUILD_WGSL_READER
+
 }  // namespace
 }  // namespace tint::msl::writer
@@ -193,6 +193,7 @@ tint_target_add_dependencies(tint_lang_spirv_writer_bench bench
   tint_lang_wgsl_program
   tint_lang_wgsl_sem
   tint_utils_containers
+  tint_utils_debug
   tint_utils_diagnostic
   tint_utils_ice
   tint_utils_id
@@ -215,6 +216,7 @@ if(TINT_BUILD_SPV_WRITER)
   tint_target_add_dependencies(tint_lang_spirv_writer_bench bench
     tint_lang_spirv_writer
     tint_lang_spirv_writer_common
+    tint_lang_spirv_writer_raise
   )
 endif(TINT_BUILD_SPV_WRITER)
 
@@ -65,6 +65,10 @@ SanitizedResult Sanitize(const Program& in, const Options& options) {
     ast::transform::Manager manager;
     ast::transform::DataMap data;
 
+    // Disable the uniformity analysis first, so that it is not run again each time a transform
+    // resolves its output. The transforms are not required to preserve uniformity.
+    manager.Add<ast::transform::DisableUniformityAnalysis>();
+
     manager.Add<ast::transform::FoldConstants>();
 
     if (options.clamp_frag_depth) {
@@ -73,8 +77,6 @@ SanitizedResult Sanitize(const Program& in, const Options& options) {
             ast::transform::ClampFragDepth::RangeOffsets{0, 4});
     }
 
-    manager.Add<ast::transform::DisableUniformityAnalysis>();
-
     // ExpandCompoundAssignment must come before BuiltinPolyfill
     manager.Add<ast::transform::ExpandCompoundAssignment>();
 
@@ -35,6 +35,7 @@
 #include "src/tint/lang/core/access.h"
 #include "src/tint/lang/core/address_space.h"
 #include "src/tint/lang/core/builtin_value.h"
+#include "src/tint/lang/core/constant/dense_composite.h"
 #include "src/tint/lang/core/constant/scalar.h"
 #include "src/tint/lang/core/constant/splat.h"
 #include "src/tint/lang/core/constant/value.h"
@@ -436,8 +437,10 @@ class Printer {
                 [&](const core::type::Array* arr) {
                     TINT_ASSERT(arr->ConstantCount());
                     OperandList operands = {Type(ty), id};
+                    bool dense = constant->Is<core::constant::DenseComposite>();
                     for (uint32_t i = 0; i < arr->ConstantCount(); i++) {
-                        operands.push_back(Constant(constant->Index(i)));
+                        auto* el = constant->Index(i);
+                        operands.push_back(Constant(dense ? InternDenseElement(el) : el));
                     }
                     module_.PushType(spv::Op::OpConstantComposite, operands);
                 },
@@ -453,6 +456,24 @@ class Printer {
         });
     }
 
+    /// The elements of a core::constant::DenseComposite are views that are not interned by the
+    /// constant manager. InternDenseElement() returns the interned equivalent of `el`, so that equal
+    /// constants share a single result ID.
+    /// @param el the element of the dense composite
+    /// @returns the interned constant equal to `el`
+    const core::constant::Value* InternDenseElement(const core::constant::Value* el) {
+        if (el->Type()->Is<core::type::Scalar>()) {
+            core::constant::CloneContext ctx{{{nullptr}, {nullptr, &ir_.Types()}},
+                                             ir_.constant_values};
+            return el->Clone(ctx);
+        }
+        Vector<const core::constant::Value*, 16> elements;
+        for (size_t i = 0, n = el->NumElements(); i < n; i++) {
+            elements.Push(InternDenseElement(el->Index(i)));
+        }
+        return ir_.constant_values.Composite(el->Type(), std::move(elements));
+    }
+
     /// Get the result ID of the OpConstantNull instruction for `type`, emitting it if necessary.
     /// @param type the type to get the ID for
     /// @returns the result ID of the OpConstantNull instruction
@@ -796,7 +817,7 @@ class Printer {
             // Determine if this IO variable is used by the entry point.
             bool used = false;
             for (const auto& use : var->Result(0)->Usages()) {
-                auto* block = use->instruction->Block();
+                auto* block = use.instruction->Block();
                 while (block->Parent()) {
                     block = block->Parent()->Block();
                 }
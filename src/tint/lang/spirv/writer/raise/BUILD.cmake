@@ -73,6 +73,7 @@ tint_target_add_dependencies(tint_lang_spirv_writer_raise lib
   tint_lang_spirv_ir
   tint_lang_spirv_type
   tint_utils_containers
+  tint_utils_debug
   tint_utils_diagnostic
   tint_utils_ice
   tint_utils_id
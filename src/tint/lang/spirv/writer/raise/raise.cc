@@ -53,12 +53,14 @@
 #include "src/tint/lang/spirv/writer/raise/pass_matrix_by_pointer.h"
 #include "src/tint/lang/spirv/writer/raise/shader_io.h"
 #include "src/tint/lang/spirv/writer/raise/var_for_dynamic_index.h"
+#include "src/tint/utils/debug/phase_timer.h"
 
 namespace tint::spirv::writer {
 
 Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
 #define RUN_TRANSFORM(name, ...)         \
     do {                                 \
+        TINT_SCOPED_PASS_TIMER(#name);   \
         auto result = name(__VA_ARGS__); \
         if (result != Success) {         \
             return result;               \
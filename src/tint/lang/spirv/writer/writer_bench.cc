@@ -28,6 +28,7 @@
 #include <string>
 
 #include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/spirv/writer/raise/raise.h"
 #include "src/tint/lang/spirv/writer/writer.h"
 
 #if TINT_BUILD_WGSL_READER
@@ -84,8 +85,43 @@ void GenerateSPIRV_UseIR(benchmark::State& state, std::string input_name) {
 #endif  // TINT_BUILD_WGSL_READER
 }
 
+/// Raises the IR of the program to the SPIR-V dialect. The program is converted to a fresh IR
+/// module for each iteration, with the timer paused. If tint was built with
+/// TINT_ENABLE_PHASE_TIMING, the average time spent in each pass of the raise pipeline per
+/// iteration is reported as a counter.
+void RaiseSPIRV(benchmark::State& state, std::string input_name) {
+#if TINT_BUILD_WGSL_READER
+    auto res = bench::LoadProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    PassTimings timings;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto ir = tint::wgsl::reader::ProgramToLoweredIR(res->program);
+        if (ir != Success) {
+            state.SkipWithError(ir.Failure().reason.Str());
+            return;
+        }
+        state.ResumeTiming();
+
+        PassTimingScope scope(timings);
+        auto raise_res = Raise(ir.Get(), {});
+        if (raise_res != Success) {
+            state.SkipWithError(raise_res.Failure().reason.Str());
+            return;
+        }
+    }
+    bench::ReportPassTimings(state, timings);
+#else
+#error "WGSL Reader is required to build IR generator"
+#endif  // TINT_BUILD_WGSL_READER
+}
+
 TINT_BENCHMARK_PROGRAMS(GenerateSPIRV);
 TINT_BENCHMARK_PROGRAMS(GenerateSPIRV_UseIR);
+TINT_BENCHMARK_PROGRAMS(RaiseSPIRV);
 
 }  // namespace
 }  // namespace tint::spirv::writer
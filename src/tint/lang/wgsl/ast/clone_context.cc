@@ -39,6 +39,9 @@ CloneContext::CloneContext(ast::Builder* to, GenerationID from) : dst(to), src_i
 CloneContext::~CloneContext() = default;
 
 Symbol CloneContext::Clone(Symbol s) {
+    if (symbols_shared_) {
+        return Symbol{s.value(), dst->ID(), s.NameView()};
+    }
     return cloned_symbols_.GetOrAdd(s, [&]() -> Symbol {
         if (symbol_transform_) {
             return symbol_transform_(s);
@@ -47,6 +50,15 @@ Symbol CloneContext::Clone(Symbol s) {
     });
 }
 
+void CloneContext::CloneSymbols(const SymbolTable& symbols) {
+    TINT_ASSERT_GENERATION_IDS_EQUAL_IF_VALID(src_id, symbols);
+    if (!symbol_transform_ && cloned_symbols_.IsEmpty() && dst->Symbols().Share(symbols)) {
+        symbols_shared_ = true;
+        return;
+    }
+    symbols.Foreach([&](Symbol s) { Clone(s); });
+}
+
 ast::FunctionList CloneContext::Clone(const ast::FunctionList& v) {
     ast::FunctionList out;
     out.Reserve(v.Length());
@@ -72,13 +84,15 @@ const ast::Node* CloneContext::CloneNode(const ast::Node* node) {
     }
 
     // Attempt to clone using the registered replacer functions.
-    auto& typeinfo = node->TypeInfo();
-    for (auto& transform : transforms_) {
-        if (typeinfo.Is(transform.typeinfo)) {
-            if (auto* transformed = transform.function(node)) {
-                return transformed;
+    if (!transforms_.IsEmpty()) {
+        auto& typeinfo = node->TypeInfo();
+        for (auto& transform : transforms_) {
+            if (typeinfo.Is(transform.typeinfo)) {
+                if (auto* transformed = transform.function(node)) {
+                    return transformed;
+                }
+                break;
             }
-            break;
         }
     }
 
@@ -140,6 +140,15 @@ class CloneContext {
     /// @return the cloned source
     Symbol Clone(Symbol s);
 
+    /// Clones all the symbols of @p symbols into #dst.
+    ///
+    /// If #dst has no symbols and no SymbolTransform has been registered, then the symbol table
+    /// of #dst shares the symbols of @p symbols, and each symbol is cloned to the symbol of #dst
+    /// with the same value and name, without a map lookup.
+    ///
+    /// @param symbols the symbol table of the source program
+    void CloneSymbols(const SymbolTable& symbols);
+
     /// Clones each of the elements of the vector `v` into the Builder
     /// #dst.
     ///
@@ -593,6 +602,9 @@ class CloneContext {
 
     /// Symbol transform registered with ReplaceAll()
     SymbolTransform symbol_transform_;
+
+    /// True if #dst shares the symbols of the source program. See CloneSymbols().
+    bool symbols_shared_ = false;
 };
 
 }  // namespace tint::ast
@@ -0,0 +1,137 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <chrono>
+#include <string>
+
+#include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/wgsl/ast/transform/add_block_attribute.h"
+#include "src/tint/lang/wgsl/ast/transform/add_empty_entry_point.h"
+#include "src/tint/lang/wgsl/ast/transform/builtin_polyfill.h"
+#include "src/tint/lang/wgsl/ast/transform/canonicalize_entry_point_io.h"
+#include "src/tint/lang/wgsl/ast/transform/demote_to_helper.h"
+#include "src/tint/lang/wgsl/ast/transform/direct_variable_access.h"
+#include "src/tint/lang/wgsl/ast/transform/disable_uniformity_analysis.h"
+#include "src/tint/lang/wgsl/ast/transform/expand_compound_assignment.h"
+#include "src/tint/lang/wgsl/ast/transform/fold_constants.h"
+#include "src/tint/lang/wgsl/ast/transform/manager.h"
+#include "src/tint/lang/wgsl/ast/transform/preserve_padding.h"
+#include "src/tint/lang/wgsl/ast/transform/promote_side_effects_to_decl.h"
+#include "src/tint/lang/wgsl/ast/transform/remove_phonies.h"
+#include "src/tint/lang/wgsl/ast/transform/remove_unreachable_statements.h"
+#include "src/tint/lang/wgsl/ast/transform/robustness.h"
+#include "src/tint/lang/wgsl/ast/transform/simplify_pointers.h"
+#include "src/tint/lang/wgsl/ast/transform/std140.h"
+#include "src/tint/lang/wgsl/ast/transform/unshadow.h"
+#include "src/tint/lang/wgsl/ast/transform/vectorize_scalar_matrix_initializers.h"
+#include "src/tint/lang/wgsl/ast/transform/zero_init_workgroup_memory.h"
+#include "src/tint/utils/debug/phase_timer.h"
+
+namespace tint::ast::transform {
+namespace {
+
+/// Adds to @p manager the backend-agnostic transforms of the SPIR-V AST sanitizer, in the same
+/// order, and their configuration to @p data.
+void AddSanitizerTransforms(Manager& manager, DataMap& data) {
+    manager.Add<DisableUniformityAnalysis>();
+    manager.Add<FoldConstants>();
+    manager.Add<ExpandCompoundAssignment>();
+    manager.Add<PreservePadding>();
+    manager.Add<Unshadow>();
+    manager.Add<RemoveUnreachableStatements>();
+    manager.Add<PromoteSideEffectsToDecl>();
+    manager.Add<SimplifyPointers>();
+    manager.Add<RemovePhonies>();
+    manager.Add<VectorizeScalarMatrixInitializers>();
+
+    manager.Add<Robustness>();
+    data.Add<Robustness::Config>(Robustness::Config{});
+
+    BuiltinPolyfill::Builtins polyfills;
+    polyfills.bitshift_modulo = true;
+    polyfills.clamp_int = true;
+    polyfills.count_leading_zeros = true;
+    polyfills.count_trailing_zeros = true;
+    polyfills.first_leading_bit = true;
+    polyfills.first_trailing_bit = true;
+    polyfills.int_div_mod = true;
+    polyfills.saturate = true;
+    polyfills.workgroup_uniform_load = true;
+    data.Add<BuiltinPolyfill::Config>(polyfills);
+    manager.Add<BuiltinPolyfill>();
+
+    manager.Add<ZeroInitWorkgroupMemory>();
+
+    DirectVariableAccess::Options dva;
+    dva.transform_private = true;
+    dva.transform_function = true;
+    data.Add<DirectVariableAccess::Config>(dva);
+    manager.Add<DirectVariableAccess>();
+
+    data.Add<CanonicalizeEntryPointIO::Config>(CanonicalizeEntryPointIO::ShaderStyle::kSpirv);
+    manager.Add<CanonicalizeEntryPointIO>();
+    manager.Add<AddEmptyEntryPoint>();
+    manager.Add<AddBlockAttribute>();
+    manager.Add<DemoteToHelper>();
+    manager.Add<Std140>();
+}
+
+/// Runs the sanitizer transform chain on the program. Loading the program is not timed.
+/// If tint is built with TINT_ENABLE_PHASE_TIMING, the average time spent in each compile phase
+/// of the resolves made by the chain is reported per iteration as a counter.
+void TransformChain(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    PhaseTimings timings;
+    for (auto _ : state) {
+        PhaseTimingScope scope(timings);
+        Manager manager;
+        DataMap inputs;
+        DataMap outputs;
+        AddSanitizerTransforms(manager, inputs);
+        auto program = manager.Run(res->program, inputs, outputs);
+        if (!program.IsValid()) {
+            state.SkipWithError(program.Diagnostics().Str());
+        }
+    }
+    if (PhaseTimings::kEnabled) {
+        for (size_t i = 0; i < kNumCompilePhases; i++) {
+            auto phase = static_cast<CompilePhase>(i);
+            std::chrono::duration<double, std::micro> us = timings.Get(phase);
+            state.counters[std::string(ToString(phase)) + "_us"] =
+                benchmark::Counter(us.count(), benchmark::Counter::kAvgIterations);
+        }
+    }
+}
+
+TINT_BENCHMARK_PROGRAMS(TransformChain);
+
+}  // namespace
+}  // namespace tint::ast::transform
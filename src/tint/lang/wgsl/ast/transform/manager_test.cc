@@ -30,6 +30,7 @@
 #include <string>
 
 #include "gtest/gtest.h"
+#include "src/tint/lang/wgsl/ast/transform/disable_uniformity_analysis.h"
 #include "src/tint/lang/wgsl/ast/transform/transform.h"
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
@@ -38,6 +39,8 @@
 namespace tint::ast::transform {
 namespace {
 
+using namespace tint::core::number_suffixes;  // NOLINT
+
 using TransformManagerTest = testing::Test;
 
 class AST_NoOp final : public ast::transform::Transform {
@@ -56,6 +59,19 @@ class AST_AddFunction final : public ast::transform::Transform {
     }
 };
 
+class AST_AddNonUniformBarrier final : public ast::transform::Transform {
+    ApplyResult Apply(const Program& src, const DataMap&, DataMap&) const override {
+        ProgramBuilder b;
+        program::CloneContext ctx{&b, &src};
+        b.GlobalVar("rw", b.ty.i32(), core::AddressSpace::kStorage, core::Access::kReadWrite,
+                    b.Group(0_a), b.Binding(0_a));
+        b.Func(b.Sym("barrier_func"), {}, b.ty.void_(),
+               Vector{b.If(b.Equal("rw", 0_i), b.Block(b.CallStmt(b.Call("workgroupBarrier"))))});
+        ctx.Clone();
+        return resolver::Resolve(b);
+    }
+};
+
 Program MakeAST() {
     ProgramBuilder b;
     b.Func(b.Sym("main"), {}, b.ty.void_(), {});
@@ -77,5 +93,38 @@ TEST_F(TransformManagerTest, AST_AlwaysClone) {
     EXPECT_EQ(result.AST().Functions()[0]->name->symbol.Name(), "main");
 }
 
+// Test that the output of the transforms is checked for uniformity by default.
+TEST_F(TransformManagerTest, AST_UniformityAnalysisByDefault) {
+    Program ast = MakeAST();
+
+    Manager manager;
+    DataMap outputs;
+    manager.Add<AST_AddNonUniformBarrier>();
+    manager.Add<AST_AddFunction>();
+
+    auto result = manager.Run(ast, {}, outputs);
+    EXPECT_FALSE(result.IsValid());
+    EXPECT_NE(result.Diagnostics().Str().find(
+                  "'workgroupBarrier' must only be called from uniform control flow"),
+              std::string::npos)
+        << result.Diagnostics();
+}
+
+// Test that the transforms that come after DisableUniformityAnalysis are not required to preserve
+// uniformity, as their output is resolved without the uniformity analysis.
+TEST_F(TransformManagerTest, AST_DisableUniformityAnalysisFirst) {
+    Program ast = MakeAST();
+
+    Manager manager;
+    DataMap outputs;
+    manager.Add<DisableUniformityAnalysis>();
+    manager.Add<AST_AddNonUniformBarrier>();
+    manager.Add<AST_AddFunction>();
+
+    auto result = manager.Run(ast, {}, outputs);
+    EXPECT_TRUE(result.IsValid()) << result.Diagnostics();
+    EXPECT_EQ(result.AST().Functions().Length(), 3u);
+}
+
 }  // namespace
 }  // namespace tint::ast::transform
@@ -26,6 +26,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <string_view>
+#include "src/tint/lang/core/constant/dense_composite.h"
 #include "src/tint/lang/core/constant/scalar.h"
 #include "src/tint/lang/core/constant/splat.h"
 #include "src/tint/lang/core/constant/value.h"
@@ -97,6 +98,16 @@ void PrintConstant(const core::constant::Value* val, StringStream& ss) {
                 PrintConstant(s->elements[i], ss);
             }
             ss << ")";
+        },
+        [&](const core::constant::DenseComposite* s) {
+            ss << s->Type()->FriendlyName() << "(";
+            for (size_t i = 0, n = s->NumElements(); i < n; i++) {
+                if (i > 0) {
+                    ss << ", ";
+                }
+                PrintConstant(s->Index(i), ss);
+            }
+            ss << ")";
         });
 }
 
@@ -95,21 +95,31 @@ if(TINT_BUILD_WGSL_READER)
 ################################################################################
 tint_add_target(tint_lang_wgsl_reader_test test
   lang/wgsl/reader/options_test.cc
+  lang/wgsl/reader/reader_test.cc
 )
 
 tint_target_add_dependencies(tint_lang_wgsl_reader_test test
+  tint_api_common
+  tint_lang_core
+  tint_lang_core_constant
+  tint_lang_core_type
   tint_lang_wgsl
+  tint_lang_wgsl_ast
   tint_lang_wgsl_common
   tint_lang_wgsl_features
+  tint_lang_wgsl_program
+  tint_lang_wgsl_sem
   tint_utils_containers
   tint_utils_diagnostic
   tint_utils_ice
+  tint_utils_id
   tint_utils_macros
   tint_utils_math
   tint_utils_memory
   tint_utils_reflection
   tint_utils_result
   tint_utils_rtti
+  tint_utils_symbol
   tint_utils_text
   tint_utils_traits
 )
@@ -170,6 +180,7 @@ tint_target_add_external_dependencies(tint_lang_wgsl_reader_bench bench
 if(TINT_BUILD_WGSL_READER)
   tint_target_add_dependencies(tint_lang_wgsl_reader_bench bench
     tint_lang_wgsl_reader
+    tint_lang_wgsl_reader_parser
   )
 endif(TINT_BUILD_WGSL_READER)
 
@@ -28,10 +28,18 @@
 #ifndef SRC_TINT_LANG_WGSL_READER_OPTIONS_H_
 #define SRC_TINT_LANG_WGSL_READER_OPTIONS_H_
 
+#include <cstdint>
+#include <string>
+
 #include "src/tint/lang/wgsl/common/allowed_features.h"
 #include "src/tint/lang/wgsl/common/validation_mode.h"
 #include "src/tint/utils/reflection/reflection.h"
 
+// Forward declarations
+namespace tint::resolver {
+class UniformityCache;
+}  // namespace tint::resolver
+
 namespace tint::wgsl::reader {
 
 /// Configuration options used for reading WGSL.
@@ -42,8 +50,34 @@ struct Options {
     /// The validation mode to use.
     ValidationMode mode = ValidationMode::kFull;
 
+    /// The maximum number of threads that the resolver may use to analyze independent functions
+    /// concurrently. The resolved program does not depend on the number of threads.
+    uint32_t max_resolver_threads = 1;
+
+    /// If non-empty, the name of the only entry point that will be used from the program. Module
+    /// scope declarations that are not reachable from this entry point are removed before the
+    /// program is resolved, so they are neither resolved nor validated. If the module has no
+    /// entry point with this name, or the module-scope declarations cannot be resolved, the
+    /// whole module is resolved.
+    std::string entry_point;
+
+    /// If true, then the whole module is resolved and validated even if #entry_point is set, so
+    /// the diagnostics are the same as when #entry_point is empty.
+    bool strict_entry_point_validation = false;
+
+    /// If non-null, the cache of functions that have passed uniformity analysis. Sharing a cache
+    /// between the programs of an application skips the analysis of the functions that they have in
+    /// common. The cache is not owned by the options.
+    resolver::UniformityCache* uniformity_cache = nullptr;
+
     /// Reflect the fields of this class so that it can be used by tint::ForeachField().
-    TINT_REFLECT(Options, allowed_features, mode);
+    TINT_REFLECT(Options,
+                 allowed_features,
+                 mode,
+                 max_resolver_threads,
+                 entry_point,
+                 strict_entry_point_validation,
+                 uniformity_cache);
 };
 
 }  // namespace tint::wgsl::reader
@@ -65,6 +65,7 @@ tint_target_add_dependencies(tint_lang_wgsl_reader_parser lib
   tint_lang_wgsl_resolver
   tint_lang_wgsl_sem
   tint_utils_containers
+  tint_utils_debug
   tint_utils_diagnostic
   tint_utils_ice
   tint_utils_id
@@ -27,6 +27,7 @@
 
 #include "src/tint/lang/wgsl/reader/parser/classify_template_args.h"
 
+#include <deque>
 #include <vector>
 
 #include "src/tint/utils/containers/vector.h"
@@ -38,25 +39,27 @@ namespace {
 
 /// If the token at index @p idx is a '>>', '>=' or '>>=', then the token is split into two, with
 /// the first being '>', otherwise MaybeSplit() will be a no-op.
-/// @param tokens the vector of tokens
+/// @param tokens the list of tokens
 /// @param idx the index of the token to (maybe) split
-void MaybeSplit(std::vector<Token>& tokens, size_t idx) {
-    Token* token = &tokens[idx];
-    switch (token->type()) {
+template <typename TOKENS>
+void MaybeSplit(TOKENS& tokens, size_t idx) {
+    Token& token = tokens[idx];
+    Token& next = tokens[idx + 1];
+    switch (token.type()) {
         case Token::Type::kShiftRight:  //  '>>'
-            TINT_ASSERT(token[1].type() == Token::Type::kPlaceholder);
-            token[0].SetType(Token::Type::kGreaterThan);
-            token[1].SetType(Token::Type::kGreaterThan);
+            TINT_ASSERT(next.type() == Token::Type::kPlaceholder);
+            token.SetType(Token::Type::kGreaterThan);
+            next.SetType(Token::Type::kGreaterThan);
             break;
         case Token::Type::kGreaterThanEqual:  //  '>='
-            TINT_ASSERT(token[1].type() == Token::Type::kPlaceholder);
-            token[0].SetType(Token::Type::kGreaterThan);
-            token[1].SetType(Token::Type::kEqual);
+            TINT_ASSERT(next.type() == Token::Type::kPlaceholder);
+            token.SetType(Token::Type::kGreaterThan);
+            next.SetType(Token::Type::kEqual);
             break;
         case Token::Type::kShiftRightEqual:  // '>>='
-            TINT_ASSERT(token[1].type() == Token::Type::kPlaceholder);
-            token[0].SetType(Token::Type::kGreaterThan);
-            token[1].SetType(Token::Type::kGreaterThanEqual);
+            TINT_ASSERT(next.type() == Token::Type::kPlaceholder);
+            token.SetType(Token::Type::kGreaterThan);
+            next.SetType(Token::Type::kGreaterThanEqual);
             break;
         default:
             break;
@@ -66,31 +69,41 @@ void MaybeSplit(std::vector<Token>& tokens, size_t idx) {
 }  // namespace
 
 void ClassifyTemplateArguments(std::vector<Token>& tokens) {
-    const size_t count = tokens.size();
-
-    // The current expression nesting depth.
-    // Each '(', '[' increments the depth.
-    // Each ')', ']' decrements the depth.
-    uint64_t expr_depth = 0;
-
-    // A stack of '<' tokens.
-    // Used to pair '<' and '>' tokens at the same expression depth.
-    struct StackEntry {
-        Token* token;         // A pointer to the opening '<' token
-        uint64_t expr_depth;  // The value of 'expr_depth' for the opening '<'
-    };
-    Vector<StackEntry, 16> stack;
-
-    for (size_t i = 0; i < count - 1; i++) {
-        switch (tokens[i].type()) {
+    TemplateArgumentClassifier classifier;
+    classifier.Classify(tokens, 0);
+}
+
+size_t TemplateArgumentClassifier::Classify(std::deque<Token>& tokens, size_t base) {
+    return ClassifyImpl(tokens, base);
+}
+
+size_t TemplateArgumentClassifier::Classify(std::vector<Token>& tokens, size_t base) {
+    return ClassifyImpl(tokens, base);
+}
+
+template <typename TOKENS>
+size_t TemplateArgumentClassifier::ClassifyImpl(TOKENS& tokens, size_t base) {
+    // The absolute index one past the last token in the window.
+    const size_t end = base + tokens.size();
+    auto token = [&](size_t idx) -> Token& { return tokens[idx - base]; };
+
+    // Each '(', '[' increments 'expr_depth_'.
+    // Each ')', ']' decrements 'expr_depth_'.
+    // 'stack_' is used to pair '<' and '>' tokens at the same expression depth.
+
+    // Classifying a token may require the token that follows it, so the last token of the window
+    // is left for the next call.
+    for (; next_ + 1 < end; next_++) {
+        const size_t i = next_;
+        switch (token(i).type()) {
             case Token::Type::kIdentifier:
             case Token::Type::kVar: {
-                auto& next = tokens[i + 1];
+                auto& next = token(i + 1);
                 if (next.type() == Token::Type::kLessThan) {
                     // ident '<'
                     // Push this '<' to the stack, along with the current nesting expr_depth.
-                    stack.Push(StackEntry{&tokens[i + 1], expr_depth});
-                    i++;  // Skip the '<'
+                    stack_.Push(StackEntry{i + 1, expr_depth_});
+                    next_++;  // Skip the '<'
                 }
                 break;
             }
@@ -98,30 +111,30 @@ void ClassifyTemplateArguments(std::vector<Token>& tokens) {
             case Token::Type::kShiftRight:        // '>>'
             case Token::Type::kGreaterThanEqual:  // '>='
             case Token::Type::kShiftRightEqual:   // '>>='
-                if (!stack.IsEmpty() && stack.Back().expr_depth == expr_depth) {
+                if (!stack_.IsEmpty() && stack_.Back().expr_depth == expr_depth_) {
                     // '<' and '>' at same expr_depth, and no terminating tokens in-between.
                     // Consider both as a template argument list.
-                    MaybeSplit(tokens, i);
-                    stack.Pop().token->SetType(Token::Type::kTemplateArgsLeft);
-                    tokens[i].SetType(Token::Type::kTemplateArgsRight);
+                    MaybeSplit(tokens, i - base);
+                    token(stack_.Pop().index).SetType(Token::Type::kTemplateArgsLeft);
+                    token(i).SetType(Token::Type::kTemplateArgsRight);
                 }
                 break;
 
             case Token::Type::kParenLeft:    // '('
             case Token::Type::kBracketLeft:  // '['
                 // Entering a nested expression
-                expr_depth++;
+                expr_depth_++;
                 break;
 
             case Token::Type::kParenRight:    // ')'
             case Token::Type::kBracketRight:  // ']'
                 // Exiting a nested expression
                 // Pop the stack until we return to the current expression expr_depth
-                while (!stack.IsEmpty() && stack.Back().expr_depth == expr_depth) {
-                    stack.Pop();
+                while (!stack_.IsEmpty() && stack_.Back().expr_depth == expr_depth_) {
+                    stack_.Pop();
                 }
-                if (expr_depth > 0) {
-                    expr_depth--;
+                if (expr_depth_ > 0) {
+                    expr_depth_--;
                 }
                 break;
 
@@ -131,8 +144,8 @@ void ClassifyTemplateArguments(std::vector<Token>& tokens) {
             case Token::Type::kColon:      // ':'
                 // Expression terminating tokens. No opening template list can hold these tokens, so
                 // clear the stack and expression depth.
-                expr_depth = 0;
-                stack.Clear();
+                expr_depth_ = 0;
+                stack_.Clear();
                 break;
 
             case Token::Type::kOrOr:    // '||'
@@ -140,8 +153,8 @@ void ClassifyTemplateArguments(std::vector<Token>& tokens) {
                 // Treat 'a < b || c > d' as a logical binary operator of two comparison operators
                 // instead of a single template argument 'b||c'.
                 // Use parentheses around 'b||c' to parse as a template argument list.
-                while (!stack.IsEmpty() && stack.Back().expr_depth == expr_depth) {
-                    stack.Pop();
+                while (!stack_.IsEmpty() && stack_.Back().expr_depth == expr_depth_) {
+                    stack_.Pop();
                 }
                 break;
 
@@ -149,6 +162,10 @@ void ClassifyTemplateArguments(std::vector<Token>& tokens) {
                 break;
         }
     }
+
+    // The oldest unpaired '<' may still become a template list opener. Tokens at and after
+    // 'next_' have not been classified yet, and may still be split.
+    return stack_.IsEmpty() ? next_ : stack_.Front().index;
 }
 
 }  // namespace tint::wgsl::reader
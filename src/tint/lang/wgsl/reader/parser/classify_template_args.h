@@ -28,14 +28,52 @@
 #ifndef SRC_TINT_LANG_WGSL_READER_PARSER_CLASSIFY_TEMPLATE_ARGS_H_
 #define SRC_TINT_LANG_WGSL_READER_PARSER_CLASSIFY_TEMPLATE_ARGS_H_
 
+#include <deque>
 #include <vector>
 
 #include "src/tint/lang/wgsl/reader/parser/token.h"
+#include "src/tint/utils/containers/vector.h"
 
 namespace tint::wgsl::reader {
 
+/// Classifies the '<' and '>' tokens of the entire token list as template argument list tokens,
+/// where appropriate, splitting '>>', '>=' and '>>=' tokens into their placeholders as required.
+/// @param tokens the token list, ending with an EOF or error token
 void ClassifyTemplateArguments(std::vector<Token>& tokens);
 
+/// TemplateArgumentClassifier performs the same classification as ClassifyTemplateArguments(), but
+/// incrementally, over a window of tokens that is appended to by a streaming lexer and has its
+/// front released by the parser as tokens are consumed.
+class TemplateArgumentClassifier {
+  public:
+    /// Classifies the tokens of @p tokens that have not yet been classified by a previous call.
+    /// @param tokens the token window. `tokens[0]` has the absolute index @p base.
+    /// @param base the absolute index of the first token in @p tokens
+    /// @returns the absolute index of the first token whose type may still be changed by a later
+    /// call to Classify(). All tokens before this index have their final type.
+    size_t Classify(std::deque<Token>& tokens, size_t base);
+
+    /// @copydoc Classify(std::deque<Token>&, size_t)
+    size_t Classify(std::vector<Token>& tokens, size_t base);
+
+  private:
+    template <typename TOKENS>
+    size_t ClassifyImpl(TOKENS& tokens, size_t base);
+
+    /// An entry of the '<' stack
+    struct StackEntry {
+        size_t index;         // The absolute index of the opening '<' token
+        uint64_t expr_depth;  // The value of 'expr_depth' for the opening '<'
+    };
+
+    /// The absolute index of the next token to classify
+    size_t next_ = 0;
+    /// The current expression nesting depth
+    uint64_t expr_depth_ = 0;
+    /// The stack of unpaired '<' tokens
+    Vector<StackEntry, 16> stack_;
+};
+
 }  // namespace tint::wgsl::reader
 
 #endif  // SRC_TINT_LANG_WGSL_READER_PARSER_CLASSIFY_TEMPLATE_ARGS_H_
@@ -25,6 +25,8 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <deque>
+
 #include "gmock/gmock.h"
 
 #include "src/tint/lang/wgsl/reader/parser/classify_template_args.h"
@@ -57,6 +59,33 @@ TEST_P(WGSLParserClassifyTemplateArgsTest, Classify) {
     EXPECT_THAT(types, testing::ContainerEq(params.tokens));
 }
 
+TEST_P(WGSLParserClassifyTemplateArgsTest, ClassifyIncremental) {
+    auto& params = GetParam();
+    Source::File file("", params.wgsl);
+    Lexer l(&file);
+    TemplateArgumentClassifier classifier;
+    std::deque<Token> window;
+    size_t base = 0;
+    std::vector<T> types;
+    while (true) {
+        window.emplace_back(l.NextToken());
+        if (window.back().IsEof() || window.back().IsError()) {
+            classifier.Classify(window, base);
+            break;
+        }
+        // Pop the tokens that have their final type from the front of the window.
+        size_t final_end = classifier.Classify(window, base);
+        for (; base < final_end; base++) {
+            types.push_back(window.front().type());
+            window.pop_front();
+        }
+    }
+    for (auto& t : window) {
+        types.push_back(t.type());
+    }
+    EXPECT_THAT(types, testing::ContainerEq(params.tokens));
+}
+
 INSTANTIATE_TEST_SUITE_P(NonTemplate,
                          WGSLParserClassifyTemplateArgsTest,
                          testing::ValuesIn(std::vector<Case>{
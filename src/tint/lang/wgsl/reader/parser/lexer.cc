@@ -27,6 +27,7 @@
 
 #include "src/tint/lang/wgsl/reader/parser/lexer.h"
 
+#include <array>
 #include <cctype>
 #include <charconv>
 #include <cmath>
@@ -39,10 +40,20 @@
 
 #include "src/tint/lang/core/fluent_types.h"
 #include "src/tint/lang/core/number.h"
+#include "src/tint/utils/debug/phase_timer.h"
 #include "src/tint/utils/ice/ice.h"
+#include "src/tint/utils/math/math.h"
 #include "src/tint/utils/strconv/parse_num.h"
 #include "src/tint/utils/text/unicode.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TINT_LEXER_SSE2 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define TINT_LEXER_NEON 1
+#endif
+
 using namespace tint::core::fluent_types;  // NOLINT
 
 namespace tint::wgsl::reader {
@@ -86,6 +97,175 @@ bool read_blankspace(std::string_view str,
     return true;
 }
 
+/// The kinds of ASCII character runs that can be scanned with ScanAscii()
+enum class AsciiRun {
+    /// ' ' and '\t'
+    kBlankspace,
+    /// 'a'-'z', 'A'-'Z', '0'-'9' and '_'
+    kIdentifier,
+};
+
+/// @returns true if @p c is a member of the character run @p RUN
+template <AsciiRun RUN>
+bool IsInAsciiRun(char c) {
+    if constexpr (RUN == AsciiRun::kBlankspace) {
+        return c == ' ' || c == '\t';
+    } else {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+               c == '_';
+    }
+}
+
+#if TINT_LEXER_SSE2
+/// @returns a 16-bit mask with a bit set for each byte of @p chunk in the character run @p RUN
+template <AsciiRun RUN>
+uint32_t AsciiRunMask(__m128i chunk) {
+    if constexpr (RUN == AsciiRun::kBlankspace) {
+        __m128i space = _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' '));
+        __m128i tab = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(space, tab)));
+    } else {
+        // SSE2 only has signed byte comparisons. Bias each byte so that the unsigned range test
+        // 'c - lo < n' becomes a signed 'c - lo - 128 < n - 128'.
+        auto in_range = [](__m128i bytes, char lo, char n) {
+            __m128i biased = _mm_add_epi8(bytes, _mm_set1_epi8(static_cast<char>(-128 - lo)));
+            return _mm_cmplt_epi8(biased, _mm_set1_epi8(static_cast<char>(-128 + n)));
+        };
+        // Setting bit 5 maps 'A'-'Z' onto 'a'-'z'.
+        __m128i lower = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+        __m128i alpha = in_range(lower, 'a', 26);
+        __m128i digit = in_range(chunk, '0', 10);
+        __m128i underscore = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_'));
+        return static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(alpha, digit), underscore)));
+    }
+}
+#elif TINT_LEXER_NEON
+/// @returns a 64-bit mask with a nibble set for each byte of @p chunk in the character run @p RUN
+template <AsciiRun RUN>
+uint64_t AsciiRunMask(uint8x16_t chunk) {
+    uint8x16_t match;
+    if constexpr (RUN == AsciiRun::kBlankspace) {
+        match = vorrq_u8(vceqq_u8(chunk, vdupq_n_u8(' ')), vceqq_u8(chunk, vdupq_n_u8('\t')));
+    } else {
+        uint8x16_t lower = vorrq_u8(chunk, vdupq_n_u8(0x20));
+        uint8x16_t alpha = vcltq_u8(vsubq_u8(lower, vdupq_n_u8('a')), vdupq_n_u8(26));
+        uint8x16_t digit = vcltq_u8(vsubq_u8(chunk, vdupq_n_u8('0')), vdupq_n_u8(10));
+        uint8x16_t underscore = vceqq_u8(chunk, vdupq_n_u8('_'));
+        match = vorrq_u8(vorrq_u8(alpha, digit), underscore);
+    }
+    // Narrow each 8-bit lane to a 4-bit nibble, as NEON has no equivalent of SSE2's movemask.
+    uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(match), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+#endif
+
+/// Counts the bytes of @p str, starting at @p start, that belong to the ASCII character run
+/// @p RUN. When SIMD is available, 16 bytes are classified at once, which greatly speeds up the
+/// common case of long ASCII identifiers and indentation.
+/// @returns the length of the run
+template <AsciiRun RUN>
+uint32_t ScanAscii(std::string_view str, size_t start) {
+    size_t i = start;
+#if TINT_LEXER_SSE2
+    for (; i + 16 <= str.size(); i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data() + i));
+        uint32_t mismatch = ~AsciiRunMask<RUN>(chunk) & 0xffff;
+        if (mismatch != 0) {
+            return static_cast<uint32_t>(i + tint::Log2(mismatch & (~mismatch + 1)) - start);
+        }
+    }
+#elif TINT_LEXER_NEON
+    for (; i + 16 <= str.size(); i += 16) {
+        uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(str.data() + i));
+        uint64_t mismatch = ~AsciiRunMask<RUN>(chunk);
+        if (mismatch != 0) {
+            return static_cast<uint32_t>(i + tint::Log2(mismatch & (~mismatch + 1)) / 4 - start);
+        }
+    }
+#endif
+    // Scalar fallback, and the tail of the string.
+    while (i < str.size() && IsInAsciiRun<RUN>(str[i])) {
+        i++;
+    }
+    return static_cast<uint32_t>(i - start);
+}
+
+/// A keyword and its token type
+struct Keyword {
+    /// The keyword string
+    std::string_view str;
+    /// The token type of the keyword
+    Token::Type type;
+};
+
+/// The WGSL keywords that are lexed as their own token type
+constexpr Keyword kKeywords[] = {
+    {"alias", Token::Type::kAlias},
+    {"break", Token::Type::kBreak},
+    {"case", Token::Type::kCase},
+    {"const", Token::Type::kConst},
+    {"const_assert", Token::Type::kConstAssert},
+    {"continue", Token::Type::kContinue},
+    {"continuing", Token::Type::kContinuing},
+    {"diagnostic", Token::Type::kDiagnostic},
+    {"discard", Token::Type::kDiscard},
+    {"default", Token::Type::kDefault},
+    {"else", Token::Type::kElse},
+    {"enable", Token::Type::kEnable},
+    {"fallthrough", Token::Type::kFallthrough},
+    {"false", Token::Type::kFalse},
+    {"fn", Token::Type::kFn},
+    {"for", Token::Type::kFor},
+    {"if", Token::Type::kIf},
+    {"let", Token::Type::kLet},
+    {"loop", Token::Type::kLoop},
+    {"override", Token::Type::kOverride},
+    {"return", Token::Type::kReturn},
+    {"requires", Token::Type::kRequires},
+    {"struct", Token::Type::kStruct},
+    {"switch", Token::Type::kSwitch},
+    {"true", Token::Type::kTrue},
+    {"var", Token::Type::kVar},
+    {"while", Token::Type::kWhile},
+    {"_", Token::Type::kUnderscore},
+};
+
+/// The number of slots in the keyword hash table
+constexpr size_t kKeywordTableSize = 64;
+
+/// @returns the slot of @p str in the keyword hash table.
+/// The hash function has been chosen to be collision free for kKeywords, which is verified below.
+constexpr size_t KeywordHash(std::string_view str) {
+    size_t second = str.size() > 1 ? static_cast<uint8_t>(str[1]) : 0;
+    return (str.size() + 3 * static_cast<uint8_t>(str[0]) + 6 * second +
+            static_cast<uint8_t>(str.back())) &
+           (kKeywordTableSize - 1);
+}
+
+/// @returns the keyword hash table, built from kKeywords
+constexpr std::array<Keyword, kKeywordTableSize> BuildKeywordTable() {
+    std::array<Keyword, kKeywordTableSize> table{};
+    for (auto& keyword : kKeywords) {
+        table[KeywordHash(keyword.str)] = keyword;
+    }
+    return table;
+}
+
+/// The perfect hash table of keywords. Empty slots have an empty string.
+constexpr std::array<Keyword, kKeywordTableSize> kKeywordTable = BuildKeywordTable();
+
+/// @returns true if every keyword of kKeywords has its own slot in kKeywordTable
+constexpr bool KeywordTableIsPerfect() {
+    for (auto& keyword : kKeywords) {
+        if (kKeywordTable[KeywordHash(keyword.str)].str != keyword.str) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(KeywordTableIsPerfect(), "KeywordHash() has collisions. Update the hash function.");
+
 uint32_t dec_value(char c) {
     if (c >= '0' && c <= '9') {
         return static_cast<uint32_t>(c - '0');
@@ -117,23 +297,33 @@ std::vector<Token> Lexer::Lex() {
     tokens.reserve(kDefaultListSize);
 
     while (true) {
-        tokens.emplace_back(next());
+        tokens.emplace_back(NextToken());
         if (tokens.back().IsEof() || tokens.back().IsError()) {
             break;
         }
-
-        // If the token can be split, we insert a placeholder element(s) into the stream to hold the
-        // split character.
-        size_t num_placeholders = tokens.back().NumPlaceholders();
-        for (size_t i = 0; i < num_placeholders; i++) {
-            auto src = tokens.back().source();
-            src.range.begin.column++;
-            tokens.emplace_back(Token::Type::kPlaceholder, src);
-        }
     }
     return tokens;
 }
 
+Token Lexer::NextToken() {
+    TINT_SCOPED_PHASE_TIMER(kLex);
+
+    // If the last token can be split, we insert placeholder element(s) into the stream to hold
+    // the split character.
+    if (pending_placeholders_ > 0) {
+        pending_placeholders_--;
+        last_source_.range.begin.column++;
+        return Token{Token::Type::kPlaceholder, last_source_};
+    }
+
+    Token token = next();
+    last_source_ = token.source();
+    if (!token.IsEof() && !token.IsError()) {
+        pending_placeholders_ = token.NumPlaceholders();
+    }
+    return token;
+}
+
 std::string_view Lexer::line() const {
     if (file_->content.lines.size() == 0) {
         static const char* empty_string = "";
@@ -265,6 +455,12 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
                 continue;
             }
 
+            // Fast path for runs of ASCII blankspace.
+            if (uint32_t n = ScanAscii<AsciiRun::kBlankspace>(line(), pos()); n > 0) {
+                advance(n);
+                continue;
+            }
+
             bool is_blankspace;
             uint32_t blankspace_size;
             if (!read_blankspace(line(), pos(), &is_blankspace, &blankspace_size)) {
@@ -298,12 +494,12 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
 std::optional<Token> Lexer::skip_comment() {
     if (matches(pos(), "//")) {
         // Line comment: ignore everything until the end of line.
-        while (!is_eol()) {
-            if (is_null()) {
-                return Token{Token::Type::kError, begin_source(), "null character found"};
-            }
-            advance();
+        auto rest = line().substr(pos());
+        if (auto null = rest.find('\0'); null != std::string_view::npos) {
+            advance(static_cast<uint32_t>(null));
+            return Token{Token::Type::kError, begin_source(), "null character found"};
         }
+        advance(static_cast<uint32_t>(rest.size()));
         return {};
     }
 
@@ -984,7 +1180,9 @@ std::optional<Token> Lexer::try_ident() {
     auto start = pos();
 
     // Must begin with an XID_Source unicode character, or underscore
-    {
+    if (char c = at(pos()); (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_') {
+        advance();
+    } else {
         auto* utf8 = reinterpret_cast<const uint8_t*>(&at(pos()));
         auto [code_point, n] = tint::utf8::Decode(utf8, length() - pos());
         if (n == 0) {
@@ -999,6 +1197,12 @@ std::optional<Token> Lexer::try_ident() {
     }
 
     while (!is_eol()) {
+        // Fast path for runs of ASCII identifier characters.
+        if (uint32_t n = ScanAscii<AsciiRun::kIdentifier>(line(), pos()); n > 0) {
+            advance(n);
+            continue;
+        }
+
         // Must continue with an XID_Continue unicode character
         auto* utf8 = reinterpret_cast<const uint8_t*>(&at(pos()));
         auto [code_point, n] = tint::utf8::Decode(utf8, line().size() - pos());
@@ -1210,89 +1414,12 @@ std::optional<Token> Lexer::try_punctuation() {
 }
 
 std::optional<Token::Type> Lexer::parse_keyword(std::string_view str) {
-    if (str == "alias") {
-        return Token::Type::kAlias;
-    }
-    if (str == "break") {
-        return Token::Type::kBreak;
-    }
-    if (str == "case") {
-        return Token::Type::kCase;
-    }
-    if (str == "const") {
-        return Token::Type::kConst;
-    }
-    if (str == "const_assert") {
-        return Token::Type::kConstAssert;
-    }
-    if (str == "continue") {
-        return Token::Type::kContinue;
-    }
-    if (str == "continuing") {
-        return Token::Type::kContinuing;
-    }
-    if (str == "diagnostic") {
-        return Token::Type::kDiagnostic;
-    }
-    if (str == "discard") {
-        return Token::Type::kDiscard;
-    }
-    if (str == "default") {
-        return Token::Type::kDefault;
-    }
-    if (str == "else") {
-        return Token::Type::kElse;
-    }
-    if (str == "enable") {
-        return Token::Type::kEnable;
-    }
-    if (str == "fallthrough") {
-        return Token::Type::kFallthrough;
-    }
-    if (str == "false") {
-        return Token::Type::kFalse;
-    }
-    if (str == "fn") {
-        return Token::Type::kFn;
-    }
-    if (str == "for") {
-        return Token::Type::kFor;
-    }
-    if (str == "if") {
-        return Token::Type::kIf;
-    }
-    if (str == "let") {
-        return Token::Type::kLet;
-    }
-    if (str == "loop") {
-        return Token::Type::kLoop;
-    }
-    if (str == "override") {
-        return Token::Type::kOverride;
-    }
-    if (str == "return") {
-        return Token::Type::kReturn;
-    }
-    if (str == "requires") {
-        return Token::Type::kRequires;
-    }
-    if (str == "struct") {
-        return Token::Type::kStruct;
-    }
-    if (str == "switch") {
-        return Token::Type::kSwitch;
-    }
-    if (str == "true") {
-        return Token::Type::kTrue;
-    }
-    if (str == "var") {
-        return Token::Type::kVar;
-    }
-    if (str == "while") {
-        return Token::Type::kWhile;
+    if (str.empty()) {
+        return std::nullopt;
     }
-    if (str == "_") {
-        return Token::Type::kUnderscore;
+    const Keyword& keyword = kKeywordTable[KeywordHash(str)];
+    if (keyword.str == str) {
+        return keyword.type;
     }
     return std::nullopt;
 }
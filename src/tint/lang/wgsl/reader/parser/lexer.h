@@ -46,6 +46,12 @@ class Lexer {
     /// @return the token list.
     std::vector<Token> Lex();
 
+    /// Lexes and returns the next token of the stream, without materializing the whole token
+    /// list. Splittable tokens are followed by their placeholder tokens, as with Lex(). Once an
+    /// EOF or error token has been returned, subsequent calls must not be made.
+    /// @return the next token
+    Token NextToken();
+
   private:
     /// Returns the next token in the input stream.
     /// @return Token
@@ -122,6 +128,10 @@ class Lexer {
     Source::File const* const file_;
     /// The current location within the input
     Source::Location location_;
+    /// The number of placeholder tokens still to be returned by NextToken()
+    size_t pending_placeholders_ = 0;
+    /// The source of the last token returned by NextToken()
+    Source last_source_;
 };
 
 }  // namespace tint::wgsl::reader
@@ -92,6 +92,19 @@ TEST_F(LexerTest, Skips_Blankspace_Basic) {
     }
 }
 
+TEST_F(LexerTest, Skips_Blankspace_LongRun) {
+    // Runs of blankspace longer than a SIMD chunk, ending in exotic blankspace.
+    Source::File file("", "  \t                                   \t  " kL2R "  ident  \t          ");
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(2u, list.size());
+    EXPECT_TRUE(list[0].IsIdentifier());
+    EXPECT_EQ(list[0].source().range.begin.column, 47u);
+    EXPECT_EQ(list[0].to_str(), "ident");
+    EXPECT_TRUE(list[1].IsEof());
+}
+
 TEST_F(LexerTest, Skips_Blankspace_Exotic) {
     Source::File file("",                              //
                       kVTab kFF kNL kLS kPS kL2R kR2L  //
@@ -637,7 +650,40 @@ INSTANTIATE_TEST_SUITE_P(LexerTest,
                                          "MiXeD_CaSe",
                                          "abcdefghijklmnopqrstuvwxyz",
                                          "ABCDEFGHIJKLMNOPQRSTUVWXYZ",
-                                         "alldigits_0123456789"));
+                                         "alldigits_0123456789",
+                                         "a_long_identifier_spanning_several_16_byte_chunks_0123",
+                                         "_0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTU"
+                                         "VWXYZ_"));
+
+TEST_F(LexerTest, IdentifierTest_LongAsciiRunThenUnicode) {
+    // The ASCII run is scanned in 16 byte chunks, which must stop at the first non-ASCII byte.
+    Source::File file("", "abcdefghijklmnopqrstuvwxyz\xce\xb1\xce\xb2z x");
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(3u, list.size());
+
+    auto& t = list[0];
+    EXPECT_TRUE(t.IsIdentifier());
+    EXPECT_EQ(t.source().range.begin.column, 1u);
+    EXPECT_EQ(t.source().range.end.column, 32u);
+    EXPECT_EQ(t.to_str(), "abcdefghijklmnopqrstuvwxyz\xce\xb1\xce\xb2z");
+    EXPECT_TRUE(list[1].IsIdentifier());
+    EXPECT_EQ(list[1].source().range.begin.column, 33u);
+}
+
+TEST_F(LexerTest, IdentifierTest_KeywordLookalikes) {
+    // Identifiers that are prefixes, extensions or hash neighbours of keywords.
+    for (auto* ident : {"f", "fnn", "tru", "truee", "constant", "aliaz", "v", "while_", "breaks",
+                        "a", "Fn", "LET", "forr", "_a"}) {
+        Source::File file("", ident);
+        Lexer l(&file);
+        auto list = l.Lex();
+        ASSERT_EQ(2u, list.size()) << ident;
+        EXPECT_TRUE(list[0].IsIdentifier()) << ident;
+        EXPECT_EQ(list[0].to_str(), ident);
+    }
+}
 
 struct UnicodeCase {
     const char* utf8;
@@ -27,6 +27,7 @@
 
 #include "src/tint/lang/wgsl/reader/parser/parser.h"
 
+#include <algorithm>
 #include <limits>
 #include <utility>
 
@@ -58,6 +59,7 @@
 #include "src/tint/lang/wgsl/reader/parser/classify_template_args.h"
 #include "src/tint/lang/wgsl/reader/parser/lexer.h"
 #include "src/tint/utils/containers/reverse.h"
+#include "src/tint/utils/debug/phase_timer.h"
 #include "src/tint/utils/macros/defer.h"
 #include "src/tint/utils/text/string.h"
 #include "src/tint/utils/text/string_stream.h"
@@ -271,68 +273,104 @@ void Parser::deprecated(const Source& source, std::string_view msg) {
 
 const Token& Parser::next() {
     // If the next token is already an error or the end of file, stay there.
-    if (tokens_[next_token_idx_].IsEof() || tokens_[next_token_idx_].IsError()) {
-        return tokens_[next_token_idx_];
+    if (token(next_token_idx_).IsEof() || token(next_token_idx_).IsError()) {
+        return token(next_token_idx_);
     }
 
     // Skip over any placeholder elements
     while (true) {
-        if (!tokens_[next_token_idx_].IsPlaceholder()) {
+        if (!token(next_token_idx_).IsPlaceholder()) {
             break;
         }
         next_token_idx_++;
     }
     last_source_idx_ = next_token_idx_;
 
-    if (!tokens_[next_token_idx_].IsEof() && !tokens_[next_token_idx_].IsError()) {
+    if (!token(next_token_idx_).IsEof() && !token(next_token_idx_).IsError()) {
         next_token_idx_++;
     }
-    return tokens_[last_source_idx_];
+    return token(last_source_idx_);
 }
 
 const Token& Parser::peek(size_t count) {
-    for (size_t idx = next_token_idx_; idx < tokens_.size(); idx++) {
-        if (tokens_[idx].IsPlaceholder()) {
+    for (size_t idx = next_token_idx_;; idx++) {
+        const Token& t = token(idx);
+        if (t.IsPlaceholder()) {
             continue;
         }
-        if (count == 0) {
-            return tokens_[idx];
+        // Walking off the end of the token list returns the last token.
+        if (count == 0 || t.IsEof() || t.IsError()) {
+            return t;
         }
         count--;
     }
-    // Walked off the end of the token list, return last token.
-    return tokens_[tokens_.size() - 1];
 }
 
 bool Parser::peek_is(Token::Type tok, size_t idx) {
     return peek(idx).Is(tok);
 }
 
+Token& Parser::token(size_t idx) {
+    while (idx >= tokens_final_end_ && lexer_) {
+        tokens_.emplace_back(lexer_->NextToken());
+        max_resident_tokens_ = std::max(max_resident_tokens_, tokens_.size());
+        if (tokens_.back().IsEof() || tokens_.back().IsError()) {
+            // The end of the stream. Everything that can be classified has its final type.
+            classifier_.Classify(tokens_, tokens_base_);
+            tokens_final_end_ = tokens_base_ + tokens_.size();
+            lexer_.reset();
+        } else {
+            tokens_final_end_ = classifier_.Classify(tokens_, tokens_base_);
+        }
+    }
+    return tokens_[std::min(idx, tokens_base_ + tokens_.size() - 1) - tokens_base_];
+}
+
+void Parser::release_consumed_tokens() {
+    // The last token returned by next() is kept for last_source() and split_token().
+    const size_t end = std::min(last_source_idx_, next_token_idx_);
+    while (tokens_base_ < end) {
+        tokens_.pop_front();
+        tokens_base_++;
+    }
+}
+
 void Parser::split_token(Token::Type lhs, Token::Type rhs) {
-    if (TINT_UNLIKELY(next_token_idx_ == 0)) {
+    if (TINT_UNLIKELY(next_token_idx_ <= tokens_base_)) {
         TINT_ICE() << "attempt to update placeholder at beginning of tokens";
     }
-    if (TINT_UNLIKELY(next_token_idx_ >= tokens_.size())) {
+    if (TINT_UNLIKELY(next_token_idx_ >= tokens_base_ + tokens_.size() && !lexer_)) {
         TINT_ICE() << "attempt to update placeholder past end of tokens";
     }
-    if (TINT_UNLIKELY(!tokens_[next_token_idx_].IsPlaceholder())) {
+    Token& placeholder = token(next_token_idx_);
+    if (TINT_UNLIKELY(!placeholder.IsPlaceholder())) {
         TINT_ICE() << "attempt to update non-placeholder token";
     }
-    tokens_[next_token_idx_ - 1].SetType(lhs);
-    tokens_[next_token_idx_].SetType(rhs);
+    token(next_token_idx_ - 1).SetType(lhs);
+    placeholder.SetType(rhs);
 }
 
 Source Parser::last_source() const {
-    return tokens_[last_source_idx_].source();
+    return tokens_[last_source_idx_ - tokens_base_].source();
 }
 
 void Parser::InitializeLex() {
-    Lexer l{file_};
-    tokens_ = l.Lex();
-    ClassifyTemplateArguments(tokens_);
+    lexer_ = std::make_unique<Lexer>(file_);
+    classifier_ = TemplateArgumentClassifier{};
+    tokens_.clear();
+    tokens_base_ = 0;
+    tokens_final_end_ = 0;
+    max_resident_tokens_ = 0;
+    next_token_idx_ = 0;
+    last_source_idx_ = 0;
+
+    // Lex the first token, so that last_source() is valid before the first call to next().
+    token(0);
 }
 
 bool Parser::Parse() {
+    TINT_SCOPED_PHASE_TIMER(kParse);
+
     InitializeLex();
     translation_unit();
     return !has_error();
@@ -343,6 +381,9 @@ bool Parser::Parse() {
 void Parser::translation_unit() {
     bool after_global_decl = false;
     while (continue_parsing()) {
+        // Tokens of previous declarations are no longer referenced.
+        release_consumed_tokens();
+
         auto& p = peek();
         if (p.IsEof()) {
             break;
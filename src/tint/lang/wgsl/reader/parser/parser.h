@@ -28,6 +28,7 @@
 #ifndef SRC_TINT_LANG_WGSL_READER_PARSER_PARSER_H_
 #define SRC_TINT_LANG_WGSL_READER_PARSER_PARSER_H_
 
+#include <deque>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -37,6 +38,7 @@
 
 #include "src/tint/lang/core/access.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
+#include "src/tint/lang/wgsl/reader/parser/classify_template_args.h"
 #include "src/tint/lang/wgsl/reader/parser/detail.h"
 #include "src/tint/lang/wgsl/reader/parser/token.h"
 #include "src/tint/lang/wgsl/resolver/resolve.h"
@@ -306,8 +308,8 @@ class Parser {
     explicit Parser(Source::File const* file);
     ~Parser();
 
-    /// Reads tokens from the source file. This will be called automatically
-    /// by |parse|.
+    /// Prepares the lexer to read tokens from the source file. Tokens are lexed on demand, as the
+    /// parser reads them. This will be called automatically by |parse|.
     void InitializeLex();
 
     /// Run the parser
@@ -353,6 +355,8 @@ class Parser {
     bool peek_is(Token::Type tok, size_t idx = 0);
     /// @returns the last source location that was returned by `next()`
     Source last_source() const;
+    /// @returns the largest number of tokens that were held in memory at once while parsing
+    size_t max_resident_tokens() const { return max_resident_tokens_; }
     /// Appends an error at `t` with the message `msg`
     /// @param t the token to associate the error with
     /// @param msg the error message
@@ -684,6 +688,17 @@ class Parser {
     /// @return the parsed diagnostic rule name.
     Expect<const ast::DiagnosticRuleName*> expect_diagnostic_rule_name();
 
+    /// Returns the token with the absolute index `idx`, lexing and classifying further tokens as
+    /// required. If `idx` is past the end of the token stream, then the final EOF or error token is
+    /// returned.
+    /// @param idx the absolute index of the token
+    /// @returns the token
+    Token& token(size_t idx);
+    /// Releases the tokens that have been consumed by `next()`, except for the last one.
+    /// References to released tokens become invalid, so this must only be called where no such
+    /// references are held.
+    void release_consumed_tokens();
+
     /// Splits a peekable token into to parts filling in the peekable fields.
     /// @param lhs the token to set in the current position
     /// @param rhs the token to set in the placeholder
@@ -911,7 +926,15 @@ class Parser {
     }
 
     Source::File const* const file_;
-    std::vector<Token> tokens_;
+    /// The lexer. Null before InitializeLex() and once the EOF or error token has been lexed.
+    std::unique_ptr<Lexer> lexer_;
+    TemplateArgumentClassifier classifier_;
+    /// The window of lexed tokens. `tokens_[0]` has the absolute index `tokens_base_`.
+    std::deque<Token> tokens_;
+    size_t tokens_base_ = 0;
+    /// The absolute index of the first token that may still be reclassified
+    size_t tokens_final_end_ = 0;
+    size_t max_resident_tokens_ = 0;
     size_t next_token_idx_ = 0;
     size_t last_source_idx_ = 0;
     bool synchronized_ = true;
@@ -25,7 +25,10 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <string>
+
 #include "src/tint/lang/wgsl/reader/parser/helper_test.h"
+#include "src/tint/lang/wgsl/reader/parser/lexer.h"
 
 namespace tint::wgsl::reader {
 namespace {
@@ -212,5 +215,26 @@ TEST_F(WGSLParserTest, Peek_AfterSplit) {
     EXPECT_TRUE(p->peek_is(Token::Type::kEqual)) << "expected: = got: " << p->peek().to_name();
 }
 
+TEST_F(WGSLParserTest, StreamsTokens) {
+    std::string wgsl;
+    for (int i = 0; i < 100; i++) {
+        auto n = std::to_string(i);
+        wgsl += "const c" + n + " : array<vec2<i32>, 2> = array(vec2(" + n + "), vec2(1));\n";
+        wgsl += "fn f" + n + "(a : vec4<f32>) -> f32 {\n";
+        wgsl += "  var b : vec2<u32> = vec2<u32>(1u >> 1u, 2u);\n";
+        wgsl += "  return a.x + f32(c" + n + "[0].x < 1 && b.y > 2);\n";
+        wgsl += "}\n";
+    }
+    Source::File file("", wgsl);
+    size_t num_tokens = Lexer(&file).Lex().size();
+
+    auto p = parser(wgsl);
+    ASSERT_TRUE(p->Parse()) << p->error();
+    EXPECT_EQ(p->program().AST().Functions().Length(), 100u);
+
+    // Only the tokens of a single declaration, plus lookahead, should be held at once.
+    EXPECT_LT(p->max_resident_tokens(), num_tokens / 50);
+}
+
 }  // namespace
 }  // namespace tint::wgsl::reader
@@ -30,12 +30,106 @@
 #include <limits>
 #include <utility>
 
+#include "src/tint/lang/wgsl/ast/clone_context.h"
+#include "src/tint/lang/wgsl/ast/function.h"
+#include "src/tint/lang/wgsl/ast/override.h"
 #include "src/tint/lang/wgsl/reader/lower/lower.h"
 #include "src/tint/lang/wgsl/reader/parser/parser.h"
 #include "src/tint/lang/wgsl/reader/program_to_ir/program_to_ir.h"
+#include "src/tint/lang/wgsl/resolver/dependency_graph.h"
 #include "src/tint/lang/wgsl/resolver/resolve.h"
+#include "src/tint/utils/containers/hashset.h"
+#include "src/tint/utils/rtti/switch.h"
 
 namespace tint::wgsl::reader {
+namespace {
+
+/// Replaces the program built by @p b with a program that only holds the module-scope declarations
+/// that are reachable from the entry point named @p entry_point, along with all the directives.
+/// Module-scope const assertions are kept if all the declarations that they reference are kept.
+/// All the `override` declarations are kept, along with the declarations that they reference, as
+/// the resolver allocates the IDs of overrides without an `@id` attribute in declaration order.
+/// @p b is left unchanged if the module has no entry point with that name, or if the dependency
+/// graph of the module cannot be built, so that the resolver reports the errors of the whole
+/// module.
+/// @param b the program builder holding the parsed module
+/// @param entry_point the name of the entry point
+void PruneToEntryPoint(ProgramBuilder& b, std::string_view entry_point) {
+    const ast::Function* ep = nullptr;
+    for (auto* func : b.AST().Functions()) {
+        if (func->IsEntryPoint() && func->name->symbol.NameView() == entry_point) {
+            ep = func;
+            break;
+        }
+    }
+    if (!ep) {
+        return;
+    }
+
+    diag::List diagnostics;
+    resolver::DependencyGraph graph;
+    if (!resolver::DependencyGraph::Build(b.AST(), diagnostics, graph)) {
+        return;
+    }
+
+    Hashset<const ast::Node*, 64> reachable;
+    Vector<const ast::Node*, 64> pending{ep};
+    reachable.Add(ep);
+    for (auto* decl : b.AST().GlobalVariables()) {
+        if (decl->Is<ast::Override>() && reachable.Add(decl)) {
+            pending.Push(decl);
+        }
+    }
+    while (!pending.IsEmpty()) {
+        auto* node = pending.Pop();
+        if (auto deps = graph.global_dependencies.Get(node)) {
+            for (auto* dep : *deps) {
+                if (reachable.Add(dep)) {
+                    pending.Push(dep);
+                }
+            }
+        }
+    }
+
+    auto& decls = b.AST().GlobalDeclarations();
+    Vector<const ast::Node*, 64> kept;
+    kept.Reserve(decls.Length());
+    for (auto* decl : decls) {
+        bool keep = Switch(
+            decl,  //
+            [&](const ast::DiagnosticDirective*) { return true; },
+            [&](const ast::Enable*) { return true; },
+            [&](const ast::Requires*) { return true; },
+            [&](const ast::ConstAssert*) {
+                if (auto deps = graph.global_dependencies.Get(decl)) {
+                    for (auto* dep : *deps) {
+                        if (!reachable.Contains(dep)) {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            },
+            [&](Default) { return reachable.Contains(decl); });
+        if (keep) {
+            kept.Push(decl);
+        }
+    }
+    if (kept.Length() == decls.Length()) {
+        return;  // Nothing to remove.
+    }
+
+    ProgramBuilder pruned;
+    ast::CloneContext ctx(&pruned, b.ID());
+    ctx.CloneSymbols(b.Symbols());
+    for (auto* decl : kept) {
+        pruned.AST().AddGlobalDeclaration(ctx.Clone(decl));
+    }
+    pruned.Diagnostics() = std::move(b.Diagnostics());
+    b = std::move(pruned);
+}
+
+}  // namespace
 
 Program Parse(const Source::File* file, const Options& options) {
     if (TINT_UNLIKELY(file->content.data.size() >
@@ -46,7 +140,12 @@ Program Parse(const Source::File* file, const Options& options) {
     }
     Parser parser(file);
     parser.Parse();
-    return resolver::Resolve(parser.builder(), options.allowed_features, options.mode);
+    if (!options.entry_point.empty() && !options.strict_entry_point_validation &&
+        !parser.builder().Diagnostics().ContainsErrors()) {
+        PruneToEntryPoint(parser.builder(), options.entry_point);
+    }
+    return resolver::Resolve(parser.builder(), options.allowed_features, options.mode,
+                             options.max_resolver_threads, options.uniformity_cache);
 }
 
 Result<core::ir::Module> WgslToIR(const Source::File* file, const Options& options) {
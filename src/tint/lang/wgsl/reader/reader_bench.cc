@@ -28,6 +28,8 @@
 #include <string>
 
 #include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/wgsl/reader/parser/lexer.h"
+#include "src/tint/lang/wgsl/reader/parser/parser.h"
 #include "src/tint/lang/wgsl/reader/reader.h"
 
 namespace tint::wgsl::reader {
@@ -49,5 +51,128 @@ void ParseWGSL(benchmark::State& state, std::string input_name) {
 
 TINT_BENCHMARK_PROGRAMS(ParseWGSL);
 
+/// Lexes the benchmark corpus, without parsing, reporting the lexing throughput in bytes of WGSL
+/// per second.
+void LexWGSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    auto& file = res.Get();
+    size_t num_tokens = 0;
+    for (auto _ : state) {
+        Lexer lexer(&file);
+        num_tokens = 0;
+        while (true) {
+            auto token = lexer.NextToken();
+            num_tokens++;
+            if (token.IsEof() || token.IsError()) {
+                break;
+            }
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * file.content.data.size()));
+    state.counters["tokens"] = static_cast<double>(num_tokens);
+}
+
+TINT_BENCHMARK_PROGRAMS(LexWGSL);
+
+/// @returns a generated WGSL shader with @p num_functions functions, each with a few template
+/// argument lists, shifts and comparisons to exercise the lexer and template classification.
+std::string GenerateLargeWGSL(int64_t num_functions) {
+    std::string wgsl;
+    for (int64_t i = 0; i < num_functions; i++) {
+        auto n = std::to_string(i);
+        wgsl += "const c" + n + " : array<vec4<f32>, 2> = array(vec4(" + n + ".0), vec4(1.0));\n";
+        wgsl += "fn f" + n + "(a : vec4<f32>, b : ptr<function, vec2<u32>>) -> f32 {\n";
+        wgsl += "  var m : mat4x4<f32> = mat4x4<f32>(a, a, a, c" + n + "[1]);\n";
+        wgsl += "  (*b).x = ((*b).y >> 2u) + (1u << 3u);\n";
+        wgsl += "  if (a.x < a.y && a.z > a.w) { return dot(m[0], a); }\n";
+        wgsl += "  return select(a.x, a.w, (*b).x >= 4u);\n";
+        wgsl += "}\n";
+    }
+    return wgsl;
+}
+
+/// Parses a large generated shader, reporting the parse throughput in bytes of WGSL per second and
+/// the largest number of tokens held in memory at once by the parser.
+void ParseWGSLLarge(benchmark::State& state) {
+    auto wgsl = GenerateLargeWGSL(state.range(0));
+    Source::File file("large.wgsl", wgsl);
+    size_t max_resident_tokens = 0;
+    for (auto _ : state) {
+        Parser parser(&file);
+        parser.Parse();
+        if (parser.has_error()) {
+            state.SkipWithError(parser.error());
+            return;
+        }
+        max_resident_tokens = parser.max_resident_tokens();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * wgsl.size()));
+    state.counters["source_bytes"] = static_cast<double>(wgsl.size());
+    state.counters["resident_tokens"] = static_cast<double>(max_resident_tokens);
+    state.counters["resident_token_bytes"] =
+        static_cast<double>(max_resident_tokens * sizeof(Token));
+}
+
+BENCHMARK(ParseWGSLLarge)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+/// @returns a generated WGSL shader with @p num_entry_points compute entry points, each calling a
+/// chain of helper functions that use their own module-scope constants and storage buffer.
+std::string GenerateManyEntryPointsWGSL(int64_t num_entry_points) {
+    std::string wgsl;
+    for (int64_t i = 0; i < num_entry_points; i++) {
+        auto n = std::to_string(i);
+        wgsl += "struct S" + n + " { a : array<vec4<f32>, 4>, b : u32 }\n";
+        wgsl += "const k" + n + " = vec4(" + n + ".0, 1.0, 2.0, 3.0);\n";
+        wgsl += "@group(0) @binding(" + n + ") var<storage, read_write> buf" + n + " : S" + n + ";\n";
+        wgsl += "fn leaf" + n + "(v : vec4<f32>) -> vec4<f32> {\n";
+        wgsl += "  var m = mat4x4<f32>(v, k" + n + ", v, k" + n + ");\n";
+        wgsl += "  return m * normalize(v + k" + n + ");\n";
+        wgsl += "}\n";
+        wgsl += "fn helper" + n + "(i : u32) -> vec4<f32> {\n";
+        wgsl += "  var sum = vec4<f32>();\n";
+        wgsl += "  for (var j = 0u; j < 4u; j++) { sum += leaf" + n + "(buf" + n + ".a[j]); }\n";
+        wgsl += "  return sum * f32(i);\n";
+        wgsl += "}\n";
+        wgsl += "@compute @workgroup_size(64)\n";
+        wgsl += "fn main" + n + "(@builtin(local_invocation_index) idx : u32) {\n";
+        wgsl += "  buf" + n + ".a[idx % 4u] = helper" + n + "(idx);\n";
+        wgsl += "  buf" + n + ".b = idx;\n";
+        wgsl += "}\n";
+    }
+    return wgsl;
+}
+
+/// Parses a generated shader with many entry points, resolving either the whole module
+/// (Options::entry_point is empty) or only the declarations reachable from the first entry point.
+void ParseWGSLManyEntryPoints(benchmark::State& state, bool single_entry_point) {
+    auto wgsl = GenerateManyEntryPointsWGSL(state.range(0));
+    Source::File file("many_entry_points.wgsl", wgsl);
+    Options options;
+    if (single_entry_point) {
+        options.entry_point = "main0";
+    }
+    for (auto _ : state) {
+        auto program = Parse(&file, options);
+        if (program.Diagnostics().ContainsErrors()) {
+            state.SkipWithError(program.Diagnostics().Str());
+            return;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * wgsl.size()));
+}
+
+BENCHMARK_CAPTURE(ParseWGSLManyEntryPoints, WholeModule, false)
+    ->Arg(10)
+    ->Arg(200)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ParseWGSLManyEntryPoints, SingleEntryPoint, true)
+    ->Arg(10)
+    ->Arg(200)
+    ->Unit(benchmark::kMillisecond);
+
 }  // namespace
 }  // namespace tint::wgsl::reader
@@ -0,0 +1,187 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/wgsl/reader/reader.h"
+
+#include "gmock/gmock.h"
+
+#include "src/tint/lang/wgsl/ast/function.h"
+#include "src/tint/lang/wgsl/ast/identifier.h"
+#include "src/tint/lang/wgsl/ast/module.h"
+#include "src/tint/lang/wgsl/sem/variable.h"
+
+namespace tint::wgsl::reader {
+namespace {
+
+constexpr const char* kManyEntryPoints = R"(
+const a = 1;
+const b : i32 = a + 1;
+const_assert b == 2;
+const_assert unused_c == 3;
+
+const unused_c = 3;
+
+struct S { x : i32 }
+
+@group(0) @binding(0) var<storage, read_write> buf : S;
+
+fn helper() -> i32 {
+  return b;
+}
+
+@compute @workgroup_size(1)
+fn main_a() {
+  buf.x = helper();
+}
+
+fn unused() {
+  let x : i32 = 1.5;
+}
+
+@compute @workgroup_size(1)
+fn main_b() {
+  unused();
+}
+)";
+
+struct Names {
+    size_t functions = 0;
+    size_t variables = 0;
+    size_t type_decls = 0;
+    size_t const_asserts = 0;
+};
+
+Names Count(const Program& program) {
+    auto& mod = program.AST();
+    return Names{mod.Functions().Length(), mod.GlobalVariables().Length(),
+                 mod.TypeDecls().Length(), mod.ConstAsserts().Length()};
+}
+
+TEST(WgslReaderTest, Parse_WholeModule) {
+    Source::File file("test.wgsl", kManyEntryPoints);
+    auto program = Parse(&file);
+    EXPECT_FALSE(program.IsValid());
+    EXPECT_THAT(program.Diagnostics().Str(), testing::HasSubstr("test.wgsl:23:"));
+    EXPECT_THAT(program.Diagnostics().Str(),
+                testing::HasSubstr("cannot convert value of type 'abstract-float' to type 'i32'"));
+}
+
+TEST(WgslReaderTest, Parse_EntryPoint) {
+    Source::File file("test.wgsl", kManyEntryPoints);
+    Options options;
+    options.entry_point = "main_a";
+    auto program = Parse(&file, options);
+    ASSERT_TRUE(program.IsValid()) << program.Diagnostics().Str();
+
+    auto names = Count(program);
+    EXPECT_EQ(names.functions, 2u);      // helper, main_a
+    EXPECT_EQ(names.variables, 3u);      // a, b, buf
+    EXPECT_EQ(names.type_decls, 1u);     // S
+    EXPECT_EQ(names.const_asserts, 1u);  // const_assert b == 2
+    EXPECT_EQ(program.AST().Functions()[1]->name->symbol.Name(), "main_a");
+}
+
+TEST(WgslReaderTest, Parse_EntryPoint_Unreachable) {
+    Source::File file("test.wgsl", kManyEntryPoints);
+    Options options;
+    options.entry_point = "main_b";
+    auto program = Parse(&file, options);
+    EXPECT_FALSE(program.IsValid());
+    EXPECT_THAT(program.Diagnostics().Str(), testing::HasSubstr("test.wgsl:23:"));
+    EXPECT_THAT(program.Diagnostics().Str(),
+                testing::HasSubstr("cannot convert value of type 'abstract-float' to type 'i32'"));
+}
+
+TEST(WgslReaderTest, Parse_EntryPoint_Strict) {
+    Source::File file("test.wgsl", kManyEntryPoints);
+    Options options;
+    options.entry_point = "main_a";
+    options.strict_entry_point_validation = true;
+    auto program = Parse(&file, options);
+    EXPECT_FALSE(program.IsValid());
+    EXPECT_EQ(Count(program).functions, 4u);
+}
+
+TEST(WgslReaderTest, Parse_EntryPoint_NotFound) {
+    Source::File file("test.wgsl", kManyEntryPoints);
+    Options options;
+    options.entry_point = "helper";
+    auto program = Parse(&file, options);
+    EXPECT_FALSE(program.IsValid());
+    EXPECT_EQ(Count(program).functions, 4u);
+}
+
+TEST(WgslReaderTest, Parse_EntryPoint_KeepsDirectivesAndSymbols) {
+    Source::File file("test.wgsl", R"(
+enable f16;
+diagnostic(off, derivative_uniformity);
+
+fn unused() {}
+
+@fragment
+fn main() -> @location(0) vec4<f16> {
+  return vec4<f16>();
+}
+)");
+    Options options;
+    options.allowed_features = AllowedFeatures::Everything();
+    options.entry_point = "main";
+    auto program = Parse(&file, options);
+    ASSERT_TRUE(program.IsValid()) << program.Diagnostics().Str();
+    EXPECT_EQ(program.AST().Enables().Length(), 1u);
+    EXPECT_EQ(program.AST().DiagnosticDirectives().Length(), 1u);
+    EXPECT_EQ(program.AST().Functions().Length(), 1u);
+    // The symbols of the removed declarations are still registered, so new symbols do not clash.
+    EXPECT_TRUE(program.Symbols().Get("unused").IsValid());
+}
+
+TEST(WgslReaderTest, Parse_EntryPoint_KeepsOverrideIds) {
+    Source::File file("test.wgsl", R"(
+override unused_o : f32 = 1.0;
+override o : f32 = 2.0;
+
+@compute @workgroup_size(1)
+fn main() {
+  _ = o;
+}
+)");
+    Options options;
+    options.entry_point = "main";
+    auto program = Parse(&file, options);
+    ASSERT_TRUE(program.IsValid()) << program.Diagnostics().Str();
+
+    // The override IDs are the same as the ones allocated for the whole module.
+    auto& overrides = program.AST().GlobalVariables();
+    ASSERT_EQ(overrides.Length(), 2u);
+    auto* o = program.Sem().Get<sem::GlobalVariable>(overrides[1]);
+    ASSERT_EQ(o->Declaration()->name->symbol.Name(), "o");
+    ASSERT_TRUE(o->Attributes().override_id.has_value());
+    EXPECT_EQ(o->Attributes().override_id->value, 1u);
+}
+
+}  // namespace
+}  // namespace tint::wgsl::reader
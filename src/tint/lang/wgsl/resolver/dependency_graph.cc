@@ -79,6 +79,7 @@
 #include "src/tint/utils/containers/map.h"
 #include "src/tint/utils/containers/scope_stack.h"
 #include "src/tint/utils/containers/unique_vector.h"
+#include "src/tint/utils/debug/phase_timer.h"
 #include "src/tint/utils/macros/compiler.h"
 #include "src/tint/utils/macros/defer.h"
 #include "src/tint/utils/macros/scoped_assignment.h"
@@ -646,12 +647,23 @@ struct DependencyAnalysis {
     }
 
     /// Walks the global declarations, determining the dependencies of each global
-    /// and adding these to each global's Global::deps field.
+    /// and adding these to each global's Global::deps field and to
+    /// DependencyGraph::global_dependencies.
     void DetermineDependencies() {
         DependencyScanner scanner(globals_, diagnostics_, graph_, dependency_edges_);
         for (auto* global : declaration_order_) {
             scanner.Scan(global);
         }
+        for (auto* global : declaration_order_) {
+            if (!global->deps.IsEmpty()) {
+                Vector<const ast::Node*, 8> deps;
+                deps.Reserve(global->deps.Length());
+                for (auto* dep : global->deps) {
+                    deps.Push(dep->node);
+                }
+                graph_.global_dependencies.Add(global->node, std::move(deps));
+            }
+        }
     }
 
     /// Performs a depth-first traversal of `root`'s dependencies, calling `enter`
@@ -848,6 +860,7 @@ DependencyGraph::~DependencyGraph() = default;
 bool DependencyGraph::Build(const ast::Module& module,
                             diag::List& diagnostics,
                             DependencyGraph& output) {
+    TINT_SCOPED_PHASE_TIMER(kDependencyGraph);
     DependencyAnalysis da{diagnostics, output};
     return da.Run(module);
 }
@@ -217,6 +217,10 @@ struct DependencyGraph {
     /// Map of ast::Identifier to a ResolvedIdentifier
     Hashmap<const ast::Identifier*, ResolvedIdentifier, 64> resolved_identifiers;
 
+    /// Map of module-scope declaration to the module-scope declarations that it directly depends
+    /// on. Declarations without dependencies have no entry.
+    Hashmap<const ast::Node*, Vector<const ast::Node*, 8>, 64> global_dependencies;
+
     /// Map of ast::Variable to a type, function, or variable that is shadowed by
     /// the variable key. A declaration (X) shadows another (Y) if X and Y use
     /// the same symbol, and X is declared in a sub-scope of the scope that
@@ -35,8 +35,10 @@ namespace tint::resolver {
 
 Program Resolve(ProgramBuilder& builder,
                 const wgsl::AllowedFeatures& allowed_features,
-                wgsl::ValidationMode mode) {
-    Resolver resolver(&builder, std::move(allowed_features), mode);
+                wgsl::ValidationMode mode,
+                uint32_t max_threads,
+                UniformityCache* uniformity_cache) {
+    Resolver resolver(&builder, std::move(allowed_features), mode, max_threads, uniformity_cache);
     resolver.Resolve();
     return Program(std::move(builder));
 }
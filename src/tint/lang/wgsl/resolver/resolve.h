@@ -28,6 +28,8 @@
 #ifndef SRC_TINT_LANG_WGSL_RESOLVER_RESOLVE_H_
 #define SRC_TINT_LANG_WGSL_RESOLVER_RESOLVE_H_
 
+#include <cstdint>
+
 #include "src/tint/lang/wgsl/common/allowed_features.h"
 #include "src/tint/lang/wgsl/common/validation_mode.h"
 
@@ -35,16 +37,25 @@ namespace tint {
 class Program;
 class ProgramBuilder;
 }  // namespace tint
+namespace tint::resolver {
+class UniformityCache;
+}  // namespace tint::resolver
 
 namespace tint::resolver {
 
 /// Performs semantic analysis and validation on the program builder @p builder
 /// @param allowed_features the extensions and features that are allowed to be used
 /// @param mode the validation mode to uses
+/// @param max_threads the maximum number of threads to use for analyzing independent functions
+/// concurrently. The resolved program is identical for any number of threads.
+/// @param uniformity_cache if non-null, the cache of functions that have passed uniformity analysis,
+/// which is shared between programs to skip the analysis of identical functions
 /// @returns the resolved Program. Program.Diagnostics() may contain validation errors.
 Program Resolve(ProgramBuilder& builder,
                 const wgsl::AllowedFeatures& allowed_features = wgsl::AllowedFeatures::Everything(),
-                wgsl::ValidationMode mode = wgsl::ValidationMode::kFull);
+                wgsl::ValidationMode mode = wgsl::ValidationMode::kFull,
+                uint32_t max_threads = 1,
+                UniformityCache* uniformity_cache = nullptr);
 
 }  // namespace tint::resolver
 
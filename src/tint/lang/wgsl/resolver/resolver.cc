@@ -106,6 +106,7 @@
 #include "src/tint/utils/containers/reverse.h"
 #include "src/tint/utils/containers/transform.h"
 #include "src/tint/utils/containers/vector.h"
+#include "src/tint/utils/debug/phase_timer.h"
 #include "src/tint/utils/macros/compiler.h"
 #include "src/tint/utils/macros/defer.h"
 #include "src/tint/utils/macros/scoped_assignment.h"
@@ -134,7 +135,9 @@ constexpr size_t kMaxNestDepthOfCompositeType = 255;
 
 Resolver::Resolver(ProgramBuilder* builder,
                    const wgsl::AllowedFeatures& allowed_features,
-                   wgsl::ValidationMode mode)
+                   wgsl::ValidationMode mode,
+                   uint32_t max_threads,
+                   UniformityCache* uniformity_cache)
     : b(*builder),
       diagnostics_(builder->Diagnostics()),
       const_eval_(builder->constants, diagnostics_),
@@ -147,7 +150,9 @@ Resolver::Resolver(ProgramBuilder* builder,
                  mode,
                  atomic_composite_info_,
                  valid_type_storage_layouts_),
-      allowed_features_(allowed_features) {}
+      allowed_features_(allowed_features),
+      max_threads_(max_threads),
+      uniformity_cache_(uniformity_cache) {}
 
 Resolver::~Resolver() = default;
 
@@ -156,6 +161,8 @@ bool Resolver::Resolve() {
         return false;
     }
 
+    TINT_SCOPED_PHASE_TIMER(kResolve);
+
     b.Sem().Reserve(b.LastAllocatedNodeID());
 
     // Pre-allocate the marked bitset with the total number of AST nodes.
@@ -171,8 +178,11 @@ bool Resolver::Resolve() {
         TINT_ICE() << "resolving failed, but no error was raised";
     }
 
-    if (!validator_.Enables(b.AST().Enables())) {
-        return false;
+    {
+        TINT_SCOPED_PHASE_TIMER(kValidation);
+        if (!validator_.Enables(b.AST().Enables())) {
+            return false;
+        }
     }
 
     // Create the semantic module. Don't be tempted to std::move() these, they're used below.
@@ -184,7 +194,7 @@ bool Resolver::Resolve() {
         enabled_extensions_.Contains(wgsl::Extension::kChromiumDisableUniformityAnalysis);
     if (result && !disable_uniformity_analysis) {
         // Run the uniformity analysis, which requires a complete semantic module.
-        if (!AnalyzeUniformity(b, dependencies_)) {
+        if (!AnalyzeUniformity(b, dependencies_, max_threads_, uniformity_cache_)) {
             return false;
         }
     }
@@ -222,16 +232,19 @@ bool Resolver::ResolveInternal() {
 
     SetShadows();
 
-    if (!validator_.DiagnosticControls(diagnostic_controls, "directive")) {
-        return false;
-    }
+    {
+        TINT_SCOPED_PHASE_TIMER(kValidation);
+        if (!validator_.DiagnosticControls(diagnostic_controls, "directive")) {
+            return false;
+        }
 
-    if (!validator_.PipelineStages(entry_points_)) {
-        return false;
-    }
+        if (!validator_.PipelineStages(entry_points_)) {
+            return false;
+        }
 
-    if (!validator_.ModuleScopeVarUsages(entry_points_)) {
-        return false;
+        if (!validator_.ModuleScopeVarUsages(entry_points_)) {
+            return false;
+        }
     }
 
     bool result = true;
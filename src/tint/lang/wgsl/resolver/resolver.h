@@ -95,6 +95,8 @@ class Atomic;
 
 namespace tint::resolver {
 
+class UniformityCache;
+
 /// Resolves types for all items in the given tint program
 class Resolver {
   public:
@@ -102,9 +104,14 @@ class Resolver {
     /// @param builder the program builder
     /// @param allowed_features the extensions and features that are allowed to be used
     /// @param mode the validation mode to use
+    /// @param max_threads the maximum number of threads to use for analyzing functions
+    /// @param uniformity_cache the cache of functions that have passed uniformity analysis, or
+    /// nullptr
     Resolver(ProgramBuilder* builder,
              const wgsl::AllowedFeatures& allowed_features,
-             wgsl::ValidationMode mode = wgsl::ValidationMode::kFull);
+             wgsl::ValidationMode mode = wgsl::ValidationMode::kFull,
+             uint32_t max_threads = 1,
+             UniformityCache* uniformity_cache = nullptr);
 
     /// Destructor
     ~Resolver();
@@ -710,6 +717,8 @@ class Resolver {
     SemHelper sem_;
     Validator validator_;
     wgsl::AllowedFeatures allowed_features_;
+    uint32_t max_threads_ = 1;
+    UniformityCache* uniformity_cache_ = nullptr;
     wgsl::Extensions enabled_extensions_;
     Vector<sem::Function*, 8> entry_points_;
     Hashmap<const core::type::Type*, const Source*, 8> atomic_composite_info_;
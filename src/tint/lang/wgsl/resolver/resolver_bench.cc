@@ -0,0 +1,258 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/wgsl/reader/parser/parser.h"
+#include "src/tint/lang/wgsl/reader/reader.h"
+#include "src/tint/lang/wgsl/resolver/dependency_graph.h"
+#include "src/tint/lang/wgsl/resolver/resolve.h"
+#include "src/tint/lang/wgsl/resolver/uniformity.h"
+#include "src/tint/utils/debug/phase_timer.h"
+
+namespace tint::resolver {
+namespace {
+
+/// Builds the dependency graph of the parsed program. Parsing is not timed.
+void DependencyGraphWGSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        wgsl::reader::Parser parser(&res.Get());
+        parser.Parse();
+        state.ResumeTiming();
+
+        DependencyGraph graph;
+        diag::List diagnostics;
+        if (!DependencyGraph::Build(parser.builder().AST(), diagnostics, graph)) {
+            state.SkipWithError(diagnostics.Str());
+        }
+    }
+}
+
+TINT_BENCHMARK_PROGRAMS(DependencyGraphWGSL);
+
+/// Resolves the parsed program. Parsing is not timed.
+void ResolveWGSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        wgsl::reader::Parser parser(&res.Get());
+        parser.Parse();
+        state.ResumeTiming();
+
+        auto program = Resolve(parser.builder());
+        if (program.Diagnostics().ContainsErrors()) {
+            state.SkipWithError(program.Diagnostics().Str());
+        }
+    }
+}
+
+TINT_BENCHMARK_PROGRAMS(ResolveWGSL);
+
+/// Parses and resolves the program, reporting the average time spent in each compile phase per
+/// iteration as a counter. Requires TINT_ENABLE_PHASE_TIMING.
+void CompilePhasesWGSL(benchmark::State& state, std::string input_name) {
+    if (!PhaseTimings::kEnabled) {
+        state.SkipWithError("requires tint to be built with TINT_ENABLE_PHASE_TIMING");
+        return;
+    }
+    auto res = bench::LoadInputFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    PhaseTimings timings;
+    for (auto _ : state) {
+        PhaseTimingScope scope(timings);
+        auto program = wgsl::reader::Parse(&res.Get());
+        if (program.Diagnostics().ContainsErrors()) {
+            state.SkipWithError(program.Diagnostics().Str());
+        }
+    }
+    for (size_t i = 0; i < kNumCompilePhases; i++) {
+        auto phase = static_cast<CompilePhase>(i);
+        std::chrono::duration<double, std::micro> us = timings.Get(phase);
+        state.counters[std::string(ToString(phase)) + "_us"] =
+            benchmark::Counter(us.count(), benchmark::Counter::kAvgIterations);
+    }
+}
+
+TINT_BENCHMARK_PROGRAMS(CompilePhasesWGSL);
+
+/// @returns a shader that folds a `const` lookup table of @p num_elements `vec4` elements, built
+/// with element-wise vector operations and builtins. Like atan2-const-eval.wgsl, the shader is
+/// dominated by constant evaluation, but the table elements are composites, many of which are
+/// splats, and the table repeats every 64 elements.
+std::string GenerateConstTableWGSL(int64_t num_elements) {
+    std::string wgsl = "const kScale = vec4(0.5);\n";
+    wgsl += "const kTable = array(\n";
+    for (int64_t i = 0; i < num_elements; i++) {
+        auto a = std::to_string(i % 64) + ".0";
+        auto b = std::to_string(i % 8) + ".0";
+        if (i % 2) {
+            wgsl += "  clamp(vec4(" + a + ") * kScale + vec4(" + b + "), vec4(0.0), vec4(40.0)),\n";
+        } else {
+            wgsl += "  sqrt(abs(vec4(" + a + ", " + b + ", 1.0, 2.0) - kScale)) * 2.0,\n";
+        }
+    }
+    wgsl += ");\n";
+    wgsl += "@group(0) @binding(0) var<storage, read_write> outputs : array<vec4<f32>, " +
+            std::to_string(num_elements) + ">;\n";
+    wgsl += "@compute @workgroup_size(1)\n";
+    wgsl += "fn main() {\n";
+    wgsl += "  for (var i = 0u; i < " + std::to_string(num_elements) + "; i++) {\n";
+    wgsl += "    outputs[i] = kTable[i];\n";
+    wgsl += "  }\n";
+    wgsl += "}\n";
+    return wgsl;
+}
+
+/// Resolves a generated shader holding a `const` lookup table of state.range(0) elements. Parsing
+/// is not timed.
+void ResolveConstTableWGSL(benchmark::State& state) {
+    auto wgsl = GenerateConstTableWGSL(state.range(0));
+    Source::File file("const_table.wgsl", wgsl);
+    for (auto _ : state) {
+        state.PauseTiming();
+        wgsl::reader::Parser parser(&file);
+        parser.Parse();
+        state.ResumeTiming();
+
+        auto program = Resolve(parser.builder());
+        if (program.Diagnostics().ContainsErrors()) {
+            state.SkipWithError(program.Diagnostics().Str());
+        }
+    }
+}
+
+BENCHMARK(ResolveConstTableWGSL)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+/// @returns a shader with @p num_functions functions, where each function calls two of the
+/// functions declared before it, and guards a barrier with a uniform condition.
+std::string GenerateCallTreeWGSL(int64_t num_functions) {
+    std::string wgsl = "@group(0) @binding(0) var<uniform> u : vec4<f32>;\n";
+    for (int64_t i = 0; i < num_functions; i++) {
+        auto n = std::to_string(i);
+        wgsl += "fn func" + n + "(a : vec4<f32>) -> f32 {\n";
+        wgsl += "  var v = a * u;\n";
+        wgsl += "  for (var i = 0; i < 4; i++) {\n";
+        wgsl += "    if (u.x > 0.0) { workgroupBarrier(); }\n";
+        wgsl += "    v += vec4(f32(i));\n";
+        wgsl += "  }\n";
+        if (i == 0) {
+            wgsl += "  return dot(v, a);\n";
+        } else {
+            wgsl += "  return func" + std::to_string((i - 1) / 2) + "(v) + func" +
+                    std::to_string((i - 1) / 3) + "(a);\n";
+        }
+        wgsl += "}\n";
+    }
+    return wgsl;
+}
+
+/// Resolves a generated shader, analyzing its functions on up to state.range(1) threads. Parsing
+/// is not timed.
+void ResolveWGSLThreads(benchmark::State& state) {
+    auto wgsl = GenerateCallTreeWGSL(state.range(0));
+    Source::File file("call_tree.wgsl", wgsl);
+    auto max_threads = static_cast<uint32_t>(state.range(1));
+    for (auto _ : state) {
+        state.PauseTiming();
+        wgsl::reader::Parser parser(&file);
+        parser.Parse();
+        state.ResumeTiming();
+
+        auto program = Resolve(parser.builder(), wgsl::AllowedFeatures::Everything(),
+                               wgsl::ValidationMode::kFull, max_threads);
+        if (program.Diagnostics().ContainsErrors()) {
+            state.SkipWithError(program.Diagnostics().Str());
+        }
+    }
+}
+
+BENCHMARK(ResolveWGSLThreads)
+    ->ArgsProduct({{1000, 5000}, {1, 2, 4, 8}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+/// Resolves eight shaders that share a library of state.range(0) generated functions, each with its
+/// own entry point. If state.range(1) is non-zero, the shaders share a UniformityCache, which is
+/// warmed by the first iteration. Parsing is not timed.
+void ResolveWGSLSharedLibrary(benchmark::State& state) {
+    constexpr int kNumShaders = 8;
+    auto num_functions = state.range(0);
+    auto library = GenerateCallTreeWGSL(num_functions);
+    std::vector<std::unique_ptr<Source::File>> files;
+    for (int i = 0; i < kNumShaders; i++) {
+        auto wgsl = library;
+        wgsl += "@compute @workgroup_size(64)\n";
+        wgsl += "fn main" + std::to_string(i) + "() {\n";
+        wgsl += "  _ = func" + std::to_string(num_functions - 1 - i) + "(vec4(f32(" +
+                std::to_string(i) + ")));\n";
+        wgsl += "}\n";
+        files.push_back(std::make_unique<Source::File>("shader.wgsl", wgsl));
+    }
+
+    UniformityCache cache;
+    UniformityCache* uniformity_cache = state.range(1) ? &cache : nullptr;
+    for (auto _ : state) {
+        for (auto& file : files) {
+            state.PauseTiming();
+            wgsl::reader::Parser parser(file.get());
+            parser.Parse();
+            state.ResumeTiming();
+
+            auto program = Resolve(parser.builder(), wgsl::AllowedFeatures::Everything(),
+                                   wgsl::ValidationMode::kFull, 1, uniformity_cache);
+            if (program.Diagnostics().ContainsErrors()) {
+                state.SkipWithError(program.Diagnostics().Str());
+            }
+        }
+    }
+    state.counters["cache_hits"] =
+        benchmark::Counter(static_cast<double>(cache.Hits()), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(ResolveWGSLSharedLibrary)
+    ->ArgsProduct({{100, 1000}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace tint::resolver
@@ -27,8 +27,13 @@
 
 #include "src/tint/lang/wgsl/resolver/uniformity.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -52,6 +57,7 @@
 #include "src/tint/utils/containers/map.h"
 #include "src/tint/utils/containers/scope_stack.h"
 #include "src/tint/utils/containers/unique_vector.h"
+#include "src/tint/utils/debug/phase_timer.h"
 #include "src/tint/utils/macros/defer.h"
 #include "src/tint/utils/memory/block_allocator.h"
 #include "src/tint/utils/rtti/switch.h"
@@ -110,6 +116,36 @@ struct ParameterTag {
     wgsl::DiagnosticSeverity severity = wgsl::DiagnosticSeverity::kUndefined;
 };
 
+}  // namespace
+
+struct UniformityCache::Entry {
+    /// The uniformity requirements and effects of a function parameter.
+    struct Parameter {
+        /// The parameter's direct uniformity requirements.
+        ParameterTag tag_direct;
+        /// The parameter's uniformity requirements that affect the function return value.
+        ParameterTag tag_retval;
+        /// `true` if the function may cause the contents of this pointer parameter to become
+        /// non-uniform.
+        bool pointer_may_become_non_uniform = false;
+        /// The indices of the parameters whose values feed into this pointer parameter.
+        Vector<uint32_t, 4> ptr_output_source_param_values;
+        /// The indices of the pointer parameters whose contents feed into this pointer parameter.
+        Vector<uint32_t, 4> ptr_output_source_param_contents;
+    };
+
+    /// The unique identifier of the entry, used by the keys of the functions that call it.
+    uint64_t id = 0;
+    /// The call site uniformity requirements.
+    CallSiteTag callsite_tag;
+    /// The function's uniformity effects.
+    FunctionTag function_tag;
+    /// The uniformity requirements and effects of the function's parameters.
+    Vector<Parameter, 8> parameters;
+};
+
+namespace {
+
 /// Node represents a node in the graph of control flow and value nodes within the analysis of a
 /// single function.
 struct Node {
@@ -242,6 +278,10 @@ struct FunctionInfo {
     /// The uniformity requirements of the function's parameters.
     Vector<ParameterInfo, 8> parameters;
 
+    /// The cache entry that holds the results for this function, or nullptr if the function was
+    /// not analyzed with a cache or cannot be cached.
+    std::shared_ptr<const UniformityCache::Entry> cache_entry;
+
     /// The control flow graph.
     BlockAllocator<Node> nodes;
 
@@ -330,6 +370,49 @@ struct FunctionInfo {
         return node;
     }
 
+    /// @returns a cache entry holding the uniformity requirements and effects of the function
+    UniformityCache::Entry ToCacheEntry() const {
+        UniformityCache::Entry entry;
+        entry.callsite_tag = callsite_tag;
+        entry.function_tag = function_tag;
+        for (auto& param : parameters) {
+            UniformityCache::Entry::Parameter out;
+            out.tag_direct = param.tag_direct;
+            out.tag_retval = param.tag_retval;
+            out.pointer_may_become_non_uniform = param.pointer_may_become_non_uniform;
+            for (auto* source : param.ptr_output_source_param_values) {
+                out.ptr_output_source_param_values.Push(source->Index());
+            }
+            for (auto* source : param.ptr_output_source_param_contents) {
+                out.ptr_output_source_param_contents.Push(source->Index());
+            }
+            entry.parameters.Push(std::move(out));
+        }
+        return entry;
+    }
+
+    /// Sets the uniformity requirements and effects of the function from a cache entry.
+    /// @param entry the cache entry
+    void FromCacheEntry(std::shared_ptr<const UniformityCache::Entry> entry) {
+        callsite_tag = entry->callsite_tag;
+        function_tag = entry->function_tag;
+        TINT_ASSERT(entry->parameters.Length() == parameters.Length());
+        for (size_t i = 0; i < parameters.Length(); i++) {
+            auto& in = entry->parameters[i];
+            auto& param = parameters[i];
+            param.tag_direct = in.tag_direct;
+            param.tag_retval = in.tag_retval;
+            param.pointer_may_become_non_uniform = in.pointer_may_become_non_uniform;
+            for (auto index : in.ptr_output_source_param_values) {
+                param.ptr_output_source_param_values.Push(parameters[index].sem);
+            }
+            for (auto index : in.ptr_output_source_param_contents) {
+                param.ptr_output_source_param_contents.Push(parameters[index].sem);
+            }
+        }
+        cache_entry = std::move(entry);
+    }
+
     /// Reset the visited status of every node in the graph.
     void ResetVisited() {
         for (auto* node : nodes.Objects()) {
@@ -348,14 +431,33 @@ struct FunctionInfo {
     BlockAllocator<LoopSwitchInfo> loop_switch_info_allocator;
 };
 
+/// Map of function to analysis results.
+using FunctionInfos = Hashmap<const ast::Function*, FunctionInfo, 8>;
+
 /// UniformityGraph is used to analyze the uniformity requirements and effects of functions in a
 /// module.
 class UniformityGraph {
   public:
     /// Constructor.
     /// @param builder the program to analyze
-    explicit UniformityGraph(ProgramBuilder& builder)
-        : b(builder), sem_(b.Sem()), diagnostics_(builder.Diagnostics()) {}
+    /// @param functions the analysis results of the functions in the module
+    /// @param diagnostics the list that uniformity issues are reported to
+    /// @param cache if non-null, the cache of analyzed functions. Uniformity issues are not
+    /// reported when analyzing with a cache, as the called functions may not have graphs.
+    /// @param reporting_mutex if non-null, the mutex that is held while reporting a uniformity
+    /// issue. Reporting walks the graphs of called functions, which may be shared with other
+    /// threads.
+    UniformityGraph(const ProgramBuilder& builder,
+                    FunctionInfos& functions,
+                    diag::List& diagnostics,
+                    UniformityCache* cache = nullptr,
+                    std::mutex* reporting_mutex = nullptr)
+        : b(builder),
+          sem_(b.Sem()),
+          diagnostics_(diagnostics),
+          functions_(functions),
+          cache_(cache),
+          reporting_mutex_(reporting_mutex) {}
 
     /// Destructor.
     ~UniformityGraph() {}
@@ -374,7 +476,7 @@ class UniformityGraph {
         bool success = true;
         for (auto* decl : dependency_graph.ordered_globals) {
             if (auto* func = decl->As<ast::Function>()) {
-                if (!ProcessFunction(func)) {
+                if (!AnalyzeFunction(func, functions_.Add(func, FunctionInfo(func, b)).value)) {
                     success = false;
                     break;
                 }
@@ -388,52 +490,40 @@ class UniformityGraph {
         return success;
     }
 
-  private:
-    const ProgramBuilder& b;
-    const sem::Info& sem_;
-    diag::List& diagnostics_;
-
-    /// Map of analyzed function results.
-    Hashmap<const ast::Function*, FunctionInfo, 8> functions_;
-
-    /// The function currently being analyzed.
-    FunctionInfo* current_function_;
-
-    /// Create a new node.
-    /// @param tag_list a string list that will be used to identify the node for debugging purposes
-    /// @param ast the optional AST node that this node corresponds to
-    /// @returns the new node
-    inline Node* CreateNode(std::initializer_list<std::string_view> tag_list,
-                            const ast::Node* ast = nullptr) {
-        return current_function_->CreateNode(std::move(tag_list), ast);
-    }
-
-    /// Get the symbol name of an AST expression.
-    /// @param expr the expression to get the symbol name of
-    /// @returns the symbol name
-    inline std::string NameFor(const ast::IdentifierExpression* expr) {
-        return expr->identifier->symbol.Name();
-    }
-
-    /// @param var the variable to get the name of
-    /// @returns the name of the variable @p var
-    inline std::string NameFor(const ast::Variable* var) { return var->name->symbol.Name(); }
-
-    /// @param var the variable to get the name of
-    /// @returns the name of the variable @p var
-    inline std::string NameFor(const sem::Variable* var) { return NameFor(var->Declaration()); }
+    /// Analyze a function, or take its results from the cache if an identical function has already
+    /// been analyzed.
+    /// All the functions called by @p func must have already been analyzed.
+    /// @param func the function to analyze
+    /// @param info the analysis results for @p func
+    /// @returns true if there are no uniformity issues, false otherwise
+    bool AnalyzeFunction(const ast::Function* func, FunctionInfo& info) {
+        if (!cache_) {
+            return ProcessFunction(func, info);
+        }
 
-    /// @param fn the function to get the name of
-    /// @returns the name of the function @p fn
-    inline std::string NameFor(const sem::Function* fn) {
-        return fn->Declaration()->name->symbol.Name();
+        auto key = CacheKey(func);
+        if (!key.empty()) {
+            if (auto entry = cache_->Find(key)) {
+                info.FromCacheEntry(std::move(entry));
+                return true;
+            }
+        }
+        if (!ProcessFunction(func, info)) {
+            return false;
+        }
+        if (!key.empty()) {
+            info.cache_entry = cache_->Add(key, info.ToCacheEntry());
+        }
+        return true;
     }
 
     /// Process a function.
+    /// All the functions called by @p func must have already been processed.
     /// @param func the function to process
+    /// @param info the analysis results for @p func
     /// @returns true if there are no uniformity issues, false otherwise
-    bool ProcessFunction(const ast::Function* func) {
-        current_function_ = &functions_.Add(func, FunctionInfo(func, b)).value;
+    bool ProcessFunction(const ast::Function* func, FunctionInfo& info) {
+        current_function_ = &info;
 
         // Process function body.
         if (func->body) {
@@ -478,6 +568,14 @@ class UniformityGraph {
             auto traverse = [&](wgsl::DiagnosticSeverity severity) {
                 Traverse(current_function_->RequiredToBeUniform(severity), &reachable);
                 if (reachable.Contains(current_function_->may_be_non_uniform)) {
+                    if (cache_) {
+                        // Issues are reported by analyzing the program again without the cache.
+                        return false;
+                    }
+                    std::unique_lock<std::mutex> lock;
+                    if (reporting_mutex_) {
+                        lock = std::unique_lock<std::mutex>(*reporting_mutex_);
+                    }
                     MakeError(*current_function_, current_function_->may_be_non_uniform, severity);
                     return false;
                 }
@@ -501,8 +599,12 @@ class UniformityGraph {
             if (!traverse(wgsl::DiagnosticSeverity::kError)) {
                 return false;
             } else {
-                if (traverse(wgsl::DiagnosticSeverity::kWarning)) {
-                    traverse(wgsl::DiagnosticSeverity::kInfo);
+                bool has_issue = !traverse(wgsl::DiagnosticSeverity::kWarning) ||
+                                 !traverse(wgsl::DiagnosticSeverity::kInfo);
+                if (has_issue && cache_) {
+                    // The warning or info diagnostic is reported by analyzing the program again
+                    // without the cache.
+                    return false;
                 }
             }
         }
@@ -557,6 +659,54 @@ class UniformityGraph {
         return true;
     }
 
+  private:
+    const ProgramBuilder& b;
+    const sem::Info& sem_;
+    diag::List& diagnostics_;
+
+    /// Map of analyzed function results.
+    FunctionInfos& functions_;
+
+    /// The cache of analyzed functions, or nullptr.
+    UniformityCache* cache_ = nullptr;
+
+    /// The mutex held while reporting uniformity issues, or nullptr if the analysis is not
+    /// concurrent.
+    std::mutex* reporting_mutex_ = nullptr;
+
+    /// The function currently being analyzed.
+    FunctionInfo* current_function_;
+
+    /// Create a new node.
+    /// @param tag_list a string list that will be used to identify the node for debugging purposes
+    /// @param ast the optional AST node that this node corresponds to
+    /// @returns the new node
+    inline Node* CreateNode(std::initializer_list<std::string_view> tag_list,
+                            const ast::Node* ast = nullptr) {
+        return current_function_->CreateNode(std::move(tag_list), ast);
+    }
+
+    /// Get the symbol name of an AST expression.
+    /// @param expr the expression to get the symbol name of
+    /// @returns the symbol name
+    inline std::string NameFor(const ast::IdentifierExpression* expr) {
+        return expr->identifier->symbol.Name();
+    }
+
+    /// @param var the variable to get the name of
+    /// @returns the name of the variable @p var
+    inline std::string NameFor(const ast::Variable* var) { return var->name->symbol.Name(); }
+
+    /// @param var the variable to get the name of
+    /// @returns the name of the variable @p var
+    inline std::string NameFor(const sem::Variable* var) { return NameFor(var->Declaration()); }
+
+    /// @param fn the function to get the name of
+    /// @returns the name of the function @p fn
+    inline std::string NameFor(const sem::Function* fn) {
+        return fn->Declaration()->name->symbol.Name();
+    }
+
     /// Process a statement, returning the new control flow node.
     /// @param cf the input control flow node
     /// @param stmt the statement to process d
@@ -2036,17 +2186,288 @@ class UniformityGraph {
         }
     }
 
+    /// Builds the cache key of a function, which holds everything that the analysis of the function
+    /// depends on: the source text of the function, the module-scope variables that it references,
+    /// the types of its parameters, the builtins and the cache entries of the functions that it
+    /// calls, and the `derivative_uniformity` diagnostic severity of the function.
+    /// @param func the function
+    /// @returns the cache key, or an empty string if the function cannot be cached
+    std::string CacheKey(const ast::Function* func) const {
+        // Use the whole source lines of the function, including its attributes. Using whole lines
+        // avoids depending on how columns are counted.
+        auto* file = func->source.file;
+        if (!file) {
+            return "";
+        }
+        auto first_line = func->source.range.begin.line;
+        auto last_line = func->source.range.end.line;
+        for (auto* attr : func->attributes) {
+            if (attr->source.file != file) {
+                return "";
+            }
+            first_line = std::min(first_line, attr->source.range.begin.line);
+        }
+        auto& lines = file->content.lines;
+        if (first_line == 0 || first_line > last_line || last_line > lines.size()) {
+            return "";
+        }
+        const char* text_begin = lines[first_line - 1].data();
+        const char* text_end = lines[last_line - 1].data() + lines[last_line - 1].size();
+
+        StringStream key;
+        key << std::string_view(text_begin, static_cast<size_t>(text_end - text_begin));
+
+        // Identifiers can be shadowed, so the same text may call a builtin in one module and a
+        // user function or a value constructor in another. Record what each call resolved to,
+        // along with the position of the call within the text. Calls to value constructors and
+        // conversions are not in DirectCalls(), but as all the other calls of the text are listed
+        // here, the remaining ones can only be to those, which have no uniformity requirements.
+        auto* sem = sem_.Get(func);
+        for (auto* call : sem->DirectCalls()) {
+            auto& begin = call->Declaration()->source.range.begin;
+            bool ok = Switch(
+                call->Target(),  //
+                [&](const sem::BuiltinFn* builtin) {
+                    key << "\nbuiltin " << builtin->Fn();
+                    return true;
+                },
+                [&](const sem::Function* callee) {
+                    auto callee_info = functions_.Get(callee->Declaration());
+                    if (!callee_info || !callee_info->cache_entry) {
+                        return false;
+                    }
+                    key << "\ncall " << callee_info->cache_entry->id;
+                    return true;
+                },
+                [&](Default) { return false; });
+            if (!ok) {
+                return "";
+            }
+            key << " " << (begin.line - first_line) << ":" << begin.column;
+        }
+        for (auto* global : sem->DirectlyReferencedGlobals()) {
+            key << "\nglobal " << global->Declaration()->name->symbol.NameView() << " "
+                << global->Declaration()->Kind() << " " << global->AddressSpace() << " "
+                << global->Access() << " " << global->Type()->FriendlyName();
+        }
+        for (auto* param : sem->Parameters()) {
+            key << "\nparam " << param->Type()->FriendlyName();
+            if (auto* str = param->Type()->As<core::type::Struct>()) {
+                for (auto* member : str->Members()) {
+                    if (auto builtin = member->Attributes().builtin) {
+                        key << " " << *builtin;
+                    }
+                }
+            }
+        }
+        key << "\nseverity "
+            << static_cast<int>(
+                   sem_.DiagnosticSeverity(func, wgsl::CoreDiagnosticRule::kDerivativeUniformity));
+        return key.str();
+    }
+
     // Helper for obtaining the sem::Call node for the ast::CallExpression
     const sem::Call* SemCall(const ast::CallExpression* expr) const {
         return sem_.Get(expr)->UnwrapMaterialize()->As<sem::Call>();
     }
 };
 
+/// Analyzes the functions of the module on up to @p max_threads threads.
+/// A function is analyzed as soon as all the functions that it calls have been analyzed. Each
+/// function reports to its own diagnostic list, and these lists are appended to the program's
+/// diagnostics in dependency order, up to and including the first function that fails. This
+/// produces the same diagnostics as UniformityGraph::Build().
+/// @param builder the program to analyze
+/// @param dependency_graph the dependency-ordered module-scope declarations
+/// @param max_threads the maximum number of threads to use, including the calling thread
+/// @param cache the cache of analyzed functions, or nullptr
+/// @returns true if all uniformity constraints are satisfied, otherise false
+bool AnalyzeConcurrently(ProgramBuilder& builder,
+                         const DependencyGraph& dependency_graph,
+                         uint32_t max_threads,
+                         UniformityCache* cache) {
+    /// The analysis of a single function.
+    struct Task {
+        /// The function to analyze.
+        const ast::Function* func = nullptr;
+        /// The analysis results of the function.
+        FunctionInfo* info = nullptr;
+        /// The diagnostics raised while analyzing the function.
+        diag::List diagnostics;
+        /// The indices of the tasks for the calls made to this function.
+        Vector<size_t, 4> callers;
+        /// The number of calls made by the function to functions that have not been analyzed.
+        size_t num_pending_calls = 0;
+        /// True if the function was analyzed and has no uniformity errors.
+        bool succeeded = false;
+    };
+
+    // Create the results for all the functions up front, so that the map is not modified while
+    // functions are being analyzed.
+    FunctionInfos functions;
+    Vector<Task, 32> tasks;
+    Hashmap<const ast::Function*, size_t, 32> task_indices;
+    for (auto* decl : dependency_graph.ordered_globals) {
+        if (auto* func = decl->As<ast::Function>()) {
+            task_indices.Add(func, tasks.Length());
+            tasks.Push(Task{});
+            auto& task = tasks.Back();
+            task.func = func;
+            task.info = &functions.Add(func, FunctionInfo(func, builder)).value;
+        }
+    }
+
+    for (size_t i = 0; i < tasks.Length(); i++) {
+        auto& task = tasks[i];
+        for (auto* call : builder.Sem().Get(task.func)->DirectCalls()) {
+            if (auto* callee = call->Target()->As<sem::Function>()) {
+                tasks[*task_indices.Get(callee->Declaration())].callers.Push(i);
+                task.num_pending_calls++;
+            }
+        }
+    }
+
+    // The tasks that can be started, with the earliest in dependency order at the back.
+    Vector<size_t, 32> ready;
+    for (size_t i = tasks.Length(); i-- > 0;) {
+        if (tasks[i].num_pending_calls == 0) {
+            ready.Push(i);
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::mutex reporting_mutex;
+    size_t num_running = 0;
+    size_t first_failure = tasks.Length();
+
+    auto worker = [&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv.wait(lock, [&] { return !ready.IsEmpty() || num_running == 0; });
+            if (ready.IsEmpty()) {
+                // Nothing is running, so no more tasks can become ready.
+                return;
+            }
+            size_t index = ready.Pop();
+            if (index > first_failure) {
+                // The diagnostics of this function would not be reported.
+                cv.notify_all();
+                continue;
+            }
+
+            num_running++;
+            lock.unlock();
+
+            auto& task = tasks[index];
+            UniformityGraph graph(builder, functions, task.diagnostics, cache, &reporting_mutex);
+            bool succeeded = graph.AnalyzeFunction(task.func, *task.info);
+
+            lock.lock();
+            num_running--;
+            task.succeeded = succeeded;
+            if (succeeded) {
+                for (size_t caller : task.callers) {
+                    if (--tasks[caller].num_pending_calls == 0) {
+                        ready.Push(caller);
+                    }
+                }
+            } else {
+                first_failure = std::min(first_failure, index);
+            }
+            cv.notify_all();
+        }
+    };
+
+    Vector<std::thread, 8> threads;
+    size_t num_threads = std::min<size_t>(max_threads, tasks.Length());
+    for (size_t i = 1; i < num_threads; i++) {
+        threads.Push(std::thread(worker));
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto& task : tasks) {
+        builder.Diagnostics().Add(task.diagnostics);
+        if (!task.succeeded) {
+            return false;
+        }
+    }
+    return true;
+}
+
 }  // namespace
 
-bool AnalyzeUniformity(ProgramBuilder& builder, const DependencyGraph& dependency_graph) {
-    UniformityGraph graph(builder);
-    return graph.Build(dependency_graph);
+UniformityCache::UniformityCache(size_t max_entries) : max_entries_(max_entries) {}
+
+UniformityCache::~UniformityCache() = default;
+
+std::shared_ptr<const UniformityCache::Entry> UniformityCache::Find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (auto entry = entries_.Get(key)) {
+        hits_++;
+        return *entry;
+    }
+    misses_++;
+    return nullptr;
+}
+
+std::shared_ptr<const UniformityCache::Entry> UniformityCache::Add(const std::string& key,
+                                                                   Entry&& entry) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (auto existing = entries_.Get(key)) {
+        // Another thread analyzed the same function.
+        return *existing;
+    }
+    if (entries_.Count() >= max_entries_) {
+        entries_.Clear();
+    }
+    entry.id = next_id_++;
+    auto added = std::make_shared<const Entry>(std::move(entry));
+    entries_.Add(key, added);
+    return added;
+}
+
+void UniformityCache::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.Clear();
+}
+
+size_t UniformityCache::Count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.Count();
+}
+
+size_t UniformityCache::Hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+}
+
+size_t UniformityCache::Misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+}
+
+bool AnalyzeUniformity(ProgramBuilder& builder,
+                       const DependencyGraph& dependency_graph,
+                       uint32_t max_threads,
+                       UniformityCache* cache) {
+    TINT_SCOPED_PHASE_TIMER(kUniformity);
+    auto analyze = [&](UniformityCache* with_cache) {
+        if (max_threads > 1 && !TINT_DUMP_UNIFORMITY_GRAPH) {
+            return AnalyzeConcurrently(builder, dependency_graph, max_threads, with_cache);
+        }
+        FunctionInfos functions;
+        UniformityGraph graph(builder, functions, builder.Diagnostics(), with_cache);
+        return graph.Build(dependency_graph);
+    };
+    if (cache && analyze(cache)) {
+        return true;
+    }
+    // Issues are not reported when analyzing with a cache, so analyze the whole program again.
+    return analyze(nullptr);
 }
 
 }  // namespace tint::resolver
@@ -28,6 +28,13 @@
 #ifndef SRC_TINT_LANG_WGSL_RESOLVER_UNIFORMITY_H_
 #define SRC_TINT_LANG_WGSL_RESOLVER_UNIFORMITY_H_
 
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "src/tint/utils/containers/hashmap.h"
+
 // Forward declarations.
 namespace tint::resolver {
 struct DependencyGraph;
@@ -41,11 +48,73 @@ namespace tint::resolver {
 /// If true, uniformity analysis failures will be treated as an error, else as a warning.
 constexpr bool kUniformityFailuresAsError = true;
 
+/// UniformityCache holds the uniformity requirements and effects of functions that have been
+/// analyzed without finding any uniformity issues, so that identical functions in other programs do
+/// not need to be analyzed again.
+/// A function is identical if it has the same source text, references module-scope variables with
+/// the same names, kinds, address spaces, access modes and types, calls identical functions, and is
+/// analyzed with the same module-level `derivative_uniformity` diagnostic severity.
+/// UniformityCache is thread-safe, and may be shared by programs resolved on different threads.
+class UniformityCache {
+  public:
+    /// The uniformity requirements and effects of an analyzed function.
+    struct Entry;
+
+    /// Constructor
+    /// @param max_entries the maximum number of entries held by the cache. When the cache is full,
+    /// all the entries are removed before a new entry is added.
+    explicit UniformityCache(size_t max_entries = 4096);
+
+    /// Destructor
+    ~UniformityCache();
+
+    /// @param key the key of the function
+    /// @returns the entry with the given key, or nullptr if the cache has no such entry
+    std::shared_ptr<const Entry> Find(const std::string& key);
+
+    /// Adds an entry to the cache, assigning the entry a new identifier.
+    /// @param key the key of the function
+    /// @param entry the uniformity requirements and effects of the function
+    /// @returns the entry held by the cache with the given key
+    std::shared_ptr<const Entry> Add(const std::string& key, Entry&& entry);
+
+    /// Removes all the entries from the cache.
+    void Clear();
+
+    /// @returns the number of entries held by the cache
+    size_t Count() const;
+
+    /// @returns the number of calls to Find() that returned an entry
+    size_t Hits() const;
+
+    /// @returns the number of calls to Find() that did not return an entry
+    size_t Misses() const;
+
+  private:
+    const size_t max_entries_;
+    mutable std::mutex mutex_;
+    Hashmap<std::string, std::shared_ptr<const Entry>, 8> entries_;
+    uint64_t next_id_ = 1;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+};
+
 /// Analyze the uniformity of a program.
+/// If @p max_threads is greater than 1, functions whose callees have all been analyzed are analyzed
+/// concurrently on up to @p max_threads threads. The diagnostics produced are identical to those
+/// produced by analyzing the functions one at a time.
+/// If @p cache is not null, functions found in the cache are not analyzed again, and functions that
+/// have no uniformity issues are added to the cache. If an issue is found, the program is analyzed
+/// again without the cache, so that the diagnostics do not depend on the contents of the cache.
 /// @param builder the program to analyze
 /// @param dependency_graph the dependency-ordered module-scope declarations
+/// @param max_threads the maximum number of threads to use, including the calling thread
+/// @param cache the cache of analyzed functions, or nullptr
 /// @returns true if there are no uniformity issues, false otherwise
-bool AnalyzeUniformity(ProgramBuilder& builder, const resolver::DependencyGraph& dependency_graph);
+bool AnalyzeUniformity(ProgramBuilder& builder,
+                       const resolver::DependencyGraph& dependency_graph,
+                       uint32_t max_threads = 1,
+                       UniformityCache* cache = nullptr);
 
 }  // namespace tint::resolver
 
@@ -31,6 +31,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "src/tint/lang/wgsl/program/program_builder.h"
 #include "src/tint/lang/wgsl/reader/reader.h"
@@ -10135,5 +10136,323 @@ test:15:11 note: reading from module-scope private variable 'non_uniform' may re
 )");
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Tests for analyzing functions concurrently.
+////////////////////////////////////////////////////////////////////////////////
+
+class UniformityAnalysisConcurrencyTest : public ::testing::TestWithParam<uint32_t> {
+  protected:
+    /// Parse and resolve a WGSL shader, analyzing its functions on up to @p max_threads threads.
+    /// @param src the WGSL source code
+    /// @param max_threads the maximum number of threads to use
+    /// @returns the program
+    Program Parse(std::string src, uint32_t max_threads) {
+        wgsl::reader::Options options;
+        options.allowed_features = wgsl::AllowedFeatures::Everything();
+        options.max_resolver_threads = max_threads;
+        Source::File file("test", src);
+        return wgsl::reader::Parse(&file, options);
+    }
+
+    /// Generates a shader with @p num_functions functions, where each function calls two of the
+    /// functions declared before it. Every third function has a uniformity issue that is reported
+    /// as a warning. The functions listed in @p barriers call @p barrier in non-uniform control
+    /// flow.
+    /// @param num_functions the number of functions to generate
+    /// @param barriers pairs of function index and barrier builtin
+    /// @returns the WGSL source
+    std::string Generate(int num_functions,
+                         std::initializer_list<std::pair<int, const char*>> barriers) {
+        StringStream ss;
+        ss << "@group(0) @binding(0) var<storage, read_write> non_uniform : i32;\n";
+        for (int i = 0; i < num_functions; i++) {
+            if (i % 3 == 0) {
+                ss << "@diagnostic(warning, derivative_uniformity)\n";
+            }
+            ss << "fn f" << i << "(x : i32) -> i32 {\n";
+            if (i % 3 == 0) {
+                ss << "  if (x == non_uniform) { _ = dpdx(1.0); }\n";
+            }
+            for (auto& barrier : barriers) {
+                if (barrier.first == i) {
+                    ss << "  if (x == non_uniform) { " << barrier.second << "(); }\n";
+                }
+            }
+            if (i == 0) {
+                ss << "  return x;\n";
+            } else {
+                ss << "  return f" << (i - 1) / 2 << "(x) + f" << (i - 1) / 3 << "(x);\n";
+            }
+            ss << "}\n";
+        }
+        return ss.str();
+    }
+};
+
+TEST_P(UniformityAnalysisConcurrencyTest, Pass) {
+    auto src = Generate(64, {});
+
+    auto serial = Parse(src, 1);
+    auto concurrent = Parse(src, GetParam());
+    EXPECT_TRUE(serial.IsValid()) << serial.Diagnostics().Str();
+    EXPECT_TRUE(concurrent.IsValid()) << concurrent.Diagnostics().Str();
+    EXPECT_EQ(concurrent.Diagnostics().Str(), serial.Diagnostics().Str());
+}
+
+TEST_P(UniformityAnalysisConcurrencyTest, Fail) {
+    // Only the first failing function in dependency order is reported, along with the warnings of
+    // the functions before it.
+    auto src = Generate(64, {{25, "workgroupBarrier"}, {40, "storageBarrier"}});
+
+    auto serial = Parse(src, 1);
+    auto concurrent = Parse(src, GetParam());
+    EXPECT_FALSE(serial.IsValid());
+    EXPECT_FALSE(concurrent.IsValid());
+    EXPECT_THAT(serial.Diagnostics().Str(),
+                ::testing::HasSubstr(
+                    "error: 'workgroupBarrier' must only be called from uniform control flow"));
+    EXPECT_THAT(serial.Diagnostics().Str(), ::testing::Not(::testing::HasSubstr("storageBarrier")));
+    EXPECT_EQ(concurrent.Diagnostics().Str(), serial.Diagnostics().Str());
+}
+
+INSTANTIATE_TEST_SUITE_P(UniformityAnalysisTest,
+                         UniformityAnalysisConcurrencyTest,
+                         ::testing::Values(2u, 3u, 8u));
+
+class UniformityCacheTest : public ::testing::Test {
+  protected:
+    /// Parse and resolve a WGSL shader.
+    /// @param src the WGSL source code
+    /// @param cache the uniformity cache, or nullptr
+    /// @param max_threads the maximum number of threads to use
+    /// @returns the program
+    Program Parse(std::string src, UniformityCache* cache, uint32_t max_threads = 1) {
+        wgsl::reader::Options options;
+        options.allowed_features = wgsl::AllowedFeatures::Everything();
+        options.max_resolver_threads = max_threads;
+        options.uniformity_cache = cache;
+        files_.push_back(std::make_unique<Source::File>("test", src));
+        return wgsl::reader::Parse(files_.back().get(), options);
+    }
+
+    /// Checks that resolving @p src with @p cache produces the same diagnostics as resolving it
+    /// without a cache.
+    /// @param src the WGSL source code
+    /// @param cache the uniformity cache
+    /// @param max_threads the maximum number of threads to use
+    /// @returns true if the program is valid
+    bool ParseAndCompare(std::string src, UniformityCache& cache, uint32_t max_threads = 1) {
+        auto cached = Parse(src, &cache, max_threads);
+        auto uncached = Parse(src, nullptr);
+        EXPECT_EQ(cached.IsValid(), uncached.IsValid());
+        EXPECT_EQ(cached.Diagnostics().Str(), uncached.Diagnostics().Str());
+        return cached.IsValid();
+    }
+
+    /// The source files of the parsed programs.
+    std::vector<std::unique_ptr<Source::File>> files_;
+};
+
+TEST_F(UniformityCacheTest, ReusesFunctionsAcrossPrograms) {
+    std::string helpers = R"(
+fn helper_a(x : i32) -> i32 {
+  return x * 2;
+}
+
+fn helper_b(p : ptr<function, i32>, x : i32) {
+  *p = helper_a(x);
+}
+
+fn helper_c(x : i32) {
+  if (x == 0) {
+    workgroupBarrier();
+  }
+}
+)";
+
+    UniformityCache cache;
+    EXPECT_TRUE(ParseAndCompare(helpers + R"(
+@compute @workgroup_size(64)
+fn main_a() {
+  var v : i32;
+  helper_b(&v, 1);
+  helper_c(v);
+}
+)",
+                                cache));
+    EXPECT_EQ(cache.Count(), 4u);
+    EXPECT_EQ(cache.Hits(), 0u);
+
+    EXPECT_TRUE(ParseAndCompare(helpers + R"(
+@compute @workgroup_size(64)
+fn main_b(@builtin(local_invocation_index) idx : u32) {
+  helper_c(helper_a(1));
+}
+)",
+                                cache));
+    EXPECT_EQ(cache.Count(), 5u);
+    EXPECT_EQ(cache.Hits(), 3u);
+
+    // The cached results of helper_b and helper_c are used to find the issue.
+    EXPECT_FALSE(ParseAndCompare(helpers + R"(
+@compute @workgroup_size(64)
+fn main_c(@builtin(local_invocation_index) idx : u32) {
+  var v : i32;
+  helper_b(&v, i32(idx));
+  helper_c(v);
+}
+)",
+                                 cache));
+    EXPECT_EQ(cache.Count(), 5u);
+    EXPECT_EQ(cache.Hits(), 6u);
+}
+
+TEST_F(UniformityCacheTest, ReusesFunctionsAcrossPrograms_Concurrent) {
+    StringStream helpers;
+    for (int i = 0; i < 16; i++) {
+        helpers << "fn helper" << i << "(x : i32) -> i32 {\n";
+        helpers << "  if (x == 0) { workgroupBarrier(); }\n";
+        helpers << "  return " << (i == 0 ? "x" : "helper" + std::to_string(i / 2) + "(x)")
+                << " + 1;\n";
+        helpers << "}\n";
+    }
+
+    UniformityCache cache;
+    EXPECT_TRUE(ParseAndCompare(helpers.str() + R"(
+@compute @workgroup_size(64)
+fn main_a() {
+  _ = helper15(1);
+}
+)",
+                                cache, 4));
+    EXPECT_EQ(cache.Count(), 17u);
+
+    EXPECT_FALSE(ParseAndCompare(helpers.str() + R"(
+@compute @workgroup_size(64)
+fn main_b(@builtin(local_invocation_index) idx : u32) {
+  _ = helper15(i32(idx));
+}
+)",
+                                 cache, 4));
+    EXPECT_EQ(cache.Hits(), 16u);
+}
+
+TEST_F(UniformityCacheTest, DifferentGlobalIsNotReused) {
+    std::string helper = R"(
+fn helper() {
+  if (flag == 0) {
+    workgroupBarrier();
+  }
+}
+
+@compute @workgroup_size(64)
+fn main() {
+  helper();
+}
+)";
+
+    UniformityCache cache;
+    EXPECT_TRUE(
+        ParseAndCompare("@group(0) @binding(0) var<uniform> flag : i32;\n" + helper, cache));
+    EXPECT_FALSE(ParseAndCompare(
+        "@group(0) @binding(0) var<storage, read_write> flag : i32;\n" + helper, cache));
+    EXPECT_EQ(cache.Hits(), 0u);
+}
+
+TEST_F(UniformityCacheTest, DifferentCalleeIsNotReused) {
+    std::string caller = R"(
+fn caller(x : u32) {
+  callee(x);
+}
+
+@compute @workgroup_size(64)
+fn main(@builtin(local_invocation_index) idx : u32) {
+  caller(idx);
+}
+)";
+
+    UniformityCache cache;
+    EXPECT_TRUE(ParseAndCompare(R"(
+fn callee(x : u32) {
+  _ = x;
+}
+)" + caller,
+                                cache));
+    EXPECT_FALSE(ParseAndCompare(R"(
+fn callee(x : u32) {
+  if (x == 0) {
+    workgroupBarrier();
+  }
+}
+)" + caller,
+                                 cache));
+    EXPECT_EQ(cache.Hits(), 0u);
+}
+
+TEST_F(UniformityCacheTest, ShadowedBuiltinIsNotReused) {
+    std::string helper = R"(
+fn helper(x : f32) -> f32 {
+  if (x > 0.0) {
+    return dpdx(x);
+  }
+  return 0.0;
+}
+
+@fragment
+fn main(@builtin(position) pos : vec4f) {
+  _ = helper(pos.x);
+}
+)";
+
+    // `dpdx` is shadowed by a type, so the call is a value conversion.
+    UniformityCache cache;
+    EXPECT_TRUE(ParseAndCompare("alias dpdx = f32;\n" + helper, cache));
+    EXPECT_FALSE(ParseAndCompare(helper, cache));
+    EXPECT_EQ(cache.Hits(), 0u);
+}
+
+TEST_F(UniformityCacheTest, DifferentModuleSeverityIsNotReused) {
+    std::string helper = R"(
+fn helper(x : f32) -> f32 {
+  if (x > 0.0) {
+    return dpdx(x);
+  }
+  return 0.0;
+}
+
+@fragment
+fn main(@builtin(position) pos : vec4f) {
+  _ = helper(pos.x);
+}
+)";
+
+    UniformityCache cache;
+    EXPECT_TRUE(ParseAndCompare("diagnostic(off, derivative_uniformity);\n" + helper, cache));
+    EXPECT_FALSE(ParseAndCompare(helper, cache));
+
+    // Warnings are reported for every program, and are never cached.
+    auto with_warning = "diagnostic(warning, derivative_uniformity);\n" + helper;
+    EXPECT_TRUE(ParseAndCompare(with_warning, cache));
+    EXPECT_TRUE(ParseAndCompare(with_warning, cache));
+    EXPECT_EQ(cache.Hits(), 1u);
+    EXPECT_THAT(
+        Parse(with_warning, &cache).Diagnostics().Str(),
+        ::testing::HasSubstr("warning: 'dpdx' must only be called from uniform control flow"));
+}
+
+TEST_F(UniformityCacheTest, MaxEntries) {
+    UniformityCache cache(2);
+    EXPECT_TRUE(ParseAndCompare(R"(
+fn a() {}
+fn b() { a(); }
+fn c() { b(); }
+)",
+                                cache));
+    EXPECT_LE(cache.Count(), 2u);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Count(), 0u);
+}
+
 }  // namespace
 }  // namespace tint::resolver
@@ -59,6 +59,7 @@ tint_target_add_dependencies(tint_lang_wgsl_writer_raise lib
   tint_lang_wgsl_intrinsic
   tint_lang_wgsl_ir
   tint_utils_containers
+  tint_utils_debug
   tint_utils_diagnostic
   tint_utils_ice
   tint_utils_id
@@ -39,6 +39,7 @@
 #include "src/tint/lang/wgsl/ir/builtin_call.h"
 #include "src/tint/lang/wgsl/writer/raise/ptr_to_ref.h"
 #include "src/tint/lang/wgsl/writer/raise/value_to_let.h"
+#include "src/tint/utils/debug/phase_timer.h"
 #include "src/tint/utils/result/result.h"
 
 namespace tint::wgsl::writer {
@@ -223,28 +224,40 @@ void ReplaceWorkgroupBarrier(core::ir::Builder& b, core::ir::CoreBuiltinCall* ca
 }  // namespace
 
 Result<SuccessType> Raise(core::ir::Module& mod) {
-    core::ir::Builder b{mod};
-    for (auto* inst : mod.Instructions()) {
-        if (auto* call = inst->As<core::ir::CoreBuiltinCall>()) {
-            switch (call->Func()) {
-                case core::BuiltinFn::kWorkgroupBarrier:
-                    ReplaceWorkgroupBarrier(b, call);
-                    break;
-                default:
-                    ReplaceBuiltinFnCall(b, call);
-                    break;
+    {
+        TINT_SCOPED_PASS_TIMER("raise::BuiltinFns");
+        core::ir::Builder b{mod};
+        for (auto* inst : mod.Instructions()) {
+            if (auto* call = inst->As<core::ir::CoreBuiltinCall>()) {
+                switch (call->Func()) {
+                    case core::BuiltinFn::kWorkgroupBarrier:
+                        ReplaceWorkgroupBarrier(b, call);
+                        break;
+                    default:
+                        ReplaceBuiltinFnCall(b, call);
+                        break;
+                }
             }
         }
     }
 
-    if (auto result = core::ir::transform::RenameConflicts(mod); result != Success) {
-        return result.Failure();
+    {
+        TINT_SCOPED_PASS_TIMER("core::ir::transform::RenameConflicts");
+        if (auto result = core::ir::transform::RenameConflicts(mod); result != Success) {
+            return result.Failure();
+        }
     }
-    if (auto result = raise::ValueToLet(mod); result != Success) {
-        return result.Failure();
+    {
+        TINT_SCOPED_PASS_TIMER("raise::ValueToLet");
+        if (auto result = raise::ValueToLet(mod); result != Success) {
+            return result.Failure();
+        }
     }
-    if (auto result = raise::PtrToRef(mod); result != Success) {
-        return result.Failure();
+    {
+        TINT_SCOPED_PASS_TIMER("raise::PtrToRef");
+        if (auto result = raise::PtrToRef(mod); result != Success) {
+            return result.Failure();
+        }
     }
 
     return Success;
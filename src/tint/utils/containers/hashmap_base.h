@@ -279,6 +279,7 @@ class HashmapBase {
             }
             slots_[slot_idx].nodes = nullptr;
         }
+        count_ = 0;
     }
 
     /// Ensures that the map can hold @p n entries without heap reallocation or rehashing.
@@ -299,6 +300,9 @@ class HashmapBase {
     /// the map is cleared, or the map is destructed.
     template <typename K>
     Entry* GetEntry(K&& key) {
+        if (count_ == 0) {
+            return nullptr;
+        }
         HashCode hash = Hash{}(key);
         auto& slot = slots_[hash % slots_.Length()];
         return slot.Find(hash, key);
@@ -311,6 +315,9 @@ class HashmapBase {
     /// the map is cleared, or the map is destructed.
     template <typename K>
     const Entry* GetEntry(K&& key) const {
+        if (count_ == 0) {
+            return nullptr;
+        }
         HashCode hash = Hash{}(key);
         auto& slot = slots_[hash % slots_.Length()];
         return slot.Find(hash, key);
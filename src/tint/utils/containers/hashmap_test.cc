@@ -66,6 +66,20 @@ TEST(Hashmap, AddRemove) {
     EXPECT_FALSE(map.Contains("world"));
 }
 
+TEST(Hashmap, Clear) {
+    Hashmap<std::string, std::string, 8> map;
+    map.Add("hello", "world");
+    map.Add("cat", "dog");
+    EXPECT_EQ(map.Count(), 2u);
+    map.Clear();
+    EXPECT_EQ(map.Count(), 0u);
+    EXPECT_TRUE(map.IsEmpty());
+    EXPECT_FALSE(map.Contains("hello"));
+    EXPECT_TRUE(map.Add("hello", "cat"));
+    EXPECT_EQ(map.Count(), 1u);
+    EXPECT_EQ(map.Get("hello"), "cat");
+}
+
 TEST(Hashmap, ReplaceRemove) {
     Hashmap<std::string, std::string, 8> map;
     map.Replace("hello", "world");
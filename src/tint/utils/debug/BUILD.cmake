@@ -41,4 +41,27 @@
 tint_add_target(tint_utils_debug lib
   utils/debug/debugger.cc
   utils/debug/debugger.h
+  utils/debug/phase_timer.cc
+  utils/debug/phase_timer.h
+)
+
+tint_target_add_dependencies(tint_utils_debug lib
+  tint_utils_macros
+)
+
+################################################################################
+# Target:    tint_utils_debug_test
+# Kind:      test
+################################################################################
+tint_add_target(tint_utils_debug_test test
+  utils/debug/phase_timer_test.cc
+)
+
+tint_target_add_dependencies(tint_utils_debug_test test
+  tint_utils_debug
+  tint_utils_macros
+)
+
+tint_target_add_external_dependencies(tint_utils_debug_test test
+  "gtest"
 )
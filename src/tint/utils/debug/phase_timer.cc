@@ -0,0 +1,162 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/utils/debug/phase_timer.h"
+
+#include <algorithm>
+
+namespace tint {
+namespace {
+
+/// The destination of the phase timers of the current thread
+thread_local PhaseTimings* tls_timings = nullptr;
+
+/// The innermost active phase timer of the current thread
+thread_local ScopedPhaseTimer* tls_current_timer = nullptr;
+
+/// The destination of the pass timers of the current thread
+thread_local PassTimings* tls_pass_timings = nullptr;
+
+}  // namespace
+
+std::string_view ToString(CompilePhase phase) {
+    switch (phase) {
+        case CompilePhase::kLex:
+            return "lex";
+        case CompilePhase::kParse:
+            return "parse";
+        case CompilePhase::kDependencyGraph:
+            return "dependency-graph";
+        case CompilePhase::kResolve:
+            return "resolve";
+        case CompilePhase::kValidation:
+            return "validation";
+        case CompilePhase::kUniformity:
+            return "uniformity";
+    }
+    return "<unknown>";
+}
+
+PhaseTimings::Clock::duration PhaseTimings::Total() const {
+    Clock::duration total{};
+    for (auto duration : durations_) {
+        total += duration;
+    }
+    return total;
+}
+
+PhaseTimingScope::PhaseTimingScope(PhaseTimings& timings) : previous_(tls_timings) {
+    tls_timings = &timings;
+}
+
+PhaseTimingScope::~PhaseTimingScope() {
+    tls_timings = previous_;
+}
+
+ScopedPhaseTimer::ScopedPhaseTimer(CompilePhase phase) : timings_(tls_timings), phase_(phase) {
+    if (!timings_) {
+        return;
+    }
+    start_ = PhaseTimings::Clock::now();
+    parent_ = tls_current_timer;
+    if (parent_) {
+        // Pause the enclosing phase.
+        parent_->timings_->Add(parent_->phase_, start_ - parent_->start_);
+    }
+    tls_current_timer = this;
+}
+
+ScopedPhaseTimer::~ScopedPhaseTimer() {
+    if (!timings_) {
+        return;
+    }
+    auto now = PhaseTimings::Clock::now();
+    timings_->Add(phase_, now - start_);
+    tls_current_timer = parent_;
+    if (parent_) {
+        // Resume the enclosing phase.
+        parent_->start_ = now;
+    }
+}
+
+void PassTimings::Add(std::string_view name, Clock::duration duration) {
+    // Pipelines run a few dozen passes at most, so a linear search beats hashing.
+    for (auto& entry : entries_) {
+        if (entry.name == name) {
+            entry.duration += duration;
+            entry.count++;
+            return;
+        }
+    }
+    entries_.push_back(Entry{name, duration, 1});
+}
+
+const PassTimings::Entry* PassTimings::Get(std::string_view name) const {
+    for (auto& entry : entries_) {
+        if (entry.name == name) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<PassTimings::Entry> PassTimings::Ranked() const {
+    auto ranked = entries_;
+    std::stable_sort(ranked.begin(), ranked.end(),
+                     [](const Entry& a, const Entry& b) { return a.duration > b.duration; });
+    return ranked;
+}
+
+PassTimings::Clock::duration PassTimings::Total() const {
+    Clock::duration total{};
+    for (auto& entry : entries_) {
+        total += entry.duration;
+    }
+    return total;
+}
+
+PassTimingScope::PassTimingScope(PassTimings& timings) : previous_(tls_pass_timings) {
+    tls_pass_timings = &timings;
+}
+
+PassTimingScope::~PassTimingScope() {
+    tls_pass_timings = previous_;
+}
+
+ScopedPassTimer::ScopedPassTimer(std::string_view name) : timings_(tls_pass_timings), name_(name) {
+    if (timings_) {
+        start_ = PassTimings::Clock::now();
+    }
+}
+
+ScopedPassTimer::~ScopedPassTimer() {
+    if (timings_) {
+        timings_->Add(name_, PassTimings::Clock::now() - start_);
+    }
+}
+
+}  // namespace tint
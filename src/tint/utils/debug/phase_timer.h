@@ -0,0 +1,229 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_UTILS_DEBUG_PHASE_TIMER_H_
+#define SRC_TINT_UTILS_DEBUG_PHASE_TIMER_H_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "src/tint/utils/macros/compiler.h"
+#include "src/tint/utils/macros/concat.h"
+
+#ifndef TINT_ENABLE_PHASE_TIMING
+#define TINT_ENABLE_PHASE_TIMING 0
+#endif
+
+namespace tint {
+
+/// The phases of the WGSL front end that are timed by TINT_SCOPED_PHASE_TIMER()
+enum class CompilePhase : uint8_t {
+    /// Converting the WGSL source into tokens
+    kLex,
+    /// Building the AST from the tokens, excluding lexing
+    kParse,
+    /// Building the module-scope dependency graph
+    kDependencyGraph,
+    /// Semantic analysis, including the validation of each declaration, statement and expression
+    kResolve,
+    /// Module-scope validation that happens after all declarations have been resolved
+    kValidation,
+    /// The uniformity analysis
+    kUniformity,
+};
+
+/// The number of CompilePhase enumerators
+static constexpr size_t kNumCompilePhases = 6;
+
+/// @param phase the compile phase
+/// @returns the name of @p phase
+std::string_view ToString(CompilePhase phase);
+
+/// PhaseTimings holds the time spent in each CompilePhase.
+/// Time is exclusive: a phase that is entered while another is active pauses the outer phase, so
+/// for example the lexing done on demand by the parser is not counted as parse time.
+class PhaseTimings {
+  public:
+    /// The clock used for timing
+    using Clock = std::chrono::steady_clock;
+
+    /// True if the phase timers were compiled in. If false, all timings will remain zero.
+    static constexpr bool kEnabled = TINT_ENABLE_PHASE_TIMING;
+
+    /// @param phase the compile phase
+    /// @returns the time spent in @p phase
+    Clock::duration Get(CompilePhase phase) const { return durations_[static_cast<size_t>(phase)]; }
+
+    /// @returns the total time spent in all phases
+    Clock::duration Total() const;
+
+    /// Adds @p duration to the time spent in @p phase
+    /// @param phase the compile phase
+    /// @param duration the time to add
+    void Add(CompilePhase phase, Clock::duration duration) {
+        durations_[static_cast<size_t>(phase)] += duration;
+    }
+
+    /// Resets all the timings to zero
+    void Clear() { durations_ = {}; }
+
+  private:
+    std::array<Clock::duration, kNumCompilePhases> durations_{};
+};
+
+/// PhaseTimingScope makes a PhaseTimings the destination for the phase timers of the current
+/// thread, for the lifetime of the PhaseTimingScope. Scopes can be nested.
+class PhaseTimingScope {
+  public:
+    /// Constructor
+    /// @param timings the timings to accumulate into
+    explicit PhaseTimingScope(PhaseTimings& timings);
+
+    /// Destructor. Restores the previous destination.
+    ~PhaseTimingScope();
+
+  private:
+    PhaseTimings* const previous_;
+};
+
+/// ScopedPhaseTimer attributes the time of its lifetime to a compile phase, if a PhaseTimingScope
+/// is active on the current thread. Use TINT_SCOPED_PHASE_TIMER() instead of using this directly,
+/// so that the timers are compiled out when TINT_ENABLE_PHASE_TIMING is 0.
+class ScopedPhaseTimer {
+  public:
+    /// Constructor. Pauses the enclosing timer, if there is one.
+    /// @param phase the phase to attribute time to
+    explicit ScopedPhaseTimer(CompilePhase phase);
+
+    /// Destructor. Resumes the enclosing timer, if there is one.
+    ~ScopedPhaseTimer();
+
+  private:
+    PhaseTimings* const timings_;
+    const CompilePhase phase_;
+    ScopedPhaseTimer* parent_ = nullptr;
+    PhaseTimings::Clock::time_point start_;
+};
+
+/// PassTimings holds the time spent in each named IR pass, such as the transforms run by a
+/// backend's raise pipeline. Unlike PhaseTimings, time is inclusive of any nested passes.
+class PassTimings {
+  public:
+    /// The clock used for timing
+    using Clock = PhaseTimings::Clock;
+
+    /// True if the pass timers were compiled in. If false, no passes will be recorded.
+    static constexpr bool kEnabled = TINT_ENABLE_PHASE_TIMING;
+
+    /// The accumulated timing of a single pass
+    struct Entry {
+        /// The name of the pass
+        std::string_view name;
+        /// The total time spent in the pass
+        Clock::duration duration{};
+        /// The number of times the pass was run
+        uint32_t count = 0;
+    };
+
+    /// Adds @p duration to the time spent in the pass with the name @p name
+    /// @param name the name of the pass. Must outlive the PassTimings.
+    /// @param duration the time to add
+    void Add(std::string_view name, Clock::duration duration);
+
+    /// @param name the name of the pass
+    /// @returns the timing of the pass with the name @p name, or nullptr if the pass was not run
+    const Entry* Get(std::string_view name) const;
+
+    /// @returns the timings of all the passes, in the order they were first run
+    const std::vector<Entry>& Entries() const { return entries_; }
+
+    /// @returns the timings of all the passes, sorted by decreasing total duration
+    std::vector<Entry> Ranked() const;
+
+    /// @returns the total time spent in all passes
+    Clock::duration Total() const;
+
+    /// Removes all the timings
+    void Clear() { entries_.clear(); }
+
+  private:
+    std::vector<Entry> entries_;
+};
+
+/// PassTimingScope makes a PassTimings the destination for the pass timers of the current thread,
+/// for the lifetime of the PassTimingScope. Scopes can be nested.
+class PassTimingScope {
+  public:
+    /// Constructor
+    /// @param timings the timings to accumulate into
+    explicit PassTimingScope(PassTimings& timings);
+
+    /// Destructor. Restores the previous destination.
+    ~PassTimingScope();
+
+  private:
+    PassTimings* const previous_;
+};
+
+/// ScopedPassTimer attributes the time of its lifetime to a named pass, if a PassTimingScope is
+/// active on the current thread. Use TINT_SCOPED_PASS_TIMER() instead of using this directly, so
+/// that the timers are compiled out when TINT_ENABLE_PHASE_TIMING is 0.
+class ScopedPassTimer {
+  public:
+    /// Constructor
+    /// @param name the name of the pass. Must outlive the PassTimings, so is usually a literal.
+    explicit ScopedPassTimer(std::string_view name);
+
+    /// Destructor
+    ~ScopedPassTimer();
+
+  private:
+    PassTimings* const timings_;
+    const std::string_view name_;
+    PassTimings::Clock::time_point start_;
+};
+
+}  // namespace tint
+
+#if TINT_ENABLE_PHASE_TIMING
+/// Times the remainder of the enclosing scope as the compile phase `PHASE`
+#define TINT_SCOPED_PHASE_TIMER(PHASE) \
+    ::tint::ScopedPhaseTimer TINT_CONCAT(tint_phase_timer_, __LINE__)(::tint::CompilePhase::PHASE)
+/// Times the remainder of the enclosing scope as the pass with the name `NAME`
+#define TINT_SCOPED_PASS_TIMER(NAME) \
+    ::tint::ScopedPassTimer TINT_CONCAT(tint_pass_timer_, __LINE__)(NAME)
+#else
+/// Phase timing is disabled. TINT_SCOPED_PHASE_TIMER() is a no-op.
+#define TINT_SCOPED_PHASE_TIMER(PHASE) TINT_REQUIRE_SEMICOLON
+/// Phase timing is disabled. TINT_SCOPED_PASS_TIMER() is a no-op.
+#define TINT_SCOPED_PASS_TIMER(NAME) TINT_REQUIRE_SEMICOLON
+#endif
+
+#endif  // SRC_TINT_UTILS_DEBUG_PHASE_TIMER_H_
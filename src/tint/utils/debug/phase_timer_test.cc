@@ -0,0 +1,164 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/utils/debug/phase_timer.h"
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace tint {
+namespace {
+
+using namespace std::chrono_literals;  // NOLINT
+
+TEST(PhaseTimerTest, AccumulatesIntoScope) {
+    PhaseTimings timings;
+    {
+        PhaseTimingScope scope(timings);
+        {
+            ScopedPhaseTimer timer(CompilePhase::kResolve);
+            std::this_thread::sleep_for(2ms);
+        }
+        {
+            ScopedPhaseTimer timer(CompilePhase::kResolve);
+            std::this_thread::sleep_for(2ms);
+        }
+    }
+    EXPECT_GE(timings.Get(CompilePhase::kResolve), 4ms);
+    EXPECT_EQ(timings.Get(CompilePhase::kParse), PhaseTimings::Clock::duration::zero());
+    EXPECT_EQ(timings.Total(), timings.Get(CompilePhase::kResolve));
+
+    // Timers after the scope has ended are not recorded.
+    auto resolve = timings.Get(CompilePhase::kResolve);
+    { ScopedPhaseTimer timer(CompilePhase::kResolve); }
+    EXPECT_EQ(timings.Get(CompilePhase::kResolve), resolve);
+}
+
+TEST(PhaseTimerTest, NestedTimersAreExclusive) {
+    PhaseTimings timings;
+    PhaseTimingScope scope(timings);
+    PhaseTimings::Clock::duration outer_elapsed;
+    {
+        auto start = PhaseTimings::Clock::now();
+        {
+            ScopedPhaseTimer parse(CompilePhase::kParse);
+            {
+                ScopedPhaseTimer lex(CompilePhase::kLex);
+                std::this_thread::sleep_for(5ms);
+            }
+        }
+        outer_elapsed = PhaseTimings::Clock::now() - start;
+    }
+    EXPECT_GE(timings.Get(CompilePhase::kLex), 5ms);
+    // The lexing time is not counted as parse time.
+    EXPECT_LT(timings.Get(CompilePhase::kParse), timings.Get(CompilePhase::kLex));
+    EXPECT_LE(timings.Total(), outer_elapsed);
+}
+
+TEST(PhaseTimerTest, NestedScopes) {
+    PhaseTimings outer;
+    PhaseTimings inner;
+    PhaseTimingScope outer_scope(outer);
+    {
+        PhaseTimingScope inner_scope(inner);
+        ScopedPhaseTimer timer(CompilePhase::kUniformity);
+        std::this_thread::sleep_for(1ms);
+    }
+    {
+        ScopedPhaseTimer timer(CompilePhase::kValidation);
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_GE(inner.Get(CompilePhase::kUniformity), 1ms);
+    EXPECT_EQ(inner.Get(CompilePhase::kValidation), PhaseTimings::Clock::duration::zero());
+    EXPECT_EQ(outer.Get(CompilePhase::kUniformity), PhaseTimings::Clock::duration::zero());
+    EXPECT_GE(outer.Get(CompilePhase::kValidation), 1ms);
+}
+
+TEST(PhaseTimerTest, ToString) {
+    EXPECT_EQ(ToString(CompilePhase::kLex), "lex");
+    EXPECT_EQ(ToString(CompilePhase::kDependencyGraph), "dependency-graph");
+    EXPECT_EQ(ToString(CompilePhase::kUniformity), "uniformity");
+}
+
+TEST(PassTimerTest, AccumulatesIntoScope) {
+    PassTimings timings;
+    {
+        PassTimingScope scope(timings);
+        {
+            ScopedPassTimer timer("a");
+            std::this_thread::sleep_for(2ms);
+        }
+        {
+            ScopedPassTimer timer("b");
+            std::this_thread::sleep_for(1ms);
+        }
+        {
+            ScopedPassTimer timer("a");
+            std::this_thread::sleep_for(2ms);
+        }
+    }
+    ASSERT_EQ(timings.Entries().size(), 2u);
+    ASSERT_NE(timings.Get("a"), nullptr);
+    ASSERT_NE(timings.Get("b"), nullptr);
+    EXPECT_EQ(timings.Get("c"), nullptr);
+    EXPECT_EQ(timings.Get("a")->count, 2u);
+    EXPECT_EQ(timings.Get("b")->count, 1u);
+    EXPECT_GE(timings.Get("a")->duration, 4ms);
+    EXPECT_GE(timings.Get("b")->duration, 1ms);
+    EXPECT_EQ(timings.Total(), timings.Get("a")->duration + timings.Get("b")->duration);
+
+    // Timers after the scope has ended are not recorded.
+    { ScopedPassTimer timer("c"); }
+    EXPECT_EQ(timings.Get("c"), nullptr);
+
+    timings.Clear();
+    EXPECT_TRUE(timings.Entries().empty());
+}
+
+TEST(PassTimerTest, Ranked) {
+    PassTimings timings;
+    timings.Add("fast", 1ms);
+    timings.Add("slow", 5ms);
+    timings.Add("medium", 3ms);
+    timings.Add("fast", 1ms);
+
+    auto ranked = timings.Ranked();
+    ASSERT_EQ(ranked.size(), 3u);
+    EXPECT_EQ(ranked[0].name, "slow");
+    EXPECT_EQ(ranked[1].name, "medium");
+    EXPECT_EQ(ranked[2].name, "fast");
+    EXPECT_EQ(ranked[2].count, 2u);
+    EXPECT_EQ(ranked[2].duration, 2ms);
+
+    // Entries() preserves the order the passes were first run.
+    EXPECT_EQ(timings.Entries()[0].name, "fast");
+    EXPECT_EQ(timings.Entries()[1].name, "slow");
+}
+
+}  // namespace
+}  // namespace tint
@@ -39,6 +39,17 @@ SymbolTable::~SymbolTable() = default;
 
 SymbolTable& SymbolTable::operator=(SymbolTable&&) = default;
 
+bool SymbolTable::Share(const SymbolTable& o) {
+    if (next_symbol_ != 1) {
+        return false;
+    }
+    next_symbol_ = o.next_symbol_;
+    name_to_symbol_ = o.name_to_symbol_;
+    names_ = std::make_shared<NamePool>();
+    names_->shared = o.names_;
+    return true;
+}
+
 Symbol SymbolTable::Register(std::string_view name) {
     TINT_ASSERT(!name.empty());
 
@@ -61,22 +72,20 @@ Symbol SymbolTable::Get(std::string_view name) const {
 }
 
 Symbol SymbolTable::New(std::string_view prefix_view /* = "" */) {
-    std::string prefix;
     if (prefix_view.empty()) {
-        prefix = "tint_symbol";
-    } else {
-        prefix = std::string(prefix_view);
+        prefix_view = "tint_symbol";
     }
 
-    auto& it = name_to_symbol_.GetOrAddZeroEntry(prefix);
+    auto& it = name_to_symbol_.GetOrAddZeroEntry(prefix_view);
     if (it.value == 0) {
         // prefix is a unique name
-        auto view = Allocate(prefix);
+        auto view = Allocate(prefix_view);
         it.key = view;
         it.value = next_symbol_++;
         return Symbol{it.value, generation_id_, view};
     }
 
+    std::string prefix(prefix_view);
     size_t& i = last_prefix_to_index_.GetOrAddZero(prefix);
     std::string name;
     do {
@@ -91,7 +100,10 @@ Symbol SymbolTable::New(std::string_view prefix_view /* = "" */) {
 
 std::string_view SymbolTable::Allocate(std::string_view name) {
     static_assert(sizeof(char) == 1);
-    char* name_mem = Bitcast<char*>(name_allocator_.Allocate(name.length() + 1));
+    if (!names_) {
+        names_ = std::make_shared<NamePool>();
+    }
+    char* name_mem = Bitcast<char*>(names_->allocator.Allocate(name.length() + 1));
     if (name_mem == nullptr) {
         TINT_ICE() << "failed to allocate memory for symbol's string";
     }
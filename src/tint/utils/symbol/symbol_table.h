@@ -28,6 +28,7 @@
 #ifndef SRC_TINT_UTILS_SYMBOL_SYMBOL_TABLE_H_
 #define SRC_TINT_UTILS_SYMBOL_SYMBOL_TABLE_H_
 
+#include <memory>
 #include <string>
 
 #include "src/tint/utils/containers/hashmap.h"
@@ -56,8 +57,7 @@ class SymbolTable {
     /// @returns a symbol table to hold symbols which point to the allocated names in @p o.
     /// The symbol table after Wrap is intended to temporarily extend the objects of an existing
     /// immutable SymbolTable.
-    /// @warning As the copied objects are owned by @p o, @p o must not be destructed or assigned
-    /// while using this symbol table.
+    /// The returned symbol table shares and keeps alive the names of @p o.
     /// @param o the immutable SymbolTable to extend
     static SymbolTable Wrap(const SymbolTable& o) {
         SymbolTable out(o.generation_id_);
@@ -65,9 +65,19 @@ class SymbolTable {
         out.name_to_symbol_ = o.name_to_symbol_;
         out.last_prefix_to_index_ = o.last_prefix_to_index_;
         out.generation_id_ = o.generation_id_;
+        out.names_ = std::make_shared<NamePool>();
+        out.names_->shared = o.names_;
         return out;
     }
 
+    /// Adds all the symbols of @p o to this symbol table, with the same values and names. Rather
+    /// than copying the names, this symbol table shares and keeps alive the names of @p o, so @p o
+    /// can be destructed while this symbol table is still in use.
+    /// @param o the symbol table to share the symbols of
+    /// @returns true if the symbols were added, or false if this symbol table already holds symbols,
+    /// in which case this symbol table is unchanged.
+    bool Share(const SymbolTable& o);
+
     /// Registers a name into the symbol table, returning the Symbol.
     /// @param name the name to register
     /// @returns the symbol representing the given name
@@ -105,6 +115,15 @@ class SymbolTable {
 
     std::string_view Allocate(std::string_view name);
 
+    /// NamePool holds the names allocated by a symbol table. Name pools are reference counted, so
+    /// that the names can be shared with the symbol tables created by Share().
+    struct NamePool {
+        /// The allocator of the names
+        tint::BumpAllocator allocator;
+        /// The names shared from another symbol table, or nullptr
+        std::shared_ptr<const NamePool> shared;
+    };
+
     // The value to be associated to the next registered symbol table entry.
     uint32_t next_symbol_ = 1;
 
@@ -112,7 +131,8 @@ class SymbolTable {
     Hashmap<std::string, size_t, 0> last_prefix_to_index_;
     tint::GenerationID generation_id_;
 
-    tint::BumpAllocator name_allocator_;
+    /// The names of the symbols. Created on first use.
+    std::shared_ptr<NamePool> names_;
 };
 
 /// @param symbol_table the SymbolTable
@@ -50,6 +50,31 @@ TEST_F(SymbolTableTest, DeduplicatesNames) {
     EXPECT_EQ(Symbol(1, generation_id, "name"), s.Register("name"));
 }
 
+TEST_F(SymbolTableTest, Share) {
+    auto generation_id = GenerationID::New();
+    SymbolTable shared{GenerationID::New()};
+    {
+        SymbolTable s{generation_id};
+        s.Register("name");
+        s.Register("another_name");
+        EXPECT_TRUE(shared.Share(s));
+    }
+    EXPECT_EQ(Symbol(1, shared.GenerationID(), "name"), shared.Get("name"));
+    EXPECT_EQ(Symbol(2, shared.GenerationID(), "another_name"), shared.Get("another_name"));
+    EXPECT_EQ(Symbol(3, shared.GenerationID(), "name_1"), shared.New("name"));
+    EXPECT_EQ(Symbol(4, shared.GenerationID(), "third_name"), shared.Register("third_name"));
+}
+
+TEST_F(SymbolTableTest, ShareFailsIfNotEmpty) {
+    SymbolTable s{GenerationID::New()};
+    s.Register("name");
+    SymbolTable other{GenerationID::New()};
+    other.Register("other_name");
+    EXPECT_FALSE(other.Share(s));
+    EXPECT_EQ(Symbol(), other.Get("name"));
+    EXPECT_EQ(Symbol(2, other.GenerationID(), "another_name"), other.Register("another_name"));
+}
+
 TEST_F(SymbolTableDeathTest, AssertsForBlankString) {
     EXPECT_DEATH_IF_SUPPORTED(
         {